@@ -0,0 +1,185 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "BenchTools.h"
+
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+using namespace nano_stl;
+
+
+/** \brief Sink used to prevent the compiler from optimizing benchmarked operations away */
+volatile uint32_t g_bench_sink = 0u;
+
+/** \brief Benchmark name filter */
+static const char* s_bench_filter = nullptr;
+
+/** \brief Overhead in nanoseconds of a start/stop timing pair */
+static double s_timer_overhead = 0.;
+
+
+
+/** \brief Get a monotonic timestamp in nanoseconds */
+uint64_t BENCH_Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (static_cast<uint64_t>(ts.tv_sec) * 1000000000u) + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+/** \brief Measure the overhead of a start/stop timing pair */
+void BENCH_Calibrate()
+{
+    static double samples[BENCH_SAMPLE_COUNT];
+    for (nano_stl_size_t i = 0u; i < BENCH_SAMPLE_COUNT; i++)
+    {
+        const uint64_t start = BENCH_Now();
+        const uint64_t stop = BENCH_Now();
+        samples[i] = static_cast<double>(stop - start);
+    }
+    std::sort(samples, samples + BENCH_SAMPLE_COUNT);
+    s_timer_overhead = samples[BENCH_SAMPLE_COUNT / 2u];
+
+    printf("Timer overhead : %.1f ns\n", s_timer_overhead);
+}
+
+/** \brief Check if a benchmark name matches the filter given on the command line */
+bool BENCH_IsSelected(const char* name)
+{
+    return ((s_bench_filter == nullptr) || (strstr(name, s_bench_filter) != nullptr));
+}
+
+/** \brief Set the benchmark name filter (nullptr = run all benchmarks) */
+void BENCH_SetFilter(const char* filter)
+{
+    s_bench_filter = filter;
+}
+
+/** \brief Print the header of the results table */
+void BENCH_PrintHeader(const char* title)
+{
+    printf("\n===== %s =====\n", title);
+    printf("%-22s %-14s %6s %6s %10s %10s %10s %10s %14s\n",
+           "container", "operation", "item", "cap", "mean ns", "p50 ns", "p90 ns", "p99 ns", "ops/s");
+}
+
+/** \brief Print the header of the throughput results table */
+void BENCH_PrintThroughputHeader(const char* title)
+{
+    printf("\n===== %s =====\n", title);
+    printf("%-22s %-14s %6s %6s %10s %10s %10s %14s\n",
+           "function", "implementation", "size", "align", "mean ns", "p50 ns", "p99 ns", "MB/s");
+}
+
+
+/** \brief Constructor */
+BenchStats::BenchStats(const char* container, const char* operation, const nano_stl_size_t item_size, const nano_stl_size_t capacity)
+: m_container(container)
+, m_operation(operation)
+, m_item_size(item_size)
+, m_capacity(capacity)
+, m_start(0u)
+, m_elapsed(0u)
+, m_total_elapsed(0u)
+, m_op_count(0u)
+, m_chunk_count(0u)
+, m_samples()
+{}
+
+/** \brief Close the current sample */
+void BenchStats::endSample()
+{
+    if (m_op_count != 0u)
+    {
+        double elapsed = static_cast<double>(m_elapsed) - (s_timer_overhead * static_cast<double>(m_chunk_count));
+        if (elapsed < 0.)
+        {
+            elapsed = 0.;
+        }
+        m_samples.pushBack(elapsed / static_cast<double>(m_op_count));
+    }
+
+    m_total_elapsed += m_elapsed;
+    m_elapsed = 0u;
+    m_op_count = 0u;
+    m_chunk_count = 0u;
+}
+
+/** \brief Check if enough samples have been collected */
+bool BenchStats::isComplete() const
+{
+    const nano_stl_size_t count = m_samples.getCount();
+    return ((count >= BENCH_SAMPLE_COUNT) || 
+            ((count >= BENCH_MIN_SAMPLE_COUNT) && (m_total_elapsed >= BENCH_TIME_BUDGET_NS)));
+}
+
+/** \brief Print the statistics */
+void BenchStats::report()
+{
+    const nano_stl_size_t count = m_samples.getCount();
+    if (count != 0u)
+    {
+        const double mean = sortSamples();
+        const double p50 = m_samples[(count * 50u) / 100u];
+        const double p90 = m_samples[(count * 90u) / 100u];
+        const double p99 = m_samples[(count * 99u) / 100u];
+        const double ops = ((mean > 0.) ? (1000000000. / mean) : 0.);
+
+        printf("%-22s %-14s %6u %6u %10.2f %10.2f %10.2f %10.2f %14.0f\n",
+               m_container, m_operation, static_cast<unsigned int>(m_item_size), static_cast<unsigned int>(m_capacity),
+               mean, p50, p90, p99, ops);
+    }
+}
+
+/** \brief Print the statistics with the throughput corresponding to the given number of bytes per operation */
+void BenchStats::reportThroughput(const uint32_t bytes_per_op)
+{
+    const nano_stl_size_t count = m_samples.getCount();
+    if (count != 0u)
+    {
+        const double mean = sortSamples();
+        const double p50 = m_samples[(count * 50u) / 100u];
+        const double p99 = m_samples[(count * 99u) / 100u];
+        const double mbytes_per_s = ((mean > 0.) ? ((static_cast<double>(bytes_per_op) * 1000.) / mean) : 0.);
+
+        printf("%-22s %-14s %6u %6u %10.2f %10.2f %10.2f %14.1f\n",
+               m_container, m_operation, static_cast<unsigned int>(m_item_size), static_cast<unsigned int>(m_capacity),
+               mean, p50, p99, mbytes_per_s);
+    }
+}
+
+/** \brief Sort the samples and compute their mean value */
+double BenchStats::sortSamples()
+{
+    const nano_stl_size_t count = m_samples.getCount();
+    double* const samples = &m_samples[0u];
+    double mean = 0.;
+
+    for (nano_stl_size_t i = 0u; i < count; i++)
+    {
+        mean += samples[i];
+    }
+    mean /= static_cast<double>(count);
+    std::sort(samples, samples + count);
+
+    return mean;
+}
@@ -0,0 +1,187 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BENCHTOOLS_H
+#define BENCHTOOLS_H
+
+#include "nano-stl.h"
+
+
+/** \brief Number of timed samples per benchmark */
+#define BENCH_SAMPLE_COUNT          200u
+
+/** \brief Minimum number of timed samples per benchmark */
+#define BENCH_MIN_SAMPLE_COUNT      20u
+
+/** \brief Time budget of a benchmark in nanoseconds (sampling stops when exhausted) */
+#define BENCH_TIME_BUDGET_NS        500000000u
+
+/** \brief Minimum number of operations performed in a single sample */
+#define BENCH_MIN_OPS_PER_SAMPLE    4096u
+
+
+/** \brief Get a monotonic timestamp in nanoseconds */
+uint64_t BENCH_Now();
+
+/** \brief Measure the overhead of a start/stop timing pair */
+void BENCH_Calibrate();
+
+/** \brief Check if a benchmark name matches the filter given on the command line */
+bool BENCH_IsSelected(const char* name);
+
+/** \brief Set the benchmark name filter (nullptr = run all benchmarks) */
+void BENCH_SetFilter(const char* filter);
+
+/** \brief Print the header of the results table */
+void BENCH_PrintHeader(const char* title);
+
+/** \brief Print the header of the throughput results table */
+void BENCH_PrintThroughputHeader(const char* title);
+
+
+/** \brief Fixed size benchmark item */
+template <nano_stl::nano_stl_size_t SIZE>
+struct BenchItem
+{
+    /** \brief Payload */
+    uint8_t data[SIZE];
+
+    /** \brief Constructor */
+    BenchItem() { data[0u] = 0u; }
+
+    /** \brief Constructor */
+    BenchItem(const uint32_t seed) { data[0u] = static_cast<uint8_t>(seed); data[SIZE - 1u] = static_cast<uint8_t>(seed >> 8u); }
+
+    /** \brief Comparison operator */
+    bool operator == (const BenchItem<SIZE>& item) const { return (NANO_STL_MEMCMP(data, item.data, SIZE) == 0); }
+};
+
+
+/** \brief Pseudo random number generator (xorshift32) used to build reproducible operation traces */
+class BenchRandom
+{
+    public:
+
+        /** \brief Constructor */
+        BenchRandom(const uint32_t seed = 0x9E3779B9u) : m_state(seed) {}
+
+        /** \brief Get the next random number */
+        uint32_t next()
+        {
+            m_state ^= (m_state << 13u);
+            m_state ^= (m_state >> 17u);
+            m_state ^= (m_state << 5u);
+            return m_state;
+        }
+
+        /** \brief Shuffle an array of keys */
+        void shuffle(uint32_t keys[], const nano_stl::nano_stl_size_t count)
+        {
+            for (nano_stl::nano_stl_size_t i = count - 1u; i > 0u; i--)
+            {
+                const nano_stl::nano_stl_size_t j = next() % (i + 1u);
+                const uint32_t tmp = keys[i];
+                keys[i] = keys[j];
+                keys[j] = tmp;
+            }
+        }
+
+    private:
+
+        /** \brief Generator state */
+        uint32_t m_state;
+};
+
+
+/** \brief Timing statistics of a single benchmarked operation */
+class BenchStats
+{
+    public:
+
+        /** \brief Constructor */
+        BenchStats(const char* container, const char* operation, const nano_stl::nano_stl_size_t item_size, const nano_stl::nano_stl_size_t capacity);
+
+        /** \brief Start timing a chunk of operations */
+        void start() { m_start = BENCH_Now(); }
+
+        /** \brief Stop timing a chunk of operations */
+        void stop() { m_elapsed += (BENCH_Now() - m_start); m_chunk_count++; }
+
+        /** \brief Account for operations performed by the current sample */
+        void addOperations(const uint32_t count) { m_op_count += count; }
+
+        /** \brief Close the current sample */
+        void endSample();
+
+        /** \brief Check if enough samples have been collected */
+        bool isComplete() const;
+
+        /** \brief Print the statistics */
+        void report();
+
+        /** \brief Print the statistics with the throughput corresponding to the given number of bytes per operation */
+        void reportThroughput(const uint32_t bytes_per_op);
+
+    private:
+
+        /** \brief Container name */
+        const char* m_container;
+
+        /** \brief Operation name */
+        const char* m_operation;
+
+        /** \brief Item size in bytes */
+        const nano_stl::nano_stl_size_t m_item_size;
+
+        /** \brief Container capacity */
+        const nano_stl::nano_stl_size_t m_capacity;
+
+        /** \brief Start timestamp of the current chunk */
+        uint64_t m_start;
+
+        /** \brief Time elapsed in the current sample */
+        uint64_t m_elapsed;
+
+        /** \brief Time elapsed in all the samples */
+        uint64_t m_total_elapsed;
+
+        /** \brief Number of operations in the current sample */
+        uint32_t m_op_count;
+
+        /** \brief Number of chunks timed in the current sample */
+        uint32_t m_chunk_count;
+
+        /** \brief Sort the samples and compute their mean value */
+        double sortSamples();
+
+        /** \brief Samples in nanoseconds per operation */
+        nano_stl::StaticVector<double, BENCH_SAMPLE_COUNT> m_samples;
+};
+
+
+/** \brief Number of rounds to perform in a sample for a given container capacity */
+inline uint32_t BENCH_RoundsPerSample(const nano_stl::nano_stl_size_t capacity)
+{
+    return ((capacity >= BENCH_MIN_OPS_PER_SAMPLE) ? 1u : (BENCH_MIN_OPS_PER_SAMPLE / capacity));
+}
+
+/** \brief Sink used to prevent the compiler from optimizing benchmarked operations away */
+extern volatile uint32_t g_bench_sink;
+
+#endif // BENCHTOOLS_H
@@ -0,0 +1,34 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BENCHS_H
+#define BENCHS_H
+
+
+/** \brief Run the containers benchmarks */
+void BENCH_Containers();
+
+/** \brief Run the strings benchmarks */
+void BENCH_Strings();
+
+/** \brief Run the lib C benchmarks */
+void BENCH_Libc();
+
+
+#endif // BENCHS_H
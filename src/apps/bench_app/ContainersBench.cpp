@@ -0,0 +1,701 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchs.h"
+#include "BenchTools.h"
+
+#include <new>
+
+using namespace nano_stl;
+
+
+/** \brief Instanciate a benchmark for all the item sizes and capacities */
+#define BENCH_GRID(bench)                                       \
+    bench<4u, 16u>();   bench<4u, 256u>();   bench<4u, 4096u>();   \
+    bench<32u, 16u>();  bench<32u, 256u>();  bench<32u, 4096u>();  \
+    bench<128u, 16u>(); bench<128u, 256u>(); bench<128u, 4096u>()
+
+
+/** \brief Benchmark of StaticVector pushBack/popBack */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_Vector()
+{
+    typedef BenchItem<ITEM_SIZE> Item;
+    static StaticVector<Item, CAPACITY> vect;
+
+    BenchStats push_stats("StaticVector", "pushBack", ITEM_SIZE, CAPACITY);
+    BenchStats pop_stats("StaticVector", "popBack", ITEM_SIZE, CAPACITY);
+    const uint32_t rounds = BENCH_RoundsPerSample(CAPACITY);
+    const Item item(0x55u);
+    Item popped;
+
+    while (!push_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            push_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                vect.pushBack(item);
+            }
+            push_stats.stop();
+
+            pop_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                vect.popBack(popped);
+            }
+            pop_stats.stop();
+            g_bench_sink += popped.data[0u];
+        }
+        push_stats.addOperations(rounds * CAPACITY);
+        pop_stats.addOperations(rounds * CAPACITY);
+        push_stats.endSample();
+        pop_stats.endSample();
+    }
+
+    push_stats.report();
+    pop_stats.report();
+}
+
+/** \brief Benchmark of StaticList pushFront/insert/remove */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_List()
+{
+    typedef BenchItem<ITEM_SIZE> Item;
+    static StaticList<Item, CAPACITY> list;
+
+    BenchStats push_stats("StaticList", "pushFront", ITEM_SIZE, CAPACITY);
+    BenchStats insert_stats("StaticList", "insert", ITEM_SIZE, CAPACITY);
+    BenchStats remove_stats("StaticList", "remove", ITEM_SIZE, CAPACITY);
+    const uint32_t rounds = BENCH_RoundsPerSample(CAPACITY);
+    const Item item(0x55u);
+    typename StaticList<Item, CAPACITY>::Iterator anchor(list);
+    typename StaticList<Item, CAPACITY>::Iterator it(list);
+
+    while (!push_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            push_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                list.pushFront(item);
+            }
+            push_stats.stop();
+            list.clear();
+
+            // Insert all the items before the first one which has been added
+            list.pushBack(item);
+            list.begin(anchor);
+            insert_stats.start();
+            for (nano_stl_size_t i = 1u; i < CAPACITY; i++)
+            {
+                list.insert(anchor, item);
+            }
+            insert_stats.stop();
+
+            remove_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                list.begin(it);
+                list.remove(it);
+            }
+            remove_stats.stop();
+            g_bench_sink += list.getCount();
+        }
+        push_stats.addOperations(rounds * CAPACITY);
+        insert_stats.addOperations(rounds * (CAPACITY - 1u));
+        remove_stats.addOperations(rounds * CAPACITY);
+        push_stats.endSample();
+        insert_stats.endSample();
+        remove_stats.endSample();
+    }
+
+    push_stats.report();
+    insert_stats.report();
+    remove_stats.report();
+}
+
+/** \brief Build the keys used by the map and binary search tree benchmarks */
+static void BENCH_BuildKeys(uint32_t keys[], uint32_t lookup_keys[], const nano_stl_size_t count, const bool sequential)
+{
+    BenchRandom random;
+    for (nano_stl_size_t i = 0u; i < count; i++)
+    {
+        keys[i] = i * 7u;
+        lookup_keys[i] = i * 7u;
+    }
+    if (!sequential)
+    {
+        random.shuffle(keys, count);
+    }
+    random.shuffle(lookup_keys, count);
+}
+
+/** \brief Benchmark of a map add/get/remove */
+template <typename MapType, nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_MapKeys(MapType& map, const char* name, const bool sequential)
+{
+    typedef BenchItem<ITEM_SIZE> Item;
+    static uint32_t keys[CAPACITY];
+    static uint32_t lookup_keys[CAPACITY];
+
+    BenchStats add_stats(name, "add", ITEM_SIZE, CAPACITY);
+    BenchStats get_stats(name, "get", ITEM_SIZE, CAPACITY);
+    BenchStats remove_stats(name, "remove", ITEM_SIZE, CAPACITY);
+    const uint32_t rounds = BENCH_RoundsPerSample(CAPACITY);
+    const Item item(0x55u);
+    Item value;
+
+    BENCH_BuildKeys(keys, lookup_keys, CAPACITY, sequential);
+    while (!add_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            add_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                map.add(keys[i], item);
+            }
+            add_stats.stop();
+
+            get_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                map.get(lookup_keys[i], value);
+            }
+            get_stats.stop();
+            g_bench_sink += value.data[0u];
+
+            remove_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                map.remove(lookup_keys[i]);
+            }
+            remove_stats.stop();
+        }
+        add_stats.addOperations(rounds * CAPACITY);
+        get_stats.addOperations(rounds * CAPACITY);
+        remove_stats.addOperations(rounds * CAPACITY);
+        add_stats.endSample();
+        get_stats.endSample();
+        remove_stats.endSample();
+    }
+
+    add_stats.report();
+    get_stats.report();
+    remove_stats.report();
+}
+
+/** \brief Benchmark of a map filled from a sorted table : one by one insertion vs bulk assignment */
+template <typename MapType, nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_MapSorted(MapType& map, const char* name)
+{
+    typedef BenchItem<ITEM_SIZE> Item;
+    static uint32_t keys[CAPACITY];
+    static Item items[CAPACITY];
+
+    BenchStats add_stats(name, "add", ITEM_SIZE, CAPACITY);
+    BenchStats assign_stats(name, "assignSorted", ITEM_SIZE, CAPACITY);
+    const uint32_t rounds = BENCH_RoundsPerSample(CAPACITY);
+
+    for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+    {
+        keys[i] = i * 7u;
+        items[i] = Item(i);
+    }
+    while (!add_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            map.clear();
+            add_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                map.add(keys[i], items[i]);
+            }
+            add_stats.stop();
+
+            map.clear();
+            assign_stats.start();
+            map.assignSorted(keys, items, CAPACITY);
+            assign_stats.stop();
+            g_bench_sink += map.getCount();
+        }
+        add_stats.addOperations(rounds * CAPACITY);
+        assign_stats.addOperations(rounds * CAPACITY);
+        add_stats.endSample();
+        assign_stats.endSample();
+    }
+
+    add_stats.report();
+    assign_stats.report();
+}
+
+/** \brief Benchmark of a map item lookup : scan of the map vs reverse index */
+template <nano_stl_size_t CAPACITY>
+static void BENCH_MapContains()
+{
+    static StaticMap<uint32_t, uint32_t, CAPACITY> scan_map;
+    static StaticMap<uint32_t, uint32_t, CAPACITY, Compare<uint32_t>, true> indexed_map;
+    static uint32_t keys[CAPACITY];
+    static uint32_t lookup_items[CAPACITY];
+
+    BenchStats scan_stats("StaticMap(scan)", "contains", 4u, CAPACITY);
+    BenchStats indexed_stats("StaticMap(rindex)", "contains", 4u, CAPACITY);
+    const uint32_t rounds = BENCH_RoundsPerSample(CAPACITY);
+    uint32_t found = 0u;
+
+    BENCH_BuildKeys(keys, lookup_items, CAPACITY, false);
+    for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+    {
+        scan_map.add(keys[i], keys[i] + 1u);
+        indexed_map.add(keys[i], keys[i] + 1u);
+    }
+    while (!scan_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            scan_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                found += (scan_map.contains(lookup_items[i] + 1u) ? 1u : 0u);
+            }
+            scan_stats.stop();
+
+            indexed_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                found += (indexed_map.contains(lookup_items[i] + 1u) ? 1u : 0u);
+            }
+            indexed_stats.stop();
+        }
+        scan_stats.addOperations(rounds * CAPACITY);
+        indexed_stats.addOperations(rounds * CAPACITY);
+        scan_stats.endSample();
+        indexed_stats.endSample();
+    }
+    g_bench_sink += found;
+
+    scan_stats.report();
+    indexed_stats.report();
+}
+
+/** \brief Benchmark of StaticMap with random and sequential keys */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_Map()
+{
+    typedef StaticMap<uint32_t, BenchItem<ITEM_SIZE>, CAPACITY> Map;
+    static Map map;
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticMap(rand)", false);
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticMap(seq)", true);
+    BENCH_MapSorted<Map, ITEM_SIZE, CAPACITY>(map, "StaticMap(sorted)");
+}
+
+/** \brief Benchmark of StaticSlimMap with random and sequential keys */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_SlimMap()
+{
+    typedef StaticSlimMap<uint32_t, BenchItem<ITEM_SIZE>, CAPACITY> Map;
+    static Map map;
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticSlimMap(rand)", false);
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticSlimMap(seq)", true);
+}
+
+/** \brief Benchmark of StaticHashMap with random and sequential keys */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_HashMap()
+{
+    typedef StaticHashMap<uint32_t, BenchItem<ITEM_SIZE>, CAPACITY> Map;
+    static Map map;
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticHashMap(rand)", false);
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticHashMap(seq)", true);
+}
+
+/** \brief Benchmark of StaticFlatMap with random and sequential keys */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_FlatMap()
+{
+    typedef StaticFlatMap<uint32_t, BenchItem<ITEM_SIZE>, CAPACITY> Map;
+    static Map map;
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticFlatMap(rand)", false);
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticFlatMap(seq)", true);
+    BENCH_MapSorted<Map, ITEM_SIZE, CAPACITY>(map, "StaticFlatMap(sorted)");
+}
+
+/** \brief Benchmark of StaticBTree with random and sequential keys */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_BTree()
+{
+    typedef StaticBTree<uint32_t, BenchItem<ITEM_SIZE>, CAPACITY> Map;
+    static Map map;
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticBTree(rand)", false);
+    BENCH_MapKeys<Map, ITEM_SIZE, CAPACITY>(map, "StaticBTree(seq)", true);
+}
+
+/** \brief Benchmark of StaticBSTree add/get/remove */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_BSTreeKeys(const char* name, const bool sequential)
+{
+    typedef BenchItem<ITEM_SIZE> Item;
+    static StaticBSTree<uint32_t, Item, CAPACITY> tree;
+    static uint32_t keys[CAPACITY];
+    static uint32_t lookup_keys[CAPACITY];
+
+    BenchStats add_stats(name, "add", ITEM_SIZE, CAPACITY);
+    BenchStats get_stats(name, "get", ITEM_SIZE, CAPACITY);
+    BenchStats remove_stats(name, "remove", ITEM_SIZE, CAPACITY);
+    const uint32_t rounds = BENCH_RoundsPerSample(CAPACITY);
+    const Item item(0x55u);
+    Item value;
+
+    BENCH_BuildKeys(keys, lookup_keys, CAPACITY, sequential);
+    while (!add_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            add_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                tree.add(keys[i], item);
+            }
+            add_stats.stop();
+
+            get_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                tree.get(lookup_keys[i], value);
+            }
+            get_stats.stop();
+            g_bench_sink += value.data[0u];
+
+            remove_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                tree.remove(lookup_keys[i]);
+            }
+            remove_stats.stop();
+        }
+        add_stats.addOperations(rounds * CAPACITY);
+        get_stats.addOperations(rounds * CAPACITY);
+        remove_stats.addOperations(rounds * CAPACITY);
+        add_stats.endSample();
+        get_stats.endSample();
+        remove_stats.endSample();
+    }
+
+    add_stats.report();
+    get_stats.report();
+    remove_stats.report();
+}
+
+/** \brief Benchmark of StaticBSTree with random and sequential keys */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_BSTree()
+{
+    BENCH_BSTreeKeys<ITEM_SIZE, CAPACITY>("StaticBSTree(rand)", false);
+    BENCH_BSTreeKeys<ITEM_SIZE, CAPACITY>("StaticBSTree(seq)", true);
+}
+
+/** \brief Benchmark of StaticQueue push/pop */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_Queue()
+{
+    typedef BenchItem<ITEM_SIZE> Item;
+    static StaticQueue<Item, CAPACITY> queue;
+
+    BenchStats push_stats("StaticQueue", "push", ITEM_SIZE, CAPACITY);
+    BenchStats pop_stats("StaticQueue", "pop", ITEM_SIZE, CAPACITY);
+    const uint32_t rounds = BENCH_RoundsPerSample(CAPACITY);
+    const Item item(0x55u);
+    Item popped;
+
+    while (!push_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            push_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                queue.push(item);
+            }
+            push_stats.stop();
+
+            pop_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                queue.pop(popped);
+            }
+            pop_stats.stop();
+            g_bench_sink += popped.data[0u];
+        }
+        push_stats.addOperations(rounds * CAPACITY);
+        pop_stats.addOperations(rounds * CAPACITY);
+        push_stats.endSample();
+        pop_stats.endSample();
+    }
+
+    push_stats.report();
+    pop_stats.report();
+}
+
+/** \brief Benchmark of StaticRingBuffer write/read */
+template <nano_stl_size_t ITEM_SIZE, nano_stl_size_t CAPACITY>
+static void BENCH_RingBuffer()
+{
+    typedef BenchItem<ITEM_SIZE> Item;
+    static StaticRingBuffer<Item, CAPACITY> ring_buffer;
+
+    BenchStats write_stats("StaticRingBuffer", "write", ITEM_SIZE, CAPACITY);
+    BenchStats read_stats("StaticRingBuffer", "read", ITEM_SIZE, CAPACITY);
+    const uint32_t rounds = BENCH_RoundsPerSample(CAPACITY);
+    const Item item(0x55u);
+    Item value;
+
+    while (!write_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            write_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                ring_buffer.write(item);
+            }
+            write_stats.stop();
+
+            read_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                ring_buffer.read(value);
+            }
+            read_stats.stop();
+            g_bench_sink += value.data[0u];
+        }
+        write_stats.addOperations(rounds * CAPACITY);
+        read_stats.addOperations(rounds * CAPACITY);
+        write_stats.endSample();
+        read_stats.endSample();
+    }
+
+    write_stats.report();
+    read_stats.report();
+}
+
+/** \brief Benchmark of the construction and of the reset of scratch containers holding few items */
+template <nano_stl_size_t CAPACITY>
+static void BENCH_Reset()
+{
+    typedef StaticList<uint32_t, CAPACITY> List;
+    typedef StaticMap<uint32_t, uint32_t, CAPACITY> Map;
+    static uint64_t list_storage[(sizeof(List) / sizeof(uint64_t)) + 1u];
+    static uint64_t map_storage[(sizeof(Map) / sizeof(uint64_t)) + 1u];
+    static Map map;
+
+    BenchStats list_stats("StaticList", "construct", 4u, CAPACITY);
+    BenchStats map_stats("StaticMap", "construct", 4u, CAPACITY);
+    BenchStats clear_stats("StaticMap", "clear", 4u, CAPACITY);
+    const uint32_t rounds = 256u;
+
+    while (!map_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            list_stats.start();
+            List* const list = new (list_storage) List();
+            list_stats.stop();
+            g_bench_sink += list->getCount();
+
+            map_stats.start();
+            Map* const new_map = new (map_storage) Map();
+            map_stats.stop();
+            g_bench_sink += new_map->getCount();
+
+            for (uint32_t i = 0u; i < 16u; i++)
+            {
+                map.add(round + i, i);
+            }
+            clear_stats.start();
+            map.clear();
+            clear_stats.stop();
+        }
+        list_stats.addOperations(rounds);
+        map_stats.addOperations(rounds);
+        clear_stats.addOperations(rounds);
+        list_stats.endSample();
+        map_stats.endSample();
+        clear_stats.endSample();
+    }
+
+    list_stats.report();
+    map_stats.report();
+    clear_stats.report();
+}
+
+/** \brief Lower bound of a key in a sorted array of keys using a plain binary search (reference of the sorted index benchmark) */
+static nano_stl_size_t BENCH_BinarySearch(const uint32_t keys[], const nano_stl_size_t count, const uint32_t key)
+{
+    nano_stl_size_t first = 0u;
+    nano_stl_size_t length = count;
+    while (length != 0u)
+    {
+        const nano_stl_size_t half = length / 2u;
+        if (keys[first + half] < key)
+        {
+            first += half + 1u;
+            length -= half + 1u;
+        }
+        else
+        {
+            length = half;
+        }
+    }
+    return first;
+}
+
+/** \brief Benchmark of StaticSortedIndex lowerBound against a plain binary search in the sorted keys */
+template <nano_stl_size_t CAPACITY>
+static void BENCH_SortedIndex()
+{
+    static uint32_t keys[CAPACITY];
+    static uint32_t lookup_keys[CAPACITY];
+    static StaticSortedIndex<uint32_t, CAPACITY, SORTED_INDEX_EYTZINGER> eytzinger_index;
+    static StaticSortedIndex<uint32_t, CAPACITY, SORTED_INDEX_VAN_EMDE_BOAS> veb_index;
+
+    BenchStats search_stats("binary search", "lowerBound", 4u, CAPACITY);
+    BenchStats eytzinger_stats("StaticSortedIndex(eyt)", "lowerBound", 4u, CAPACITY);
+    BenchStats veb_stats("StaticSortedIndex(veb)", "lowerBound", 4u, CAPACITY);
+    const uint32_t rounds = BENCH_RoundsPerSample(CAPACITY);
+    nano_stl_size_t sink = 0u;
+
+    BENCH_BuildKeys(keys, lookup_keys, CAPACITY, true);
+    eytzinger_index.build(keys, CAPACITY);
+    veb_index.build(keys, CAPACITY);
+    while (!search_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            search_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                sink += BENCH_BinarySearch(keys, CAPACITY, lookup_keys[i]);
+            }
+            search_stats.stop();
+
+            eytzinger_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                sink += eytzinger_index.lowerBound(lookup_keys[i]);
+            }
+            eytzinger_stats.stop();
+
+            veb_stats.start();
+            for (nano_stl_size_t i = 0u; i < CAPACITY; i++)
+            {
+                sink += veb_index.lowerBound(lookup_keys[i]);
+            }
+            veb_stats.stop();
+        }
+        search_stats.addOperations(rounds * CAPACITY);
+        eytzinger_stats.addOperations(rounds * CAPACITY);
+        veb_stats.addOperations(rounds * CAPACITY);
+        search_stats.endSample();
+        eytzinger_stats.endSample();
+        veb_stats.endSample();
+    }
+    g_bench_sink += sink;
+
+    search_stats.report();
+    eytzinger_stats.report();
+    veb_stats.report();
+}
+
+
+/** \brief Run the containers benchmarks */
+void BENCH_Containers()
+{
+    if (BENCH_IsSelected("StaticVector"))
+    {
+        BENCH_PrintHeader("StaticVector");
+        BENCH_GRID(BENCH_Vector);
+    }
+    if (BENCH_IsSelected("StaticList"))
+    {
+        BENCH_PrintHeader("StaticList");
+        BENCH_GRID(BENCH_List);
+    }
+    if (BENCH_IsSelected("StaticMap"))
+    {
+        BENCH_PrintHeader("StaticMap");
+        BENCH_GRID(BENCH_Map);
+        BENCH_MapContains<16u>();
+        BENCH_MapContains<256u>();
+        BENCH_MapContains<4096u>();
+    }
+    if (BENCH_IsSelected("StaticSlimMap"))
+    {
+        BENCH_PrintHeader("StaticSlimMap");
+        BENCH_GRID(BENCH_SlimMap);
+    }
+    if (BENCH_IsSelected("StaticHashMap"))
+    {
+        BENCH_PrintHeader("StaticHashMap");
+        BENCH_GRID(BENCH_HashMap);
+    }
+    if (BENCH_IsSelected("StaticFlatMap"))
+    {
+        BENCH_PrintHeader("StaticFlatMap");
+        BENCH_GRID(BENCH_FlatMap);
+    }
+    if (BENCH_IsSelected("StaticBTree"))
+    {
+        BENCH_PrintHeader("StaticBTree");
+        BENCH_GRID(BENCH_BTree);
+    }
+    if (BENCH_IsSelected("StaticBSTree"))
+    {
+        BENCH_PrintHeader("StaticBSTree");
+        BENCH_GRID(BENCH_BSTree);
+    }
+    if (BENCH_IsSelected("StaticQueue"))
+    {
+        BENCH_PrintHeader("StaticQueue");
+        BENCH_GRID(BENCH_Queue);
+    }
+    if (BENCH_IsSelected("StaticRingBuffer"))
+    {
+        BENCH_PrintHeader("StaticRingBuffer");
+        BENCH_GRID(BENCH_RingBuffer);
+    }
+    if (BENCH_IsSelected("Reset"))
+    {
+        BENCH_PrintHeader("Reset");
+        BENCH_Reset<256u>();
+        BENCH_Reset<4096u>();
+        BENCH_Reset<65536u>();
+    }
+    if (BENCH_IsSelected("StaticSortedIndex"))
+    {
+        BENCH_PrintHeader("StaticSortedIndex");
+        BENCH_SortedIndex<256u>();
+        BENCH_SortedIndex<4096u>();
+        BENCH_SortedIndex<65536u>();
+        BENCH_SortedIndex<1048576u>();
+    }
+}
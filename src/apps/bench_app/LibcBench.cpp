@@ -0,0 +1,565 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchs.h"
+#include "BenchTools.h"
+#include "nano-stl-libc-simd.h"
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace nano_stl;
+
+
+/** \brief Maximum buffer size of the memory functions benchmarks */
+#define BENCH_LIBC_MAX_SIZE             65536u
+
+/** \brief Number of bytes processed in a single sample */
+#define BENCH_LIBC_BYTES_PER_SAMPLE     65536u
+
+/** \brief Minimum number of calls in a single sample */
+#define BENCH_LIBC_MIN_CALLS            16u
+
+/** \brief Number of formatting calls in a single sample */
+#define BENCH_LIBC_FORMAT_CALLS         1024u
+
+/** \brief Size of the formatting buffer */
+#define BENCH_LIBC_FORMAT_SIZE          128u
+
+/** \brief Number of parsing calls in a single sample (each one on a different string) */
+#define BENCH_LIBC_PARSE_CALLS          1024u
+
+/** \brief Size of the strings of the parsing benchmarks */
+#define BENCH_LIBC_PARSE_SIZE           32u
+
+
+/** \brief Memcpy function */
+typedef void* (*BenchMemcpyFunction)(void* dst, const void* src, size_t size);
+
+/** \brief Memset function */
+typedef void* (*BenchMemsetFunction)(void* dst, int val, size_t size);
+
+/** \brief Memcmp function */
+typedef int (*BenchMemcmpFunction)(const void* s1, const void* s2, size_t size);
+
+/** \brief Strnlen function */
+typedef size_t (*BenchStrnlenFunction)(const char* s, size_t maxlen);
+
+/** \brief Strncmp function */
+typedef int (*BenchStrncmpFunction)(const char* s1, const char* s2, size_t size);
+
+/** \brief Snprintf function */
+typedef int (*BenchSnprintfFunction)(char* str, size_t size, const char* format, ...);
+
+
+/** \brief Formats used by the snprintf benchmarks */
+enum BenchFormat
+{
+    BENCH_FORMAT_UINT,
+    BENCH_FORMAT_INT,
+    BENCH_FORMAT_HEXA,
+    BENCH_FORMAT_UINT64,
+    BENCH_FORMAT_POINTER,
+    BENCH_FORMAT_STRING,
+    BENCH_FORMAT_FIXED,
+    BENCH_FORMAT_EXPONENT,
+    BENCH_FORMAT_GENERAL,
+    BENCH_FORMAT_MIXED,
+    BENCH_FORMAT_COUNT
+};
+
+/** \brief Names of the formats used by the snprintf benchmarks */
+static const char* const s_format_names[BENCH_FORMAT_COUNT] = { "%u", "%d", "%08x", "%llu", "%p", "%s", "%.2f", "%e", "%g", "t=%d id=%08x %s n=%llu" };
+
+/** \brief Numbers used by the parsing benchmarks */
+enum BenchNumber
+{
+    BENCH_NUMBER_INT,
+    BENCH_NUMBER_UINT64,
+    BENCH_NUMBER_FIXED,
+    BENCH_NUMBER_EXPONENT,
+    BENCH_NUMBER_ROUND_TRIP,
+    BENCH_NUMBER_COUNT
+};
+
+/** \brief Names of the numbers used by the parsing benchmarks */
+static const char* const s_number_names[BENCH_NUMBER_COUNT] = { "int", "uint64", "fixed %.2f", "exponent %e", "round trip %.17g" };
+
+/** \brief Strings of the parsing benchmarks */
+static char s_numbers[BENCH_LIBC_PARSE_CALLS][BENCH_LIBC_PARSE_SIZE];
+
+
+/** \brief Source buffer */
+static uint8_t s_src_buffer[BENCH_LIBC_MAX_SIZE + 16u] __attribute__((aligned(64)));
+
+/** \brief Destination buffer */
+static uint8_t s_dst_buffer[BENCH_LIBC_MAX_SIZE + 16u] __attribute__((aligned(64)));
+
+
+
+// Byte by byte reference implementations, identical to the original portable Nano-STL lib C
+// functions, compiled without loop to libc call conversion nor vectorization
+#pragma GCC push_options
+#pragma GCC optimize ("no-tree-loop-distribute-patterns", "no-tree-vectorize")
+
+/** \brief Byte by byte memcpy */
+static void* BENCH_ByteMemcpy(void* dst, const void* src, size_t size)
+{
+    const uint8_t* u8_src = static_cast<const uint8_t*>(src);
+    uint8_t* u8_dst = static_cast<uint8_t*>(dst);
+    while (size != 0u)
+    {
+        (*u8_dst) = (*u8_src);
+        u8_src++;
+        u8_dst++;
+        size--;
+    }
+    return dst;
+}
+
+/** \brief Byte by byte memset */
+static void* BENCH_ByteMemset(void* dst, int val, size_t size)
+{
+    const uint8_t u8_val = static_cast<uint8_t>(val);
+    uint8_t* u8_dst = static_cast<uint8_t*>(dst);
+    while (size != 0u)
+    {
+        (*u8_dst) = u8_val;
+        u8_dst++;
+        size--;
+    }
+    return dst;
+}
+
+/** \brief Byte by byte memcmp */
+static int BENCH_ByteMemcmp(const void* s1, const void* s2, size_t size)
+{
+    int ret = 0;
+    const uint8_t* u8_s1 = static_cast<const uint8_t*>(s1);
+    const uint8_t* u8_s2 = static_cast<const uint8_t*>(s2);
+    while ((size != 0u) && (ret == 0))
+    {
+        if ((*u8_s1) > (*u8_s2))
+        {
+            ret = 1;
+        }
+        else if ((*u8_s1) < (*u8_s2))
+        {
+            ret = -1;
+        }
+        else
+        {
+            u8_s1++;
+            u8_s2++;
+            size--;
+        }
+    }
+    return ret;
+}
+
+/** \brief Char by char strnlen */
+static size_t BENCH_ByteStrnlen(const char* s, size_t maxlen)
+{
+    size_t size = 0;
+    while (((*s) != 0) && (size != maxlen))
+    {
+        s++;
+        size++;
+    }
+    return size;
+}
+
+/** \brief Char by char strncmp */
+static int BENCH_ByteStrncmp(const char* s1, const char* s2, size_t size)
+{
+    int ret = 0;
+    while ((size != 0u) && (ret == 0))
+    {
+        if ((*s1) > (*s2))
+        {
+            ret = 1;
+        }
+        else if ((*s1) < (*s2))
+        {
+            ret = -1;
+        }
+        else if ((*s1) == 0)
+        {
+            size = 0;
+        }
+        else
+        {
+            s1++;
+            s2++;
+            size--;
+        }
+    }
+    return ret;
+}
+
+#pragma GCC pop_options
+
+
+/** \brief Number of calls to perform in a sample for a given buffer size */
+static uint32_t BENCH_LibcCallsPerSample(const uint32_t size)
+{
+    const uint32_t calls = BENCH_LIBC_BYTES_PER_SAMPLE / size;
+    return ((calls < BENCH_LIBC_MIN_CALLS) ? BENCH_LIBC_MIN_CALLS : calls);
+}
+
+/** \brief Benchmark of a memcpy implementation */
+static void BENCH_Memcpy(const char* name, BenchMemcpyFunction memcpy_function, const uint32_t size, const uint32_t src_offset)
+{
+    BenchStats stats("Memcpy", name, size, src_offset);
+    const uint32_t calls = BENCH_LibcCallsPerSample(size);
+
+    while (!stats.isComplete())
+    {
+        stats.start();
+        for (uint32_t i = 0u; i < calls; i++)
+        {
+            memcpy_function(s_dst_buffer, &s_src_buffer[src_offset], size);
+        }
+        stats.stop();
+        g_bench_sink += s_dst_buffer[size - 1u];
+
+        stats.addOperations(calls);
+        stats.endSample();
+    }
+
+    stats.reportThroughput(size);
+}
+
+/** \brief Benchmark of a memset implementation */
+static void BENCH_Memset(const char* name, BenchMemsetFunction memset_function, const uint32_t size)
+{
+    BenchStats stats("Memset", name, size, 0u);
+    const uint32_t calls = BENCH_LibcCallsPerSample(size);
+
+    while (!stats.isComplete())
+    {
+        stats.start();
+        for (uint32_t i = 0u; i < calls; i++)
+        {
+            memset_function(s_dst_buffer, static_cast<int>(i), size);
+        }
+        stats.stop();
+        g_bench_sink += s_dst_buffer[size - 1u];
+
+        stats.addOperations(calls);
+        stats.endSample();
+    }
+
+    stats.reportThroughput(size);
+}
+
+/** \brief Benchmark of a memcmp implementation on equal buffers */
+static void BENCH_Memcmp(const char* name, BenchMemcmpFunction memcmp_function, const uint32_t size, const uint32_t offset)
+{
+    BenchStats stats("Memcmp", name, size, offset);
+    const uint32_t calls = BENCH_LibcCallsPerSample(size);
+
+    memcpy(s_dst_buffer, &s_src_buffer[offset], size);
+    while (!stats.isComplete())
+    {
+        int ret = 0;
+        stats.start();
+        for (uint32_t i = 0u; i < calls; i++)
+        {
+            ret += memcmp_function(s_dst_buffer, &s_src_buffer[offset], size);
+        }
+        stats.stop();
+        g_bench_sink += static_cast<uint32_t>(ret);
+
+        stats.addOperations(calls);
+        stats.endSample();
+    }
+
+    stats.reportThroughput(size);
+}
+
+/** \brief Benchmark of a strnlen implementation on a string of the given length */
+static void BENCH_Strnlen(const char* name, BenchStrnlenFunction strnlen_function, const uint32_t size, const uint32_t offset)
+{
+    BenchStats stats("Strnlen", name, size, offset);
+    const uint32_t calls = BENCH_LibcCallsPerSample(size);
+    const char* const str = reinterpret_cast<const char*>(&s_dst_buffer[offset]);
+
+    memset(s_dst_buffer, 'a', sizeof(s_dst_buffer));
+    s_dst_buffer[offset + size] = 0u;
+    while (!stats.isComplete())
+    {
+        size_t len = 0u;
+        stats.start();
+        for (uint32_t i = 0u; i < calls; i++)
+        {
+            len += strnlen_function(str, 0xFFFFFFFFu);
+        }
+        stats.stop();
+        g_bench_sink += static_cast<uint32_t>(len);
+
+        stats.addOperations(calls);
+        stats.endSample();
+    }
+
+    stats.reportThroughput(size);
+}
+
+/** \brief Benchmark of a strncmp implementation on equal strings of the given length */
+static void BENCH_Strncmp(const char* name, BenchStrncmpFunction strncmp_function, const uint32_t size, const uint32_t offset)
+{
+    BenchStats stats("Strncmp", name, size, offset);
+    const uint32_t calls = BENCH_LibcCallsPerSample(size);
+    const char* const s1 = reinterpret_cast<const char*>(s_dst_buffer);
+    const char* const s2 = reinterpret_cast<const char*>(&s_src_buffer[offset]);
+
+    memset(s_dst_buffer, 'a', sizeof(s_dst_buffer));
+    memset(s_src_buffer, 'a', sizeof(s_src_buffer));
+    s_dst_buffer[size] = 0u;
+    s_src_buffer[offset + size] = 0u;
+    while (!stats.isComplete())
+    {
+        int ret = 0;
+        stats.start();
+        for (uint32_t i = 0u; i < calls; i++)
+        {
+            ret += strncmp_function(s1, s2, BENCH_LIBC_MAX_SIZE);
+        }
+        stats.stop();
+        g_bench_sink += static_cast<uint32_t>(ret);
+
+        stats.addOperations(calls);
+        stats.endSample();
+    }
+
+    stats.reportThroughput(size);
+}
+
+/** \brief Format a string with one of the snprintf benchmark formats */
+static int BENCH_Format(BenchSnprintfFunction snprintf_function, char* str, const BenchFormat format, const uint32_t i)
+{
+    static const char label[] = "temperature_sensor_0123456789abc";
+    const unsigned long long counter = 0x0123456789ABCDEFull + i;
+    const double measure = 21.5 + (static_cast<double>(i) * 0.037);
+    int len;
+
+    switch (format)
+    {
+        case BENCH_FORMAT_UINT: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "%u", 1000000u + i); break;
+        case BENCH_FORMAT_INT: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "%d", -273 - static_cast<int>(i)); break;
+        case BENCH_FORMAT_HEXA: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "%08x", 0xDEAD0000u + i); break;
+        case BENCH_FORMAT_UINT64: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "%llu", counter); break;
+        case BENCH_FORMAT_POINTER: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "%p", static_cast<const void*>(&label[i & 0x0Fu])); break;
+        case BENCH_FORMAT_STRING: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "%s", &label[i & 0x0Fu]); break;
+        case BENCH_FORMAT_FIXED: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "%.2f", measure); break;
+        case BENCH_FORMAT_EXPONENT: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "%e", measure * 1e-9); break;
+        case BENCH_FORMAT_GENERAL: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "%g", measure); break;
+        default: len = snprintf_function(str, BENCH_LIBC_FORMAT_SIZE, "t=%d id=%08x %s n=%llu", 
+                                         -273 + static_cast<int>(i & 0xFFu), 0xDEAD0000u + i, "sensor", counter); break;
+    }
+
+    return len;
+}
+
+/** \brief Benchmark of a snprintf implementation */
+static void BENCH_Snprintf(const char* name, BenchSnprintfFunction snprintf_function, const BenchFormat format)
+{
+    static char str[BENCH_LIBC_FORMAT_SIZE];
+    int len = BENCH_Format(snprintf_function, str, format, 0u);
+
+    BenchStats stats(s_format_names[format], name, static_cast<uint32_t>(len), BENCH_LIBC_FORMAT_SIZE);
+    while (!stats.isComplete())
+    {
+        stats.start();
+        for (uint32_t i = 0u; i < BENCH_LIBC_FORMAT_CALLS; i++)
+        {
+            len += BENCH_Format(snprintf_function, str, format, i);
+        }
+        stats.stop();
+        g_bench_sink += static_cast<uint32_t>(len);
+
+        stats.addOperations(BENCH_LIBC_FORMAT_CALLS);
+        stats.endSample();
+    }
+
+    stats.report();
+}
+
+
+/** \brief Parse a number with the Nano-STL or the lib C conversion functions */
+static uint32_t BENCH_ParseNumber(const bool nano_stl, const BenchNumber number, const char* str)
+{
+    uint32_t ret;
+
+    switch (number)
+    {
+        case BENCH_NUMBER_INT: ret = static_cast<uint32_t>(nano_stl ? NANO_STL_LIBC_Antoi(str, 10, BENCH_LIBC_PARSE_SIZE) : strtol(str, nullptr, 10)); break;
+        case BENCH_NUMBER_UINT64: ret = static_cast<uint32_t>(nano_stl ? NANO_STL_LIBC_Antoull(str, 10, BENCH_LIBC_PARSE_SIZE) : strtoull(str, nullptr, 10)); break;
+        default: ret = static_cast<uint32_t>(nano_stl ? NANO_STL_LIBC_Antof(str, BENCH_LIBC_PARSE_SIZE, nullptr) : strtod(str, nullptr)); break;
+    }
+
+    return ret;
+}
+
+/** \brief Benchmark of a number parsing implementation */
+static void BENCH_Parse(const char* name, const bool nano_stl, const BenchNumber number)
+{
+    for (uint32_t i = 0u; i < BENCH_LIBC_PARSE_CALLS; i++)
+    {
+        const double measure = 21.5 + (static_cast<double>(i) * 0.037);
+        switch (number)
+        {
+            case BENCH_NUMBER_INT: snprintf(s_numbers[i], BENCH_LIBC_PARSE_SIZE, "%d", -273 - static_cast<int>(i * 977u)); break;
+            case BENCH_NUMBER_UINT64: snprintf(s_numbers[i], BENCH_LIBC_PARSE_SIZE, "%llu", 0x0123456789ABCDEFull * (i + 1u)); break;
+            case BENCH_NUMBER_FIXED: snprintf(s_numbers[i], BENCH_LIBC_PARSE_SIZE, "%.2f", measure); break;
+            case BENCH_NUMBER_EXPONENT: snprintf(s_numbers[i], BENCH_LIBC_PARSE_SIZE, "%e", measure * 1e-9); break;
+            default: snprintf(s_numbers[i], BENCH_LIBC_PARSE_SIZE, "%.17g", measure / 3.); break;
+        }
+    }
+
+    BenchStats stats(s_number_names[number], name, static_cast<uint32_t>(strlen(s_numbers[0u])), BENCH_LIBC_PARSE_SIZE);
+    while (!stats.isComplete())
+    {
+        uint32_t sum = 0u;
+        stats.start();
+        for (uint32_t i = 0u; i < BENCH_LIBC_PARSE_CALLS; i++)
+        {
+            sum += BENCH_ParseNumber(nano_stl, number, s_numbers[i]);
+        }
+        stats.stop();
+        g_bench_sink += sum;
+
+        stats.addOperations(BENCH_LIBC_PARSE_CALLS);
+        stats.endSample();
+    }
+
+    stats.report();
+}
+
+
+/** \brief Run the lib C benchmarks */
+void BENCH_Libc()
+{
+    for (uint32_t i = 0u; i < sizeof(s_src_buffer); i++)
+    {
+        s_src_buffer[i] = static_cast<uint8_t>(i * 13u);
+    }
+
+// Check if the SIMD backend is available
+#if (NANO_STL_LIBC_SIMD_BACKEND == 1)
+    printf("\nNano-STL lib C instruction set : %s\n", NANO_STL_LIBC_SIMD_GetInstructionSet());
+#endif // NANO_STL_LIBC_SIMD_BACKEND
+
+    if (BENCH_IsSelected("Memcpy"))
+    {
+        BENCH_PrintThroughputHeader("Memcpy");
+        for (uint32_t size = 1u; size <= BENCH_LIBC_MAX_SIZE; size *= 2u)
+        {
+            for (uint32_t src_offset = 0u; src_offset <= 1u; src_offset++)
+            {
+                BENCH_Memcpy("byte loop", BENCH_ByteMemcpy, size, src_offset);
+#if (NANO_STL_LIBC_SIMD_BACKEND == 1)
+                BENCH_Memcpy("portable", NANO_STL_LIBC_PortableMemcpy, size, src_offset);
+#endif // NANO_STL_LIBC_SIMD_BACKEND
+                BENCH_Memcpy("nano-stl", NANO_STL_LIBC_Memcpy, size, src_offset);
+                BENCH_Memcpy("libc", memcpy, size, src_offset);
+            }
+        }
+    }
+    if (BENCH_IsSelected("Memset"))
+    {
+        BENCH_PrintThroughputHeader("Memset");
+        for (uint32_t size = 1u; size <= BENCH_LIBC_MAX_SIZE; size *= 2u)
+        {
+            BENCH_Memset("byte loop", BENCH_ByteMemset, size);
+#if (NANO_STL_LIBC_SIMD_BACKEND == 1)
+            BENCH_Memset("portable", NANO_STL_LIBC_PortableMemset, size);
+#endif // NANO_STL_LIBC_SIMD_BACKEND
+            BENCH_Memset("nano-stl", NANO_STL_LIBC_Memset, size);
+            BENCH_Memset("libc", memset, size);
+        }
+    }
+    if (BENCH_IsSelected("Memcmp"))
+    {
+        BENCH_PrintThroughputHeader("Memcmp");
+        for (uint32_t size = 1u; size <= BENCH_LIBC_MAX_SIZE; size *= 2u)
+        {
+            for (uint32_t offset = 0u; offset <= 1u; offset++)
+            {
+                BENCH_Memcmp("byte loop", BENCH_ByteMemcmp, size, offset);
+#if (NANO_STL_LIBC_SIMD_BACKEND == 1)
+                BENCH_Memcmp("portable", NANO_STL_LIBC_PortableMemcmp, size, offset);
+#endif // NANO_STL_LIBC_SIMD_BACKEND
+                BENCH_Memcmp("nano-stl", NANO_STL_LIBC_Memcmp, size, offset);
+                BENCH_Memcmp("libc", memcmp, size, offset);
+            }
+        }
+    }
+    if (BENCH_IsSelected("Strnlen"))
+    {
+        BENCH_PrintThroughputHeader("Strnlen");
+        for (uint32_t size = 1u; size <= BENCH_LIBC_MAX_SIZE; size *= 2u)
+        {
+            for (uint32_t offset = 0u; offset <= 1u; offset++)
+            {
+                BENCH_Strnlen("byte loop", BENCH_ByteStrnlen, size, offset);
+#if (NANO_STL_LIBC_SIMD_BACKEND == 1)
+                BENCH_Strnlen("portable", NANO_STL_LIBC_PortableStrnlen, size, offset);
+#endif // NANO_STL_LIBC_SIMD_BACKEND
+                BENCH_Strnlen("nano-stl", NANO_STL_LIBC_Strnlen, size, offset);
+                BENCH_Strnlen("libc", strnlen, size, offset);
+            }
+        }
+    }
+    if (BENCH_IsSelected("Strncmp"))
+    {
+        BENCH_PrintThroughputHeader("Strncmp");
+        for (uint32_t size = 1u; size <= BENCH_LIBC_MAX_SIZE; size *= 2u)
+        {
+            for (uint32_t offset = 0u; offset <= 1u; offset++)
+            {
+                BENCH_Strncmp("byte loop", BENCH_ByteStrncmp, size, offset);
+#if (NANO_STL_LIBC_SIMD_BACKEND == 1)
+                BENCH_Strncmp("portable", NANO_STL_LIBC_PortableStrncmp, size, offset);
+#endif // NANO_STL_LIBC_SIMD_BACKEND
+                BENCH_Strncmp("nano-stl", NANO_STL_LIBC_Strncmp, size, offset);
+                BENCH_Strncmp("libc", strncmp, size, offset);
+            }
+        }
+    }
+    if (BENCH_IsSelected("Snprintf"))
+    {
+        BENCH_PrintHeader("Snprintf");
+        for (uint32_t format = 0u; format < BENCH_FORMAT_COUNT; format++)
+        {
+            BENCH_Snprintf("nano-stl", NANO_STL_LIBC_Snprintf, static_cast<BenchFormat>(format));
+            BENCH_Snprintf("libc", snprintf, static_cast<BenchFormat>(format));
+        }
+    }
+    if (BENCH_IsSelected("Parse"))
+    {
+        BENCH_PrintHeader("Parse");
+        for (uint32_t number = 0u; number < BENCH_NUMBER_COUNT; number++)
+        {
+            BENCH_Parse("nano-stl", true, static_cast<BenchNumber>(number));
+            BENCH_Parse("libc", false, static_cast<BenchNumber>(number));
+        }
+    }
+}
@@ -0,0 +1,160 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Benchs.h"
+#include "BenchTools.h"
+
+using namespace nano_stl;
+
+
+/** \brief Number of string operations per sample */
+#define BENCH_STRING_OPS_PER_SAMPLE     1024u
+
+
+/** \brief Benchmark of StaticString format */
+template <nano_stl_size_t MAX_CHAR_COUNT>
+static void BENCH_StringFormat()
+{
+    static StaticString<MAX_CHAR_COUNT> str;
+
+    BenchStats int_stats("StaticString", "format(int)", 1u, MAX_CHAR_COUNT);
+    BenchStats mixed_stats("StaticString", "format(mixed)", 1u, MAX_CHAR_COUNT);
+    BenchStats compiled_int_stats("StaticString", "cformat(int)", 1u, MAX_CHAR_COUNT);
+    BenchStats compiled_mixed_stats("StaticString", "cformat(mixed)", 1u, MAX_CHAR_COUNT);
+
+    while (!int_stats.isComplete())
+    {
+        int_stats.start();
+        for (uint32_t i = 0u; i < BENCH_STRING_OPS_PER_SAMPLE; i++)
+        {
+            str.format("%u", 1000000u + i);
+        }
+        int_stats.stop();
+        g_bench_sink += str.getLenght();
+
+        mixed_stats.start();
+        for (uint32_t i = 0u; i < BENCH_STRING_OPS_PER_SAMPLE; i++)
+        {
+            str.format("t=%d id=%08x %s", -273 + static_cast<int>(i & 0xFFu), 0xDEAD0000u + i, "sensor");
+        }
+        mixed_stats.stop();
+        g_bench_sink += str.getLenght();
+
+        compiled_int_stats.start();
+        for (uint32_t i = 0u; i < BENCH_STRING_OPS_PER_SAMPLE; i++)
+        {
+            str.format(NANO_STL_FORMAT("%u"), 1000000u + i);
+        }
+        compiled_int_stats.stop();
+        g_bench_sink += str.getLenght();
+
+        compiled_mixed_stats.start();
+        for (uint32_t i = 0u; i < BENCH_STRING_OPS_PER_SAMPLE; i++)
+        {
+            str.format(NANO_STL_FORMAT("t=%d id=%08x %s"), -273 + static_cast<int>(i & 0xFFu), 0xDEAD0000u + i, "sensor");
+        }
+        compiled_mixed_stats.stop();
+        g_bench_sink += str.getLenght();
+
+        int_stats.addOperations(BENCH_STRING_OPS_PER_SAMPLE);
+        mixed_stats.addOperations(BENCH_STRING_OPS_PER_SAMPLE);
+        compiled_int_stats.addOperations(BENCH_STRING_OPS_PER_SAMPLE);
+        compiled_mixed_stats.addOperations(BENCH_STRING_OPS_PER_SAMPLE);
+        int_stats.endSample();
+        mixed_stats.endSample();
+        compiled_int_stats.endSample();
+        compiled_mixed_stats.endSample();
+    }
+
+    int_stats.report();
+    mixed_stats.report();
+    compiled_int_stats.report();
+    compiled_mixed_stats.report();
+}
+
+/** \brief Benchmark of StaticString concatenation */
+template <nano_stl_size_t MAX_CHAR_COUNT, nano_stl_size_t PIECE_SIZE>
+static void BENCH_StringConcat()
+{
+    static StaticString<MAX_CHAR_COUNT> str;
+    static StaticString<MAX_CHAR_COUNT> empty;
+    static StaticString<MAX_CHAR_COUNT> piece;
+    static char piece_str[PIECE_SIZE + 1u];
+
+    NANO_STL_MEMSET(piece_str, 'a', PIECE_SIZE);
+    piece_str[PIECE_SIZE] = 0;
+    piece = StaticString<MAX_CHAR_COUNT>(piece_str);
+
+    BenchStats concat_stats("StaticString", "concat", PIECE_SIZE, MAX_CHAR_COUNT);
+    BenchStats copy_stats("StaticString", "copy", PIECE_SIZE, MAX_CHAR_COUNT);
+    const uint32_t pieces = MAX_CHAR_COUNT / PIECE_SIZE;
+    const uint32_t rounds = BENCH_STRING_OPS_PER_SAMPLE / pieces;
+
+    while (!concat_stats.isComplete())
+    {
+        for (uint32_t round = 0u; round < rounds; round++)
+        {
+            // Fill the string with pieces
+            str = empty;
+            concat_stats.start();
+            for (uint32_t i = 0u; i < pieces; i++)
+            {
+                str + piece;
+            }
+            concat_stats.stop();
+            g_bench_sink += str.getLenght();
+        }
+
+        copy_stats.start();
+        for (uint32_t i = 0u; i < BENCH_STRING_OPS_PER_SAMPLE; i++)
+        {
+            str = piece;
+        }
+        copy_stats.stop();
+        g_bench_sink += str.getLenght();
+
+        concat_stats.addOperations(rounds * pieces);
+        copy_stats.addOperations(BENCH_STRING_OPS_PER_SAMPLE);
+        concat_stats.endSample();
+        copy_stats.endSample();
+    }
+
+    concat_stats.report();
+    copy_stats.report();
+}
+
+
+/** \brief Run the strings benchmarks */
+void BENCH_Strings()
+{
+    if (BENCH_IsSelected("StaticString"))
+    {
+        BENCH_PrintHeader("StaticString");
+
+        BENCH_StringFormat<32u>();
+        BENCH_StringFormat<128u>();
+        BENCH_StringFormat<512u>();
+
+        BENCH_StringConcat<32u, 8u>();
+        BENCH_StringConcat<128u, 8u>();
+        BENCH_StringConcat<128u, 32u>();
+        BENCH_StringConcat<512u, 32u>();
+        BENCH_StringConcat<512u, 128u>();
+    }
+}
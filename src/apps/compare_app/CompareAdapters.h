@@ -0,0 +1,439 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMPAREADAPTERS_H
+#define COMPAREADAPTERS_H
+
+#include "nano-stl.h"
+
+#include <vector>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <deque>
+
+
+/** \brief Base class of the container adapters : the operations which are not supported by a container always fail
+ *         (the adapters are used through templates, the derived classes hide the supported operations)
+*/
+class CompareAdapter
+{
+    public:
+
+        /** \brief Add an item at the end */
+        bool pushBack(const uint32_t) { return false; }
+
+        /** \brief Add an item at the start */
+        bool pushFront(const uint32_t) { return false; }
+
+        /** \brief Remove the item at the end */
+        bool popBack(uint32_t&) { return false; }
+
+        /** \brief Remove the item at the start */
+        bool popFront(uint32_t&) { return false; }
+
+        /** \brief Read the item at an index */
+        bool read(const uint32_t, uint32_t&) const { return false; }
+
+        /** \brief Write the item at an index */
+        bool write(const uint32_t, const uint32_t) { return false; }
+
+        /** \brief Add an item with a key */
+        bool add(const uint32_t, const uint32_t) { return false; }
+
+        /** \brief Get the item with a key */
+        bool get(const uint32_t, uint32_t&) const { return false; }
+
+        /** \brief Remove the item with a key */
+        bool remove(const uint32_t) { return false; }
+};
+
+
+/** \brief Adapter for the StaticVector container */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class NanoVectorAdapter : public CompareAdapter
+{
+    public:
+
+        bool pushBack(const uint32_t value) { return m_vector.pushBack(value); }
+        bool popBack(uint32_t& value) { return m_vector.popBack(value); }
+        bool read(const uint32_t index, uint32_t& value) const
+        {
+            const bool ret = (index < m_vector.getCount());
+            if (ret)
+            {
+                value = m_vector[index];
+            }
+            return ret;
+        }
+        bool write(const uint32_t index, const uint32_t value)
+        {
+            const bool ret = (index < m_vector.getCount());
+            if (ret)
+            {
+                m_vector[index] = value;
+            }
+            return ret;
+        }
+        void clear() { m_vector.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        nano_stl::StaticVector<uint32_t, CAPACITY> m_vector;
+};
+
+/** \brief Adapter for the std::vector container with a fixed capacity */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class StdVectorAdapter : public CompareAdapter
+{
+    public:
+
+        StdVectorAdapter() : m_vector() { m_vector.reserve(CAPACITY); }
+
+        bool pushBack(const uint32_t value)
+        {
+            const bool ret = (m_vector.size() < CAPACITY);
+            if (ret)
+            {
+                m_vector.push_back(value);
+            }
+            return ret;
+        }
+        bool popBack(uint32_t& value)
+        {
+            const bool ret = !m_vector.empty();
+            if (ret)
+            {
+                value = m_vector.back();
+                m_vector.pop_back();
+            }
+            return ret;
+        }
+        bool read(const uint32_t index, uint32_t& value) const
+        {
+            const bool ret = (index < m_vector.size());
+            if (ret)
+            {
+                value = m_vector[index];
+            }
+            return ret;
+        }
+        bool write(const uint32_t index, const uint32_t value)
+        {
+            const bool ret = (index < m_vector.size());
+            if (ret)
+            {
+                m_vector[index] = value;
+            }
+            return ret;
+        }
+        void clear() { m_vector.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        std::vector<uint32_t> m_vector;
+};
+
+
+/** \brief Adapter for the StaticList container */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class NanoListAdapter : public CompareAdapter
+{
+    public:
+
+        bool pushBack(const uint32_t value) { return m_list.pushBack(value); }
+        bool pushFront(const uint32_t value) { return m_list.pushFront(value); }
+        bool popBack(uint32_t& value) { return m_list.popBack(value); }
+        bool popFront(uint32_t& value) { return m_list.popFront(value); }
+        void clear() { m_list.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        nano_stl::StaticList<uint32_t, CAPACITY> m_list;
+};
+
+/** \brief Adapter for the std::list container with a fixed capacity */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class StdListAdapter : public CompareAdapter
+{
+    public:
+
+        bool pushBack(const uint32_t value)
+        {
+            const bool ret = (m_list.size() < CAPACITY);
+            if (ret)
+            {
+                m_list.push_back(value);
+            }
+            return ret;
+        }
+        bool pushFront(const uint32_t value)
+        {
+            const bool ret = (m_list.size() < CAPACITY);
+            if (ret)
+            {
+                m_list.push_front(value);
+            }
+            return ret;
+        }
+        bool popBack(uint32_t& value)
+        {
+            const bool ret = !m_list.empty();
+            if (ret)
+            {
+                value = m_list.back();
+                m_list.pop_back();
+            }
+            return ret;
+        }
+        bool popFront(uint32_t& value)
+        {
+            const bool ret = !m_list.empty();
+            if (ret)
+            {
+                value = m_list.front();
+                m_list.pop_front();
+            }
+            return ret;
+        }
+        void clear() { m_list.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        std::list<uint32_t> m_list;
+};
+
+
+/** \brief Adapter for the StaticMap container */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class NanoMapAdapter : public CompareAdapter
+{
+    public:
+
+        bool add(const uint32_t key, const uint32_t value) { return m_map.add(key, value); }
+        bool get(const uint32_t key, uint32_t& value) const { return m_map.get(key, value); }
+        bool remove(const uint32_t key) { return m_map.remove(key); }
+        void clear() { m_map.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        nano_stl::StaticMap<uint32_t, uint32_t, CAPACITY> m_map;
+};
+
+/** \brief Adapter for the std::map container with a fixed capacity */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class StdMapAdapter : public CompareAdapter
+{
+    public:
+
+        bool add(const uint32_t key, const uint32_t value)
+        {
+            // Like StaticMap, an existing key is not overwritten
+            bool ret = false;
+            if (m_map.size() < CAPACITY)
+            {
+                ret = m_map.insert(std::make_pair(key, value)).second;
+            }
+            return ret;
+        }
+        bool get(const uint32_t key, uint32_t& value) const
+        {
+            const std::map<uint32_t, uint32_t>::const_iterator it = m_map.find(key);
+            const bool ret = (it != m_map.end());
+            if (ret)
+            {
+                value = it->second;
+            }
+            return ret;
+        }
+        bool remove(const uint32_t key) { return (m_map.erase(key) != 0u); }
+        void clear() { m_map.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        std::map<uint32_t, uint32_t> m_map;
+};
+
+
+/** \brief Adapter for the StaticSlimMap container */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class NanoSlimMapAdapter : public CompareAdapter
+{
+    public:
+
+        bool add(const uint32_t key, const uint32_t value) { return m_map.add(key, value); }
+        bool get(const uint32_t key, uint32_t& value) const { return m_map.get(key, value); }
+        bool remove(const uint32_t key) { return m_map.remove(key); }
+        void clear() { m_map.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        nano_stl::StaticSlimMap<uint32_t, uint32_t, CAPACITY> m_map;
+};
+
+
+/** \brief Adapter for the StaticFlatMap container */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class NanoFlatMapAdapter : public CompareAdapter
+{
+    public:
+
+        bool add(const uint32_t key, const uint32_t value) { return m_map.add(key, value); }
+        bool get(const uint32_t key, uint32_t& value) const { return m_map.get(key, value); }
+        bool remove(const uint32_t key) { return m_map.remove(key); }
+        void clear() { m_map.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        nano_stl::StaticFlatMap<uint32_t, uint32_t, CAPACITY> m_map;
+};
+
+
+/** \brief Adapter for the StaticBTree container */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class NanoBTreeAdapter : public CompareAdapter
+{
+    public:
+
+        bool add(const uint32_t key, const uint32_t value) { return m_map.add(key, value); }
+        bool get(const uint32_t key, uint32_t& value) const { return m_map.get(key, value); }
+        bool remove(const uint32_t key) { return m_map.remove(key); }
+        void clear() { m_map.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        nano_stl::StaticBTree<uint32_t, uint32_t, CAPACITY> m_map;
+};
+
+
+/** \brief Adapter for the StaticHashMap container */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class NanoHashMapAdapter : public CompareAdapter
+{
+    public:
+
+        bool add(const uint32_t key, const uint32_t value) { return m_map.add(key, value); }
+        bool get(const uint32_t key, uint32_t& value) const { return m_map.get(key, value); }
+        bool remove(const uint32_t key) { return m_map.remove(key); }
+        void clear() { m_map.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        nano_stl::StaticHashMap<uint32_t, uint32_t, CAPACITY> m_map;
+};
+
+/** \brief Adapter for the std::unordered_map container with a fixed capacity */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class StdUnorderedMapAdapter : public CompareAdapter
+{
+    public:
+
+        StdUnorderedMapAdapter() : m_map() { m_map.reserve(CAPACITY); }
+
+        bool add(const uint32_t key, const uint32_t value)
+        {
+            // Like StaticHashMap, an existing key is not overwritten
+            bool ret = false;
+            if (m_map.size() < CAPACITY)
+            {
+                ret = m_map.insert(std::make_pair(key, value)).second;
+            }
+            return ret;
+        }
+        bool get(const uint32_t key, uint32_t& value) const
+        {
+            const std::unordered_map<uint32_t, uint32_t>::const_iterator it = m_map.find(key);
+            const bool ret = (it != m_map.end());
+            if (ret)
+            {
+                value = it->second;
+            }
+            return ret;
+        }
+        bool remove(const uint32_t key) { return (m_map.erase(key) != 0u); }
+        void clear() { m_map.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        std::unordered_map<uint32_t, uint32_t> m_map;
+};
+
+
+/** \brief Adapter for the StaticQueue container (items are pushed at the end and popped at the start) */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class NanoQueueAdapter : public CompareAdapter
+{
+    public:
+
+        bool pushBack(const uint32_t value) { return m_queue.push(value); }
+        bool popFront(uint32_t& value) { return m_queue.pop(value); }
+        void clear() { (void)m_queue.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        nano_stl::StaticQueue<uint32_t, CAPACITY> m_queue;
+};
+
+/** \brief Adapter for the std::deque container with a fixed capacity */
+template <nano_stl::nano_stl_size_t CAPACITY>
+class StdDequeAdapter : public CompareAdapter
+{
+    public:
+
+        bool pushBack(const uint32_t value)
+        {
+            const bool ret = (m_deque.size() < CAPACITY);
+            if (ret)
+            {
+                m_deque.push_back(value);
+            }
+            return ret;
+        }
+        bool popFront(uint32_t& value)
+        {
+            const bool ret = !m_deque.empty();
+            if (ret)
+            {
+                value = m_deque.front();
+                m_deque.pop_front();
+            }
+            return ret;
+        }
+        void clear() { m_deque.clear(); }
+
+    private:
+
+        /** \brief Underlying container */
+        std::deque<uint32_t> m_deque;
+};
+
+
+#endif // COMPAREADAPTERS_H
@@ -0,0 +1,195 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Compares.h"
+#include "CompareTools.h"
+#include "CompareAdapters.h"
+
+#include <stdio.h>
+
+using namespace nano_stl;
+
+
+/** \brief Operation trace shared by all the comparisons */
+static CompareTrace s_trace;
+
+/** \brief Results of the operations on the nano-stl container */
+static uint32_t s_nano_results[COMPARE_MAX_TRACE_LENGTH];
+
+/** \brief Results of the operations on the standard library container */
+static uint32_t s_std_results[COMPARE_MAX_TRACE_LENGTH];
+
+
+/** \brief Vector workload : indexed reads and writes on a stack */
+static const CompareWorkload s_vector_workload[] = {
+    { COMPARE_OP_PUSH_BACK, 6u, 1u, 1 },
+    { COMPARE_OP_POP_BACK, 1u, 6u, -1 },
+    { COMPARE_OP_READ, 4u, 4u, 0 },
+    { COMPARE_OP_WRITE, 2u, 2u, 0 }
+};
+
+/** \brief List workload : insertions and removals at both ends */
+static const CompareWorkload s_list_workload[] = {
+    { COMPARE_OP_PUSH_BACK, 3u, 1u, 1 },
+    { COMPARE_OP_PUSH_FRONT, 3u, 1u, 1 },
+    { COMPARE_OP_POP_BACK, 1u, 3u, -1 },
+    { COMPARE_OP_POP_FRONT, 1u, 3u, -1 }
+};
+
+/** \brief Map workload : insertions, lookups and removals of random keys */
+static const CompareWorkload s_map_workload[] = {
+    { COMPARE_OP_ADD, 5u, 1u, 1 },
+    { COMPARE_OP_GET, 4u, 4u, 0 },
+    { COMPARE_OP_REMOVE, 1u, 5u, -1 }
+};
+
+/** \brief Queue workload : FIFO insertions and removals */
+static const CompareWorkload s_queue_workload[] = {
+    { COMPARE_OP_PUSH_BACK, 4u, 1u, 1 },
+    { COMPARE_OP_POP_FRONT, 1u, 4u, -1 }
+};
+
+
+/** \brief Run the same randomized trace on a nano-stl container and on its standard library counterpart */
+template <typename NanoAdapterType, typename StdAdapterType, nano_stl_size_t WORKLOAD_SIZE>
+static bool COMPARE_Container(const char* name, const nano_stl_size_t capacity, const CompareWorkload (&workload)[WORKLOAD_SIZE], 
+                              const uint32_t key_range, CompareCounters& counters)
+{
+    bool ret = true;
+    if (COMPARE_IsSelected(name))
+    {
+        // Containers are allocated on the heap to keep the big static containers out of the stack
+        NanoAdapterType* const nano_adapter = new NanoAdapterType();
+        StdAdapterType* const std_adapter = new StdAdapterType();
+        CompareResult nano_result;
+        CompareResult std_result;
+
+        COMPARE_BuildTrace(s_trace, workload, WORKLOAD_SIZE, capacity, key_range, static_cast<uint32_t>(capacity * 2654435761u));
+        COMPARE_Measure(*nano_adapter, s_trace, s_nano_results, counters, nano_result);
+        COMPARE_Measure(*std_adapter, s_trace, s_std_results, counters, std_result);
+        ret = COMPARE_Report(name, capacity, s_trace, s_nano_results, s_std_results, nano_result, std_result, counters.isAvailable());
+
+        delete std_adapter;
+        delete nano_adapter;
+    }
+    return ret;
+}
+
+/** \brief Compare the vector containers */
+template <nano_stl_size_t CAPACITY>
+static bool COMPARE_Vector(CompareCounters& counters)
+{
+    return COMPARE_Container<NanoVectorAdapter<CAPACITY>, StdVectorAdapter<CAPACITY> >("StaticVector/vector", CAPACITY, s_vector_workload, CAPACITY, counters);
+}
+
+/** \brief Compare the list containers */
+template <nano_stl_size_t CAPACITY>
+static bool COMPARE_List(CompareCounters& counters)
+{
+    return COMPARE_Container<NanoListAdapter<CAPACITY>, StdListAdapter<CAPACITY> >("StaticList/list", CAPACITY, s_list_workload, CAPACITY, counters);
+}
+
+/** \brief Compare the map containers */
+template <nano_stl_size_t CAPACITY>
+static bool COMPARE_Map(CompareCounters& counters)
+{
+    return COMPARE_Container<NanoMapAdapter<CAPACITY>, StdMapAdapter<CAPACITY> >("StaticMap/map", CAPACITY, s_map_workload, 2u * CAPACITY, counters);
+}
+
+/** \brief Compare the slim map with the map container */
+template <nano_stl_size_t CAPACITY>
+static bool COMPARE_SlimMap(CompareCounters& counters)
+{
+    return COMPARE_Container<NanoSlimMapAdapter<CAPACITY>, StdMapAdapter<CAPACITY> >("StaticSlimMap/map", CAPACITY, s_map_workload, 2u * CAPACITY, counters);
+}
+
+/** \brief Compare the flat map with the map container */
+template <nano_stl_size_t CAPACITY>
+static bool COMPARE_FlatMap(CompareCounters& counters)
+{
+    return COMPARE_Container<NanoFlatMapAdapter<CAPACITY>, StdMapAdapter<CAPACITY> >("StaticFlatMap/map", CAPACITY, s_map_workload, 2u * CAPACITY, counters);
+}
+
+/** \brief Compare the B+tree map with the map container */
+template <nano_stl_size_t CAPACITY>
+static bool COMPARE_BTree(CompareCounters& counters)
+{
+    return COMPARE_Container<NanoBTreeAdapter<CAPACITY>, StdMapAdapter<CAPACITY> >("StaticBTree/map", CAPACITY, s_map_workload, 2u * CAPACITY, counters);
+}
+
+/** \brief Compare the hash map containers */
+template <nano_stl_size_t CAPACITY>
+static bool COMPARE_HashMap(CompareCounters& counters)
+{
+    return COMPARE_Container<NanoHashMapAdapter<CAPACITY>, StdUnorderedMapAdapter<CAPACITY> >("StaticHashMap/unordered_map", CAPACITY, s_map_workload, 2u * CAPACITY, counters);
+}
+
+/** \brief Compare the queue containers */
+template <nano_stl_size_t CAPACITY>
+static bool COMPARE_Queue(CompareCounters& counters)
+{
+    return COMPARE_Container<NanoQueueAdapter<CAPACITY>, StdDequeAdapter<CAPACITY> >("StaticQueue/deque", CAPACITY, s_queue_workload, CAPACITY, counters);
+}
+
+/** \brief Run the containers comparisons */
+bool COMPARE_Containers()
+{
+    CompareCounters counters;
+    bool ret = true;
+
+    if (!counters.isAvailable())
+    {
+        printf("Hardware cache counters are not available (check /proc/sys/kernel/perf_event_paranoid)\n");
+    }
+    COMPARE_PrintHeader();
+
+    ret = COMPARE_Vector<16u>(counters) && ret;
+    ret = COMPARE_Vector<256u>(counters) && ret;
+    ret = COMPARE_Vector<4096u>(counters) && ret;
+
+    ret = COMPARE_List<16u>(counters) && ret;
+    ret = COMPARE_List<256u>(counters) && ret;
+    ret = COMPARE_List<4096u>(counters) && ret;
+
+    ret = COMPARE_Map<16u>(counters) && ret;
+    ret = COMPARE_Map<256u>(counters) && ret;
+    ret = COMPARE_Map<4096u>(counters) && ret;
+
+    ret = COMPARE_SlimMap<16u>(counters) && ret;
+    ret = COMPARE_SlimMap<256u>(counters) && ret;
+    ret = COMPARE_SlimMap<4096u>(counters) && ret;
+
+    ret = COMPARE_FlatMap<16u>(counters) && ret;
+    ret = COMPARE_FlatMap<256u>(counters) && ret;
+    ret = COMPARE_FlatMap<4096u>(counters) && ret;
+
+    ret = COMPARE_BTree<16u>(counters) && ret;
+    ret = COMPARE_BTree<256u>(counters) && ret;
+    ret = COMPARE_BTree<4096u>(counters) && ret;
+
+    ret = COMPARE_HashMap<16u>(counters) && ret;
+    ret = COMPARE_HashMap<256u>(counters) && ret;
+    ret = COMPARE_HashMap<4096u>(counters) && ret;
+
+    ret = COMPARE_Queue<16u>(counters) && ret;
+    ret = COMPARE_Queue<256u>(counters) && ret;
+    ret = COMPARE_Queue<4096u>(counters) && ret;
+
+    return ret;
+}
@@ -0,0 +1,265 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "CompareTools.h"
+
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include <algorithm>
+
+using namespace nano_stl;
+
+
+/** \brief Comparison name filter */
+static const char* s_compare_filter = nullptr;
+
+
+
+/** \brief Open a hardware cache counter of the current process (user space only) */
+static int COMPARE_OpenCounter(const uint32_t type, const uint64_t config)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1u;
+    attr.exclude_kernel = 1u;
+    attr.exclude_hv = 1u;
+
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0ul));
+}
+
+/** \brief Constructor (opens the counters, they are not available if the kernel or the CPU doesn't allow it) */
+CompareCounters::CompareCounters()
+: m_l1d_fd(-1)
+, m_llc_fd(-1)
+, m_l1d_misses(0u)
+, m_llc_misses(0u)
+{
+    m_l1d_fd = COMPARE_OpenCounter(PERF_TYPE_HW_CACHE, (PERF_COUNT_HW_CACHE_L1D) |
+                                                       (PERF_COUNT_HW_CACHE_OP_READ << 8u) |
+                                                       (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u));
+    m_llc_fd = COMPARE_OpenCounter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+    if ((m_l1d_fd < 0) || (m_llc_fd < 0))
+    {
+        if (m_l1d_fd >= 0)
+        {
+            close(m_l1d_fd);
+        }
+        if (m_llc_fd >= 0)
+        {
+            close(m_llc_fd);
+        }
+        m_l1d_fd = -1;
+        m_llc_fd = -1;
+    }
+}
+
+/** \brief Destructor */
+CompareCounters::~CompareCounters()
+{
+    if (isAvailable())
+    {
+        close(m_l1d_fd);
+        close(m_llc_fd);
+    }
+}
+
+/** \brief Reset and start the counters */
+void CompareCounters::start()
+{
+    if (isAvailable())
+    {
+        ioctl(m_l1d_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_llc_fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(m_l1d_fd, PERF_EVENT_IOC_ENABLE, 0);
+        ioctl(m_llc_fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+/** \brief Stop the counters and accumulate their values */
+void CompareCounters::stop()
+{
+    if (isAvailable())
+    {
+        ioctl(m_l1d_fd, PERF_EVENT_IOC_DISABLE, 0);
+        ioctl(m_llc_fd, PERF_EVENT_IOC_DISABLE, 0);
+        m_l1d_misses += read(m_l1d_fd);
+        m_llc_misses += read(m_llc_fd);
+    }
+}
+
+/** \brief Read a counter */
+uint64_t CompareCounters::read(const int fd)
+{
+    uint64_t value = 0u;
+    if (::read(fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value)))
+    {
+        value = 0u;
+    }
+    return value;
+}
+
+
+/** \brief Get a monotonic timestamp in nanoseconds */
+uint64_t COMPARE_Now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (static_cast<uint64_t>(ts.tv_sec) * 1000000000u) + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+/** \brief Check if a comparison name matches the filter given on the command line */
+bool COMPARE_IsSelected(const char* name)
+{
+    return ((s_compare_filter == nullptr) || (strstr(name, s_compare_filter) != nullptr));
+}
+
+/** \brief Set the comparison name filter (nullptr = run all comparisons) */
+void COMPARE_SetFilter(const char* filter)
+{
+    s_compare_filter = filter;
+}
+
+/** \brief Build a randomized trace : the container is alternately filled up to its capacity and drained */
+void COMPARE_BuildTrace(CompareTrace& trace, const CompareWorkload workload[], const nano_stl_size_t workload_size,
+                        const nano_stl_size_t capacity, const uint32_t key_range, const uint32_t seed)
+{
+    CompareRandom random(seed);
+    uint32_t fill_total = 0u;
+    uint32_t drain_total = 0u;
+    for (nano_stl_size_t i = 0u; i < workload_size; i++)
+    {
+        fill_total += workload[i].fill_weight;
+        drain_total += workload[i].drain_weight;
+    }
+
+    // Long enough to go several times through the whole capacity
+    nano_stl_size_t length = 8u * capacity;
+    if (length < COMPARE_MIN_TRACE_LENGTH)
+    {
+        length = COMPARE_MIN_TRACE_LENGTH;
+    }
+    else if (length > COMPARE_MAX_TRACE_LENGTH)
+    {
+        length = COMPARE_MAX_TRACE_LENGTH;
+    }
+    else {}
+
+    // The item count is only estimated since the operations can fail,
+    // it is only used to switch between the fill and the drain modes
+    bool filling = true;
+    int32_t count = 0;
+    for (nano_stl_size_t i = 0u; i < length; i++)
+    {
+        if (count >= static_cast<int32_t>(capacity))
+        {
+            filling = false;
+        }
+        else if (count <= 0)
+        {
+            filling = true;
+            count = 0;
+        }
+        else {}
+
+        const uint32_t total = (filling ? fill_total : drain_total);
+        uint32_t pick = random.next() % total;
+        nano_stl_size_t op = 0u;
+        while (pick >= (filling ? workload[op].fill_weight : workload[op].drain_weight))
+        {
+            pick -= (filling ? workload[op].fill_weight : workload[op].drain_weight);
+            op++;
+        }
+
+        CompareStep& step = trace.steps[i];
+        step.operation = static_cast<uint32_t>(workload[op].operation);
+        step.key = random.next() % key_range;
+        step.value = random.next() & 0x7FFFFFFFu;
+        count += workload[op].count_change;
+    }
+    trace.length = length;
+}
+
+/** \brief Print the header of the results table */
+void COMPARE_PrintHeader()
+{
+    printf("%-28s %6s %7s %10s %10s %8s %12s %12s %12s %12s %9s\n",
+           "container", "cap", "ops", "nano ns", "std ns", "speedup",
+           "nano L1D/op", "std L1D/op", "nano LLC/op", "std LLC/op", "result");
+}
+
+/** \brief Print the result of a comparison, returns false if the results of the containers differ */
+bool COMPARE_Report(const char* name, const nano_stl_size_t capacity, const CompareTrace& trace, 
+                    const uint32_t nano_results[], const uint32_t std_results[],
+                    const CompareResult& nano_result, const CompareResult& std_result, const bool counters_available)
+{
+    // Look for the first diverging operation
+    nano_stl_size_t mismatch = trace.length;
+    for (nano_stl_size_t i = 0u; (i < trace.length) && (mismatch == trace.length); i++)
+    {
+        if (nano_results[i] != std_results[i])
+        {
+            mismatch = i;
+        }
+    }
+
+    const double speedup = ((nano_result.ns_per_op > 0.) ? (std_result.ns_per_op / nano_result.ns_per_op) : 0.);
+    printf("%-28s %6u %7u %10.2f %10.2f %7.2fx ", name, static_cast<unsigned int>(capacity), static_cast<unsigned int>(trace.length),
+           nano_result.ns_per_op, std_result.ns_per_op, speedup);
+    if (counters_available)
+    {
+        printf("%12.3f %12.3f %12.3f %12.3f ", nano_result.l1d_misses_per_op, std_result.l1d_misses_per_op,
+                                               nano_result.llc_misses_per_op, std_result.llc_misses_per_op);
+    }
+    else
+    {
+        printf("%12s %12s %12s %12s ", "n/a", "n/a", "n/a", "n/a");
+    }
+
+    const bool ok = (mismatch == trace.length);
+    if (ok)
+    {
+        printf("%9s\n", "OK");
+    }
+    else
+    {
+        const CompareStep& step = trace.steps[mismatch];
+        printf("%9s\n", "MISMATCH");
+        printf("    => operation #%u (op=%u, key=%u, value=%u) : nano-stl=0x%08x, std=0x%08x\n",
+               static_cast<unsigned int>(mismatch), static_cast<unsigned int>(step.operation), 
+               static_cast<unsigned int>(step.key), static_cast<unsigned int>(step.value),
+               static_cast<unsigned int>(nano_results[mismatch]), static_cast<unsigned int>(std_results[mismatch]));
+    }
+
+    return ok;
+}
+
+/** \brief Get the median value of the timings of the runs */
+double COMPARE_Median(double samples[], const nano_stl_size_t count)
+{
+    std::sort(samples, samples + count);
+    return samples[count / 2u];
+}
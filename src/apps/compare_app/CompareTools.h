@@ -0,0 +1,261 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMPARETOOLS_H
+#define COMPARETOOLS_H
+
+#include "nano-stl.h"
+
+
+/** \brief Maximum number of operations in a trace */
+#define COMPARE_MAX_TRACE_LENGTH    32768u
+
+/** \brief Minimum number of operations in a trace */
+#define COMPARE_MIN_TRACE_LENGTH    4096u
+
+/** \brief Number of timed runs of a trace (the median run is reported) */
+#define COMPARE_RUN_COUNT           15u
+
+/** \brief Value returned in the results of the operations which have failed */
+#define COMPARE_FAILED              0xFFFFFFFFu
+
+
+/** \brief Operations of the traces */
+enum CompareOperation
+{
+    /** \brief Add an item at the end */
+    COMPARE_OP_PUSH_BACK = 0,
+    /** \brief Add an item at the start */
+    COMPARE_OP_PUSH_FRONT = 1,
+    /** \brief Remove the item at the end */
+    COMPARE_OP_POP_BACK = 2,
+    /** \brief Remove the item at the start */
+    COMPARE_OP_POP_FRONT = 3,
+    /** \brief Read the item at an index */
+    COMPARE_OP_READ = 4,
+    /** \brief Write the item at an index */
+    COMPARE_OP_WRITE = 5,
+    /** \brief Add an item with a key */
+    COMPARE_OP_ADD = 6,
+    /** \brief Get the item with a key */
+    COMPARE_OP_GET = 7,
+    /** \brief Remove the item with a key */
+    COMPARE_OP_REMOVE = 8
+};
+
+/** \brief Single operation of a trace */
+struct CompareStep
+{
+    /** \brief Operation */
+    uint32_t operation;
+    /** \brief Key or index */
+    uint32_t key;
+    /** \brief Value */
+    uint32_t value;
+};
+
+/** \brief Operation trace */
+struct CompareTrace
+{
+    /** \brief Operations */
+    CompareStep steps[COMPARE_MAX_TRACE_LENGTH];
+    /** \brief Number of operations */
+    nano_stl::nano_stl_size_t length;
+};
+
+/** \brief Relative weights of the operations of a randomized trace while filling and while draining the container */
+struct CompareWorkload
+{
+    /** \brief Operation */
+    CompareOperation operation;
+    /** \brief Weight while the container is filled */
+    uint32_t fill_weight;
+    /** \brief Weight while the container is drained */
+    uint32_t drain_weight;
+    /** \brief Change of the item count when the operation succeeds (-1, 0 or 1) */
+    int32_t count_change;
+};
+
+
+/** \brief Pseudo random number generator (xorshift32) used to build reproducible operation traces */
+class CompareRandom
+{
+    public:
+
+        /** \brief Constructor */
+        CompareRandom(const uint32_t seed) : m_state((seed != 0u) ? seed : 0x9E3779B9u) {}
+
+        /** \brief Get the next random number */
+        uint32_t next()
+        {
+            m_state ^= (m_state << 13u);
+            m_state ^= (m_state >> 17u);
+            m_state ^= (m_state << 5u);
+            return m_state;
+        }
+
+    private:
+
+        /** \brief Generator state */
+        uint32_t m_state;
+};
+
+
+/** \brief Hardware cache miss counters of the current process */
+class CompareCounters
+{
+    public:
+
+        /** \brief Constructor (opens the counters, they are not available if the kernel or the CPU doesn't allow it) */
+        CompareCounters();
+
+        /** \brief Destructor */
+        ~CompareCounters();
+
+        /** \brief Check if the counters are available */
+        bool isAvailable() const { return (m_l1d_fd >= 0); }
+
+        /** \brief Reset and start the counters */
+        void start();
+
+        /** \brief Stop the counters and accumulate their values */
+        void stop();
+
+        /** \brief Get the accumulated number of L1 data cache read misses */
+        uint64_t getL1dMisses() const { return m_l1d_misses; }
+
+        /** \brief Get the accumulated number of last level cache misses */
+        uint64_t getLlcMisses() const { return m_llc_misses; }
+
+        /** \brief Clear the accumulated values */
+        void clear() { m_l1d_misses = 0u; m_llc_misses = 0u; }
+
+    private:
+
+        /** \brief L1 data cache read misses counter */
+        int m_l1d_fd;
+
+        /** \brief Last level cache misses counter */
+        int m_llc_fd;
+
+        /** \brief Accumulated L1 data cache read misses */
+        uint64_t m_l1d_misses;
+
+        /** \brief Accumulated last level cache misses */
+        uint64_t m_llc_misses;
+
+        /** \brief Read a counter */
+        static uint64_t read(const int fd);
+};
+
+
+/** \brief Result of the comparison of a nano-stl container with its standard library counterpart on a trace */
+struct CompareResult
+{
+    /** \brief Median time per operation in nanoseconds */
+    double ns_per_op;
+    /** \brief L1 data cache read misses per operation */
+    double l1d_misses_per_op;
+    /** \brief Last level cache misses per operation */
+    double llc_misses_per_op;
+};
+
+
+/** \brief Get a monotonic timestamp in nanoseconds */
+uint64_t COMPARE_Now();
+
+/** \brief Check if a comparison name matches the filter given on the command line */
+bool COMPARE_IsSelected(const char* name);
+
+/** \brief Set the comparison name filter (nullptr = run all comparisons) */
+void COMPARE_SetFilter(const char* filter);
+
+/** \brief Build a randomized trace : the container is alternately filled up to its capacity and drained */
+void COMPARE_BuildTrace(CompareTrace& trace, const CompareWorkload workload[], const nano_stl::nano_stl_size_t workload_size,
+                        const nano_stl::nano_stl_size_t capacity, const uint32_t key_range, const uint32_t seed);
+
+/** \brief Print the header of the results table */
+void COMPARE_PrintHeader();
+
+/** \brief Print the result of a comparison, returns false if the results of the containers differ */
+bool COMPARE_Report(const char* name, const nano_stl::nano_stl_size_t capacity, const CompareTrace& trace, 
+                    const uint32_t nano_results[], const uint32_t std_results[],
+                    const CompareResult& nano_result, const CompareResult& std_result, const bool counters_available);
+
+/** \brief Get the median value of the timings of the runs */
+double COMPARE_Median(double samples[], const nano_stl::nano_stl_size_t count);
+
+
+/** \brief Run a trace on a container adapter and store the result of each operation */
+template <typename AdapterType>
+static inline void COMPARE_RunTrace(AdapterType& adapter, const CompareTrace& trace, uint32_t results[])
+{
+    const CompareStep* step = trace.steps;
+    for (nano_stl::nano_stl_size_t i = 0u; i < trace.length; i++)
+    {
+        uint32_t result = COMPARE_FAILED;
+        switch (step->operation)
+        {
+            case COMPARE_OP_PUSH_BACK: result = (adapter.pushBack(step->value) ? step->value : COMPARE_FAILED); break;
+            case COMPARE_OP_PUSH_FRONT: result = (adapter.pushFront(step->value) ? step->value : COMPARE_FAILED); break;
+            case COMPARE_OP_POP_BACK: (void)adapter.popBack(result); break;
+            case COMPARE_OP_POP_FRONT: (void)adapter.popFront(result); break;
+            case COMPARE_OP_READ: (void)adapter.read(step->key, result); break;
+            case COMPARE_OP_WRITE: result = (adapter.write(step->key, step->value) ? step->value : COMPARE_FAILED); break;
+            case COMPARE_OP_ADD: result = (adapter.add(step->key, step->value) ? step->value : COMPARE_FAILED); break;
+            case COMPARE_OP_GET: (void)adapter.get(step->key, result); break;
+            case COMPARE_OP_REMOVE: result = (adapter.remove(step->key) ? step->key : COMPARE_FAILED); break;
+            default: break;
+        }
+        results[i] = result;
+        step++;
+    }
+}
+
+/** \brief Run a trace several times on a container adapter and measure the time and the cache misses per operation */
+template <typename AdapterType>
+static void COMPARE_Measure(AdapterType& adapter, const CompareTrace& trace, uint32_t results[], CompareCounters& counters, CompareResult& result)
+{
+    static double samples[COMPARE_RUN_COUNT];
+
+    // Warm-up run which also gives the results to compare
+    adapter.clear();
+    COMPARE_RunTrace(adapter, trace, results);
+
+    // Timed runs
+    counters.clear();
+    for (nano_stl::nano_stl_size_t run = 0u; run < COMPARE_RUN_COUNT; run++)
+    {
+        adapter.clear();
+        counters.start();
+        const uint64_t start = COMPARE_Now();
+        COMPARE_RunTrace(adapter, trace, results);
+        const uint64_t stop = COMPARE_Now();
+        counters.stop();
+        samples[run] = static_cast<double>(stop - start) / static_cast<double>(trace.length);
+    }
+
+    const double op_count = static_cast<double>(trace.length) * static_cast<double>(COMPARE_RUN_COUNT);
+    result.ns_per_op = COMPARE_Median(samples, COMPARE_RUN_COUNT);
+    result.l1d_misses_per_op = static_cast<double>(counters.getL1dMisses()) / op_count;
+    result.llc_misses_per_op = static_cast<double>(counters.getLlcMisses()) / op_count;
+}
+
+
+#endif // COMPARETOOLS_H
@@ -0,0 +1,43 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Compares.h"
+#include "CompareTools.h"
+
+#include <stdio.h>
+
+
+int main(int argc, char* argv[])
+{
+	// Optional comparison name filter
+	if (argc > 1)
+	{
+		COMPARE_SetFilter(argv[1]);
+	}
+
+	printf("Nano-STL differential comparison with the standard library containers\n");
+
+	const bool ok = COMPARE_Containers();
+	if (!ok)
+	{
+		printf("Nano-STL containers results differ from the standard library containers results!\n");
+	}
+
+	return (ok ? 0 : 1);
+}
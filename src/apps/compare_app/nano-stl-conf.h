@@ -0,0 +1,202 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_STL_CONF_H
+#define NANO_STL_CONF_H
+
+
+#if (__cplusplus < 201103L)
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+
+#ifndef NULL
+#define NULL 0
+#endif // NULL
+#define nullptr NULL
+#define override
+
+#else // __cplusplus
+#include <cstdint>
+#include <cstddef>
+#include <cstdarg>
+#endif // __cplusplus
+
+namespace nano_stl
+{
+
+/** \brief Define the maximum size of a container in number of elements */
+typedef uint32_t nano_stl_size_t;
+
+}
+
+
+//////////////////////////////// Options /////////////////////////////////
+
+
+/* Error handler options */
+
+/** \brief Maximum number of listeners to the critical error event */
+#define NANO_STL_MAX_ERROR_HANDLER_LISTENERS            2
+
+
+
+
+
+/* Containers configuration options */
+
+/** \brief Enable the use of iterators (increase code size) */
+#define NANO_STL_ITERATORS_ENABLED                      1
+
+/** \brief Enable item access checking (prevent segfault when wrongly access container item but increase code size and decrease performances) */
+#define NANO_STL_ITEM_ACCESS_CHECK_ENABLE               1
+
+/** \brief Enable the containers usage statistics (high-water count, failed insertions, ring buffer overwrites, binary search tree 
+ *         search depth, see IContainerStats) to size the containers capacities (increase RAM usage and decrease performances) */
+#define NANO_STL_STATS_ENABLED                          0
+
+/** \brief Enable the self-balancing (red-black) of the binary search trees and maps : guarantees O(log n) add/get/remove even when 
+ *         the keys are added in order (increase RAM usage by a color per node and slightly increase code size) */
+#define NANO_STL_BSTREE_BALANCING_ENABLED               1
+
+/** \brief Enable the index links between the nodes of the binary search trees and maps : the links are stored as 8, 16 or 32 bits 
+ *         indexes depending on the maximum node count instead of pointers (reduce RAM usage and makes the nodes arrays position 
+ *         independent so that they can be copied with memcpy, but slightly decrease performances) */
+#define NANO_STL_INDEX_LINKS_ENABLED                    1
+
+/** \brief Enable the split layout of the binary search trees and maps : the keys and the links are stored in the nodes array and 
+ *         the items in a parallel array so that the searches only load the keys and links (faster searches with large items, 
+ *         but an additional cache miss to read the item when it is found) */
+#define NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED            0
+
+/** \brief Prefetch macro definition : hint the CPU to load the cache line of an address which will be read soon 
+ *         (used by the searches of the sorted indexes, leave it empty if the compiler has no prefetch builtin) */
+#if defined(__GNUC__)
+#define NANO_STL_PREFETCH(address)  __builtin_prefetch((address))
+#else
+#define NANO_STL_PREFETCH(address)
+#endif // __GNUC__
+
+
+
+
+
+/* Memory management configuration options */
+
+/** \brief No dynamic memory allocation will be allowed */
+#define NANO_STL_DYNAMIC_MEMORY_ALLOCATION_DISABLED     0
+/** \brief Dynamic memory allocation will be performed by C malloc/free functions */
+#define NANO_STL_DYNAMIC_MEMORY_ALLOCATION_MALLOC       1
+/** \brief Dynamic memory allocation will be performed by C++ standard new/delete implementation or by another library */
+#define NANO_STL_DYNAMIC_MEMORY_ALLOCATION_STANDARD     2
+
+/** \brief Memory management configuration
+ *         Valid values are:
+ *         NANO_STL_DYNAMIC_MEMORY_ALLOCATION_DISABLED
+ *         NANO_STL_DYNAMIC_MEMORY_ALLOCATION_MALLOC
+ *         NANO_STL_DYNAMIC_MEMORY_ALLOCATION_STANDARD
+ */
+#define NANO_STL_DYNAMIC_MEMORY_ALLOCATION      NANO_STL_DYNAMIC_MEMORY_ALLOCATION_STANDARD
+
+
+
+
+
+/* Lib C configuration options 
+
+    Default is to use internal Nano-STL fonctions which are highly portable, 
+    usually small in code size but not very efficient in terms of performances.
+
+    Uncomment the following headers and change the function names in the macro definitions
+    if you want to use standard functions from your compiler librairies.
+*/
+
+/*  
+#if (__cplusplus < 201103L)
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#else // __cplusplus
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#endif // __cplusplus
+*/
+
+/** \brief Enable the word at a time implementation of the internal Nano-STL memory functions (Memset, Memcpy, Memcmp)
+ *         (increase code size but greatly improve performances on buffers larger than a few machine words) */
+#define NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED     1
+
+/** \brief Enable the word at a time implementation of the internal Nano-STL string functions (Strnlen, Strncmp, Strncpy, Strncat)
+ *         (increase code size but greatly improve performances on strings longer than a few machine words) */
+#define NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED     1
+
+/** \brief Enable the SIMD (SSE2/AVX2) implementation of the internal Nano-STL Memset, Memcpy, Memcmp, Strncmp and Strnlen functions
+ *         (the instruction set is selected at startup depending on the CPU, only available with GCC on x86 CPUs) */
+#define NANO_STL_LIBC_SIMD_ENABLED                      1
+
+/** \brief Enable the floating point conversions (%f, %e, %g) of the internal Nano-STL Vsnprintf function and the Dtoa function
+ *         (increase code size and uses around 1kB of stack while formatting a floating point number) */
+#define NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED          1
+
+/** \brief Enable the Eisel-Lemire fast path of the internal Nano-STL Atof and Antof functions
+ *         (adds a 5kB table of powers of five, without it the values which are not handled by the exact double arithmetic fast path
+ *          are converted by the much slower exact big integers algorithm) */
+#define NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED        1
+
+#include "nano-stl-libc.h"
+
+/** \brief Memset macro definition */
+#define NANO_STL_MEMSET(dst, val, size) NANO_STL_LIBC_Memset((dst), (val), (size))
+
+/** \brief Memcpy macro definition */
+#define NANO_STL_MEMCPY(dst, src, size) NANO_STL_LIBC_Memcpy((dst), (src), (size))
+
+/** \brief Memcmp macro definition */
+#define NANO_STL_MEMCMP(s1, s2, size) NANO_STL_LIBC_Memcmp((s1), (s2), (size))
+
+/** \brief Strncmp macro definition */
+#define NANO_STL_STRNCMP(s1, s2, size) NANO_STL_LIBC_Strncmp((s1), (s2), (size))
+
+/** \brief Strnlen macro definition */
+#define NANO_STL_STRNLEN(s, maxlen) NANO_STL_LIBC_Strnlen((s), (maxlen))
+
+/** \brief Strncat macro definition */
+#define NANO_STL_STRNCAT(dest, src, size) NANO_STL_LIBC_Strncat((dest), (src), (size))
+
+/** \brief Strncpy macro definition */
+#define NANO_STL_STRNCPY(dest, src, size) NANO_STL_LIBC_Strncpy((dest), (src), (size))
+
+/** \brief Vsnprintf macro definition */
+#define NANO_STL_VSNPRINTF(str, n, format, ap) NANO_STL_LIBC_Vsnprintf((str), (n), (format), (ap))
+
+/** \brief Snprintf macro definition */
+#define NANO_STL_SNPRINTF(str, n, format, ...) NANO_STL_LIBC_Snprintf((str), (n), (format), ##__VA_ARGS__)
+
+/** \brief Atoi macro definition */
+#define NANO_STL_ATOI(str) NANO_STL_LIBC_Atoi((str))
+
+/** \brief Itoa macro definition */
+#define NANO_STL_ITOA(value, str, base) NANO_STL_LIBC_Itoa((value), (str), (base))
+
+/** \brief Atof macro definition */
+#define NANO_STL_ATOF(str) NANO_STL_LIBC_Atof((str))
+
+
+#endif // NANO_STL_CONF_H
@@ -82,8 +82,8 @@ static void DEMO_List()
 
 	DisplayContents<uint16_t>(int_list);
 
-	IList<uint16_t>::Iterator remove_first_it(int_list);
-	IList<uint16_t>::Iterator remove_last_it(int_list);
+	StaticList<uint16_t, 10u>::Iterator remove_first_it(int_list);
+	StaticList<uint16_t, 10u>::Iterator remove_last_it(int_list);
 	int_list.begin(remove_first_it);
 	++remove_first_it;
 	remove_last_it = remove_first_it;
@@ -115,8 +115,196 @@ static void DEMO_Map()
 	int_map.remove(10u);
 
 	DisplayContents<const char*>(int_map);
+
+	// Keys from 12 to 21 in ascending order
+	std::cout << "-------------------" << std::endl;
+	for (StaticMap<uint8_t, const char*, 15u>::RangeIterator it = int_map.range(12u, 21u); it.isValid(); ++it)
+	{
+		std::cout << static_cast<int>(it.getKey()) << " => " << (*it) << std::endl;
+	}
+	std::cout << "-------------------" << std::endl;
 }
 
+/** \brief Demo of slim map container */
+static void DEMO_SlimMap()
+{
+	static StaticSlimMap<uint16_t, const char*, 15u, true> int_map;
+
+	int_map.add(20u, "20");
+	int_map.add(10u, "10");
+	int_map.add(30u, "30");
+	int_map.add(5u, "5");
+	int_map.add(15u, "15");
+
+	int_map.remove(10u);
+
+	const char** const item = int_map.find(30u);
+	if (item != nullptr)
+	{
+		(*item) = "thirty";
+	}
+
+	std::cout << "-------------------" << std::endl;
+	int_map.forEach([](const char* value) { std::cout << value << std::endl; });
+	std::cout << "-------------------" << std::endl;
+
+	static StaticSlimMap<StaticString<15u>, uint16_t, 10u> route_map;
+
+	route_map.add("/status", 1u);
+	route_map.add("/config", 2u);
+
+	// Look for the path of a request without copying it into a temporary key
+	const char request[] = "/config?id=3";
+	uint16_t route = 0u;
+	if (route_map.get(request, 7u, route))
+	{
+		std::cout << "Route : " << route << std::endl;
+	}
+
+	static StaticSlimMap<StaticString<15u>, uint16_t, 10u> word_map;
+
+	// Non-ASCII keys (UTF-8 encoded) : cafe, ete and euro with their accents/symbol
+	word_map.add("apple", 1u);
+	word_map.add("caf\xC3\xA9", 2u);
+	word_map.add("\xC3\xA9t\xC3\xA9", 3u);
+	word_map.add("\xE2\x82\xACuro", 4u);
+
+	// Look for the words of a text without copying them into temporary keys
+	const char text[] = "\xE2\x82\xACuro \xC3\xA9t\xC3\xA9 caf\xC3\xA9";
+	uint16_t word = 0u;
+	if (word_map.get(&text[0u], 6u, word) && word_map.containsKey(&text[7u], 5u) && word_map.containsKey(&text[13u], 5u))
+	{
+		std::cout << "Word : " << word << std::endl;
+	}
+}
+
+/** \brief Demo of flat map container */
+static void DEMO_FlatMap()
+{
+	static StaticFlatMap<uint16_t, const char*, 15u> int_map;
+
+	int_map.add(200u, "200");
+	int_map.add(100u, "100");
+	int_map.add(300u, "300");
+	int_map.add(50u, "50");
+	int_map.add(150u, "150");
+
+	int_map.remove(100u);
+
+	DisplayContents<const char*>(int_map);
+}
+
+/** \brief Demo of B+tree map container */
+static void DEMO_BTree()
+{
+	static StaticBTree<uint32_t, const char*, 15u, 4u> int_map;
+
+	int_map.add(20u, "20");
+	int_map.add(10u, "10");
+	int_map.add(30u, "30");
+	int_map.add(5u, "5");
+	int_map.add(15u, "15");
+	int_map.add(25u, "25");
+	int_map.add(35u, "35");
+
+	int_map.remove(10u);
+
+	DisplayContents<const char*>(int_map);
+}
+
+/** \brief Demo of hash map container */
+static void DEMO_HashMap()
+{
+	static StaticHashMap<uint32_t, const char*, 15u> int_map;
+
+	int_map.add(2000u, "2000");
+	int_map.add(1000u, "1000");
+	int_map.add(3000u, "3000");
+	int_map.add(500u, "500");
+	int_map.add(1500u, "1500");
+
+	int_map.remove(1000u);
+
+	DisplayContents<const char*>(int_map);
+}
+
+/** \brief Demo of sorted index container used as the key index of a table */
+static void DEMO_SortedIndex()
+{
+	typedef StaticSortedIndex<uint32_t, 6u, SORTED_INDEX_EYTZINGER> PortIndex;
+	static const uint32_t ports[] = { 21u, 22u, 25u, 80u, 443u, 8080u };
+	static const char* const names[] = { "ftp", "ssh", "smtp", "http", "https", "http-alt" };
+	static PortIndex port_index;
+	static const char* services[PortIndex::SLOT_COUNT];
+
+	port_index.build(ports, 6u, [](const nano_stl_size_t rank, const nano_stl_size_t slot) { services[slot] = names[rank]; });
+
+	std::cout << "-------------------" << std::endl;
+	const nano_stl_size_t slot = port_index.find(443u);
+	if (slot != PortIndex::INVALID_SLOT)
+	{
+		std::cout << "443 => " << services[slot] << std::endl;
+	}
+	std::cout << "23 => " << (port_index.contains(23u) ? "found" : "not found") << std::endl;
+	std::cout << "Next after 100 => " << port_index.getKey(port_index.lowerBound(100u)) << std::endl;
+	std::cout << "-------------------" << std::endl;
+}
+
+// Check C++ version >= C++14
+#if (__cplusplus >= 201402L)
+
+/** \brief Items of the frozen map demo */
+static constexpr FrozenMapItem<const char*, uint8_t> s_http_methods[] = { {"GET", 1u}, {"POST", 2u}, {"PUT", 3u}, {"DELETE", 4u} };
+
+/** \brief Frozen map built at compile time */
+static constexpr StaticFrozenMap<const char*, uint8_t, 4u> s_http_methods_map(s_http_methods);
+
+/** \brief Demo of frozen map container */
+static void DEMO_FrozenMap()
+{
+	uint8_t method = 0u;
+
+	std::cout << "-------------------" << std::endl;
+	if (s_http_methods_map.get("PUT", method))
+	{
+		std::cout << "PUT => " << static_cast<int>(method) << std::endl;
+	}
+	std::cout << "DELETE => " << static_cast<int>(s_http_methods_map["DELETE"]) << std::endl;
+	std::cout << "PATCH => " << (s_http_methods_map.containsKey("PATCH") ? "found" : "not found") << std::endl;
+	std::cout << "-------------------" << std::endl;
+}
+
+#endif // __cplusplus
+
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+/** \brief Demo of containers statistics */
+static void DEMO_Stats()
+{
+	static StaticMap<uint16_t, uint16_t, 8u> int_map;
+	static StaticRingBuffer<uint8_t, 4u> int_ring_buffer;
+	static StaticString<128u> stats;
+
+	for (uint16_t i = 0u; i < 10u; i++)
+	{
+		int_map.add(static_cast<uint16_t>((i * 7u) % 10u), i);
+		int_ring_buffer.write(static_cast<uint8_t>(i));
+	}
+	int_map.containsKey(3u);
+	int_map.remove(0u);
+
+	std::cout << "-------------------" << std::endl;
+	int_map.dumpStats(stats);
+	std::cout << "map : " << stats.cStr() << std::endl;
+	int_ring_buffer.dumpStats(stats);
+	std::cout << "ring buffer : " << stats.cStr() << std::endl;
+	std::cout << "-------------------" << std::endl;
+}
+
+#endif // NANO_STL_STATS_ENABLED
+
 
 /** \brief Callback for delegate 1 */
 static uint16_t DELEGATE1_Callback(uint32_t event_data)
@@ -303,6 +491,21 @@ int main(void)
 	DEMO_Vector();
 	DEMO_List();
 	DEMO_Map();
+	DEMO_SlimMap();
+	DEMO_FlatMap();
+	DEMO_BTree();
+	DEMO_HashMap();
+	DEMO_SortedIndex();
+
+// Check C++ version >= C++14
+#if (__cplusplus >= 201402L)
+	DEMO_FrozenMap();
+#endif // __cplusplus
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+	DEMO_Stats();
+#endif // NANO_STL_STATS_ENABLED
 
 	DEMO_Delegates();
 	DEMO_Events();
@@ -67,6 +67,32 @@ typedef uint32_t nano_stl_size_t;
 /** \brief Enable item access checking (prevent segfault when wrongly access container item but increase code size and decrease performances) */
 #define NANO_STL_ITEM_ACCESS_CHECK_ENABLE               1
 
+/** \brief Enable the containers usage statistics (high-water count, failed insertions, ring buffer overwrites, binary search tree 
+ *         search depth, see IContainerStats) to size the containers capacities (increase RAM usage and decrease performances) */
+#define NANO_STL_STATS_ENABLED                          1
+
+/** \brief Enable the self-balancing (red-black) of the binary search trees and maps : guarantees O(log n) add/get/remove even when 
+ *         the keys are added in order (increase RAM usage by a color per node and slightly increase code size) */
+#define NANO_STL_BSTREE_BALANCING_ENABLED               1
+
+/** \brief Enable the index links between the nodes of the binary search trees and maps : the links are stored as 8, 16 or 32 bits 
+ *         indexes depending on the maximum node count instead of pointers (reduce RAM usage and makes the nodes arrays position 
+ *         independent so that they can be copied with memcpy, but slightly decrease performances) */
+#define NANO_STL_INDEX_LINKS_ENABLED                    1
+
+/** \brief Enable the split layout of the binary search trees and maps : the keys and the links are stored in the nodes array and 
+ *         the items in a parallel array so that the searches only load the keys and links (faster searches with large items, 
+ *         but an additional cache miss to read the item when it is found) */
+#define NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED            0
+
+/** \brief Prefetch macro definition : hint the CPU to load the cache line of an address which will be read soon 
+ *         (used by the searches of the sorted indexes, leave it empty if the compiler has no prefetch builtin) */
+#if defined(__GNUC__)
+#define NANO_STL_PREFETCH(address)  __builtin_prefetch((address))
+#else
+#define NANO_STL_PREFETCH(address)
+#endif // __GNUC__
+
 
 
 
@@ -113,6 +139,27 @@ typedef uint32_t nano_stl_size_t;
 #endif // __cplusplus
 */
 
+/** \brief Enable the word at a time implementation of the internal Nano-STL memory functions (Memset, Memcpy, Memcmp)
+ *         (increase code size but greatly improve performances on buffers larger than a few machine words) */
+#define NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED     1
+
+/** \brief Enable the word at a time implementation of the internal Nano-STL string functions (Strnlen, Strncmp, Strncpy, Strncat)
+ *         (increase code size but greatly improve performances on strings longer than a few machine words) */
+#define NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED     1
+
+/** \brief Enable the SIMD (SSE2/AVX2) implementation of the internal Nano-STL Memset, Memcpy, Memcmp, Strncmp and Strnlen functions
+ *         (the instruction set is selected at startup depending on the CPU, only available with GCC on x86 CPUs) */
+#define NANO_STL_LIBC_SIMD_ENABLED                      1
+
+/** \brief Enable the floating point conversions (%f, %e, %g) of the internal Nano-STL Vsnprintf function and the Dtoa function
+ *         (increase code size and uses around 1kB of stack while formatting a floating point number) */
+#define NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED          1
+
+/** \brief Enable the Eisel-Lemire fast path of the internal Nano-STL Atof and Antof functions
+ *         (adds a 5kB table of powers of five, without it the values which are not handled by the exact double arithmetic fast path
+ *          are converted by the much slower exact big integers algorithm) */
+#define NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED        1
+
 #include "nano-stl-libc.h"
 
 /** \brief Memset macro definition */
@@ -22,42 +22,183 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "IBSTree.h"
 #include "IErrorHandler.h"
+#include "ContainerStats.h"
+#include "NodeIndex.h"
+#include "Compare.h"
+#include "StringRef.h"
 
 namespace nano_stl
 {
 
-/** \brief Base class for all binary search tree implementations */
-template <typename KeyType, typename ItemType>
+/** \brief Base class for all binary search tree implementations 
+ *         (IndexType is the type of the links between the nodes when the index links are enabled, 
+ *          ComparatorType is the three-way comparator of the keys)
+*/
+template <typename KeyType, typename ItemType, typename IndexType = nano_stl_size_t, typename ComparatorType = Compare<KeyType> >
 class BSTreeBase : public IBSTree<KeyType, ItemType>
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+                 , public ContainerStats
+#endif // NANO_STL_STATS_ENABLED
 {
     public:
+
+        // Node forward declaration
+        struct Node;
+
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+        /** \brief Link to a node : index of the node in the nodes array */
+        typedef IndexType Link;
+
+#else
+
+        /** \brief Link to a node : pointer to the node */
+        typedef Node* Link;
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
         
         /** \brief Binary search tree node */
         struct Node
         {
             /** \brief Key */
             KeyType key;
+
+// Check if the split layout is disabled
+#if (NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED == 0)
+
             /** \brief Item */
             ItemType item;
+
+#endif // NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED
+
             /** \brief Left node */
-            Node* left;
+            Link left;
             /** \brief Right node */
-            Node* right;
+            Link right;
+            /** \brief Parent node */
+            Link parent;
+
+// Check if the self-balancing is enabled
+#if (NANO_STL_BSTREE_BALANCING_ENABLED == 1)
+
+            /** \brief Red-black color of the node */
+            bool red;
+
+#endif // NANO_STL_BSTREE_BALANCING_ENABLED
         };
 
+        /** \brief Iterator on the nodes of the binary search tree in ascending key order 
+         *         (the iterator becomes invalid after the last node or after the maximum key of a bounded range) */
+        template <typename NodeType, typename ItemRefType>
+        class RangeIteratorBase
+        {
+            public:
+
+                /** \brief Constructor */
+                RangeIteratorBase(const BSTreeBase& bstree, NodeType* const node)
+                : m_bstree(&bstree)
+                , m_node(node)
+                , m_bounded(false)
+                , m_max_key()
+                {}
+
+                /** \brief Constructor of a range bounded by a maximum key */
+                RangeIteratorBase(const BSTreeBase& bstree, NodeType* const node, const KeyType& max_key)
+                : m_bstree(&bstree)
+                , m_node(node)
+                , m_bounded(true)
+                , m_max_key(max_key)
+                {
+                    checkBound();
+                }
+
+                /** \brief Check if the iterator points to a node */
+                bool isValid() const { return (m_node != nullptr); }
+
+                /** \brief Get the key of the current node */
+                const KeyType& getKey() const { return m_node->key; }
+
+                /** \brief Get the item of the current node */
+                ItemRefType& operator * () const { return m_bstree->getItem(m_node); }
+
+                /** \brief Move to the node with the next key in ascending order */
+                void operator ++ ()
+                {
+                    m_node = m_bstree->getNext(m_node);
+                    checkBound();
+                }
+
+            private:
+
+                /** \brief Binary search tree */
+                const BSTreeBase* m_bstree;
+
+                /** \brief Current node */
+                NodeType* m_node;
+
+                /** \brief Indicate if the range is bounded by a maximum key */
+                bool m_bounded;
+
+                /** \brief Maximum key of the range */
+                KeyType m_max_key;
+
+
+                /** \brief Invalidate the iterator if the current node is after the maximum key of the range */
+                void checkBound()
+                {
+                    if (m_bounded && (m_node != nullptr) && (m_bstree->m_comparator(m_node->key, m_max_key) > 0))
+                    {
+                        m_node = nullptr;
+                    }
+                }
+        };
+
+        /** \brief Iterator on the nodes in ascending key order */
+        typedef RangeIteratorBase<Node, ItemType> RangeIterator;
+
+        /** \brief Const iterator on the nodes in ascending key order */
+        typedef RangeIteratorBase<const Node, const ItemType> ConstRangeIterator;
+
+
+        /** \brief Constructor (the items array is only needed when the split layout is enabled) */
+        BSTreeBase(Node* const nodes, 
+
+// Check if the split layout is enabled
+#if (NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED == 1)
+
+                   ItemType* const items,
+
+#endif // NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED
+
+                   const nano_stl_size_t size)
+        :
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+          ContainerStats(m_count, size),
+
+#endif // NANO_STL_STATS_ENABLED
+
+          m_nodes(nodes)
+
+// Check if the split layout is enabled
+#if (NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED == 1)
+
+        , m_items(items)
+
+#endif // NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED
 
-        /** \brief Constructor */
-        BSTreeBase(Node* const nodes, const nano_stl_size_t size)
-        : m_nodes(nodes)
         , m_size(size)
         , m_count(0u)
+        , m_used_count(0u)
         , m_root(nullptr)
-        , m_first_free(nodes)
+        , m_first_free(nullptr)
         , m_last_modified(nullptr)
-        {
-            // Initialize free list
-            initFreeList();
-        }
+        , m_comparator()
+        {}
 
 
         ////// Implementation of IContainer interface //////
@@ -69,14 +210,21 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
         /** \brief Get the number of objects that the container contains */
         virtual nano_stl_size_t getCount() const override { return m_count; }
 
-        /** \brief Check if the container contains an item */
+        /** \brief Check if the container contains an item 
+         *         (iterative scan of the occupied nodes of the pool, it stops as soon as all of them have been visited) */
         virtual bool contains(const ItemType& item) const override
         {
             bool contains = false;
+            nano_stl_size_t remaining = m_count;
 
-            if (m_root != nullptr)
+            for (nano_stl_size_t i = 0u; !contains && (remaining != 0u); i++)
             {
-                contains = nodeContains(m_root, item);
+                const Node* const node = &m_nodes[i];
+                if (!isFree(node))
+                {
+                    contains = (getItem(node) == item);
+                    remaining--;
+                }
             }
 
             return contains;
@@ -94,7 +242,7 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
             Node* parent = nullptr;
             if (lookForKey(key, current, parent, left))
             {
-                return current->item;
+                return getItem(current);
             }
             else
             {
@@ -111,7 +259,7 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
             Node* parent = nullptr;
             if (lookForKey(key, current, parent, left))
             {
-                return current->item;
+                return getItem(current);
             }
             else
             {
@@ -126,7 +274,7 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
             bool ret = false;
 
             // Check for free space
-            if (m_first_free != nullptr)
+            if (hasFreeNode())
             {
                 // Look for the key
                 bool left = false;
@@ -135,17 +283,20 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
                 const bool found = lookForKey(key, current, parent, left);
                 if (!found)
                 {
-                    Node* const new_node = m_first_free;
-                    m_last_modified = &new_node->item;
-
-                    // Remove node from free list
-                    m_first_free = m_first_free->right;
+                    Node* const new_node = allocateNode();
+                    m_last_modified = &getItem(new_node);
 
                     // Init node
                     new_node->key = key;
-                    new_node->item = item;
-                    new_node->left = nullptr;
-                    new_node->right = nullptr;
+                    getItem(new_node) = item;
+                    setLeft(new_node, nullptr);
+                    setRight(new_node, nullptr);
+                    setParent(new_node, parent);
+
+                    // Check if the self-balancing is enabled
+                    #if (NANO_STL_BSTREE_BALANCING_ENABLED == 1)
+                    new_node->red = true;
+                    #endif // NANO_STL_BSTREE_BALANCING_ENABLED
 
                     if (parent == nullptr)
                     {
@@ -155,14 +306,19 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
                     {
                         if (left)
                         {
-                            parent->left = new_node;
+                            setLeft(parent, new_node);
                         }
                         else
                         {
-                            parent->right = new_node;
+                            setRight(parent, new_node);
                         }
                     }
 
+                    // Check if the self-balancing is enabled
+                    #if (NANO_STL_BSTREE_BALANCING_ENABLED == 1)
+                    addFixup(new_node);
+                    #endif // NANO_STL_BSTREE_BALANCING_ENABLED
+
                     // Update count
                     m_count++;
 
@@ -170,6 +326,14 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
                 }
             }
 
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            if (ret || !hasFreeNode())
+            {
+                ContainerStats::recordInsert(ret);
+            }
+            #endif // NANO_STL_STATS_ENABLED
+
             return ret;
         }
 
@@ -193,12 +357,83 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
             if (found)
             {
                 // Update item value
-                item = current->item;
+                item = getItem(current);
             }
 
             return found;
         }
 
+        /** \brief Look for an item in the binary search tree (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual ItemType* find(const KeyType& key) override
+        {
+            bool left = false;
+            Node* current = nullptr;
+            Node* parent = nullptr;
+            return (lookForKey(key, current, parent, left) ? &getItem(current) : nullptr);
+        }
+
+        /** \brief Look for an item in the binary search tree (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual const ItemType* find(const KeyType& key) const override
+        {
+            bool left = false;
+            Node* current = nullptr;
+            Node* parent = nullptr;
+            return (lookForKey(key, current, parent, left) ? &getItem(current) : nullptr);
+        }
+
+        /** \brief Check if the binary search tree contains a string key given by its characters and its length 
+         *         (heterogeneous lookup : no temporary key is built, the comparator must accept a StringRef as first key) */
+        bool containsKey(const char* const key, const nano_stl_size_t length) const
+        {
+            return (find(key, length) != nullptr);
+        }
+
+        /** \brief Get an item from the binary search tree with a string key given by its characters and its length 
+         *         (heterogeneous lookup : no temporary key is built, the comparator must accept a StringRef as first key) */
+        bool get(const char* const key, const nano_stl_size_t length, ItemType& item) const
+        {
+            const ItemType* const found_item = find(key, length);
+            if (found_item != nullptr)
+            {
+                // Update item value
+                item = (*found_item);
+            }
+
+            return (found_item != nullptr);
+        }
+
+        /** \brief Look for an item with a string key given by its characters and its length 
+         *         (heterogeneous lookup : no temporary key is built, the comparator must accept a StringRef as first key) */
+        ItemType* find(const char* const key, const nano_stl_size_t length)
+        {
+            bool left = false;
+            Node* current = nullptr;
+            Node* parent = nullptr;
+            return (lookForKey(StringRef(key, length), current, parent, left) ? &getItem(current) : nullptr);
+        }
+
+        /** \brief Look for an item with a string key given by its characters and its length 
+         *         (heterogeneous lookup : no temporary key is built, the comparator must accept a StringRef as first key) */
+        const ItemType* find(const char* const key, const nano_stl_size_t length) const
+        {
+            bool left = false;
+            Node* current = nullptr;
+            Node* parent = nullptr;
+            return (lookForKey(StringRef(key, length), current, parent, left) ? &getItem(current) : nullptr);
+        }
+
+        /** \brief Look for a stored key which compares equal to a lookup key of another type (heterogeneous lookup : 
+         *         the comparator must provide an operator () (const LookupKeyType&, const KeyType&) consistent with the 
+         *         order of the keys, if several stored keys compare equal to the lookup key any of them is returned) */
+        template <typename LookupKeyType>
+        const KeyType* findEquivalentKey(const LookupKeyType& key) const
+        {
+            bool left = false;
+            Node* current = nullptr;
+            Node* parent = nullptr;
+            return (lookForKey(key, current, parent, left) ? &current->key : nullptr);
+        }
+
         /** \brief Remove an item from the binary search tree */
         virtual bool remove(const KeyType& key) override
         {
@@ -209,49 +444,62 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
             const bool found = lookForKey(key, current, parent, left);
             if (found)
             {
+                // Check if the self-balancing is enabled
+                #if (NANO_STL_BSTREE_BALANCING_ENABLED == 1)
+                (void)parent;
+                (void)left;
+                removeBalanced(current);
+                #else
                 // Remove item node
                 Node* child = nullptr;
-                if (current->right == nullptr)
+                if (getRight(current) == nullptr)
                 {
-                    child = current->left;
+                    child = getLeft(current);
                 }
                 else
                 {
-                    child = current->right;
-                    if (current->left != nullptr)
+                    child = getRight(current);
+                    if (getLeft(current) != nullptr)
                     {
-                        Node* previous = current->right;
-                        Node* most_left_node = current->right->left;
+                        Node* previous = getRight(current);
+                        Node* most_left_node = getLeft(previous);
                         while (most_left_node != nullptr)
                         {
                             previous = most_left_node;
-                            most_left_node = most_left_node->left;
+                            most_left_node = getLeft(most_left_node);
                         }
-                        previous->left = current->left;
+                        setLeft(previous, getLeft(current));
+                        setParent(getLeft(current), previous);
                     }
                 }
 
                 // Affect new child node to parent
+                if (child != nullptr)
+                {
+                    setParent(child, parent);
+                }
                 if (parent != nullptr)
                 {
                     if (left)
                     {
-                        parent->left = child;
+                        setLeft(parent, child);
                     }
                     else
                     {
-                        parent->right = child;
+                        setRight(parent, child);
                     }
                 }
                 else
                 {
                     m_root = child;
                 }
+                #endif // NANO_STL_BSTREE_BALANCING_ENABLED
 
                 // Add deleted node to the free list
-                current->right = m_first_free;
+                setFree(current);
+                setRight(current, m_first_free);
                 m_first_free = current;
-                m_last_modified = &current->item;
+                m_last_modified = &getItem(current);
 
                 // Update count
                 m_count--;
@@ -265,8 +513,8 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
         {
             if (m_count != 0u)
             {
-                // Put back all the nodes into the free list
-                initFreeList();
+                // All the nodes are free again
+                resetFreeNodes();
 
                 // Clear list
                 m_count = 0u;
@@ -281,62 +529,320 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
         /** \brief Get the last item which has been modified */
         virtual const ItemType* getLastModified() const override { return m_last_modified; }
 
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+        /** \brief Get the usage statistics of the binary search tree */
+        virtual IContainerStats& getStats() override { return (*this); }
+
+#endif // NANO_STL_STATS_ENABLED
+
+
+        ////// Bulk assignment //////
+
+
+        /** \brief Replace the contents of the binary search tree by items sorted in strictly ascending key order 
+         *         (the balanced tree is built in O(n) without any key search, the tree is left unchanged if the keys 
+         *          are not strictly ascending or if there are more items than the capacity) */
+        bool assignSorted(const KeyType* const keys, const ItemType* const items, const nano_stl_size_t count)
+        {
+            return assignSorted(keys, count, ItemsCopier(items));
+        }
+
+        /** \brief Replace the contents of the binary search tree by keys sorted in strictly ascending order
+         *         (the balanced tree is built in O(n) without any key search, the initializer is then called with 
+         *          the index and a reference to the item of each key in ascending key order, the tree is left unchanged 
+         *          if the keys are not strictly ascending or if there are more keys than the capacity) */
+        template <typename InitializerType>
+        bool assignSorted(const KeyType* const keys, const nano_stl_size_t count, InitializerType initializer)
+        {
+            // Check the keys
+            bool ret = (count <= m_size);
+            for (nano_stl_size_t i = 1u; ret && (i < count); i++)
+            {
+                ret = (m_comparator(keys[i - 1u], keys[i]) < 0);
+            }
+            if (ret)
+            {
+                // The Nth key is stored in the Nth node, the remaining nodes have never been used
+                m_first_free = nullptr;
+                m_used_count = count;
+                for (nano_stl_size_t i = 0u; i < count; i++)
+                {
+                    m_nodes[i].key = keys[i];
+                    initializer(i, getItem(&m_nodes[i]));
+                }
+
+                // Link the nodes, the deepest level is red when the self-balancing is enabled
+                nano_stl_size_t max_depth = 0u;
+                for (nano_stl_size_t n = count; n > 1u; n >>= 1u)
+                {
+                    max_depth++;
+                }
+                m_root = buildSorted(0u, count, 0u, max_depth, nullptr);
+                m_count = count;
+                m_last_modified = ((count != 0u) ? &getItem(&m_nodes[0u]) : nullptr);
+            }
+
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            if (ret || (count > m_size))
+            {
+                ContainerStats::recordInsert(ret);
+            }
+            #endif // NANO_STL_STATS_ENABLED
+
+            return ret;
+        }
+
+
+        ////// Ordered queries //////
+
+
+        /** \brief Get an iterator on the node with the smallest key */
+        RangeIterator first() { return RangeIterator(*this, getMinimum()); }
+
+        /** \brief Get an iterator on the node with the smallest key */
+        ConstRangeIterator first() const { return ConstRangeIterator(*this, getMinimum()); }
+
+        /** \brief Get an iterator on the first node whose key is not less than a key */
+        RangeIterator lowerBound(const KeyType& key) { return RangeIterator(*this, getLowerBound(key)); }
+
+        /** \brief Get an iterator on the first node whose key is not less than a key */
+        ConstRangeIterator lowerBound(const KeyType& key) const { return ConstRangeIterator(*this, getLowerBound(key)); }
+
+        /** \brief Get an iterator on the first node whose key is greater than a key */
+        RangeIterator upperBound(const KeyType& key) { return RangeIterator(*this, getUpperBound(key)); }
+
+        /** \brief Get an iterator on the first node whose key is greater than a key */
+        ConstRangeIterator upperBound(const KeyType& key) const { return ConstRangeIterator(*this, getUpperBound(key)); }
+
+        /** \brief Get an iterator on the node with the greatest key less than or equal to a key */
+        RangeIterator floor(const KeyType& key) { return RangeIterator(*this, getFloor(key)); }
+
+        /** \brief Get an iterator on the node with the greatest key less than or equal to a key */
+        ConstRangeIterator floor(const KeyType& key) const { return ConstRangeIterator(*this, getFloor(key)); }
+
+        /** \brief Get an iterator on the node with the smallest key greater than or equal to a key (same as lowerBound) */
+        RangeIterator ceiling(const KeyType& key) { return lowerBound(key); }
+
+        /** \brief Get an iterator on the node with the smallest key greater than or equal to a key (same as lowerBound) */
+        ConstRangeIterator ceiling(const KeyType& key) const { return lowerBound(key); }
+
+        /** \brief Get an iterator on the nodes whose keys are in the [min_key, max_key] range */
+        RangeIterator range(const KeyType& min_key, const KeyType& max_key) { return RangeIterator(*this, getLowerBound(min_key), max_key); }
+
+        /** \brief Get an iterator on the nodes whose keys are in the [min_key, max_key] range */
+        ConstRangeIterator range(const KeyType& min_key, const KeyType& max_key) const { return ConstRangeIterator(*this, getLowerBound(min_key), max_key); }
+
 
     private:
 
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+        /** \brief Link value of a null node */
+        static const IndexType NULL_LINK = static_cast<IndexType>(-1);
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
+
+
         /** \brief Underlying C array */
         Node* const m_nodes;
 
+// Check if the split layout is enabled
+#if (NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED == 1)
+
+        /** \brief Underlying C array of the items (the item of a node is stored at the index of the node) */
+        ItemType* const m_items;
+
+#endif // NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED
+
         /** \brief Underlying C array size */
         const nano_stl_size_t m_size;
 
         /** \brief Node count */
         nano_stl_size_t m_count;
 
+        /** \brief Number of nodes of the underlying C array which have been used at least once since the last clear */
+        nano_stl_size_t m_used_count;
+
         /** \brief Root node */
         Node* m_root;
 
-        /** \brief First free node */
+        /** \brief First free node (removed nodes are chained through their right link, the nodes which have never 
+         *         been used since the last clear are not chained) */
         Node* m_first_free;
 
         /** \brief Last modified item */
         ItemType* m_last_modified;
 
+        /** \brief Keys comparator */
+        ComparatorType m_comparator;
+
+
+        /** \brief Initializer of the bulk assignment which copies the items from an array */
+        struct ItemsCopier
+        {
+            /** \brief Constructor */
+            ItemsCopier(const ItemType* const _items) : items(_items) {}
+
+            /** \brief Copy the item of the given index */
+            void operator () (const nano_stl_size_t index, ItemType& item) const { item = items[index]; }
+
+            /** \brief Items to copy */
+            const ItemType* const items;
+        };
+
+
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+        /** \brief Get the node corresponding to a link */
+        Node* toNode(const Link link) const { return ((link == NULL_LINK) ? nullptr : &m_nodes[link]); }
+
+        /** \brief Get the link corresponding to a node */
+        Link toLink(const Node* const node) const { return ((node == nullptr) ? NULL_LINK : static_cast<Link>(node - m_nodes)); }
+
+#else
+
+        /** \brief Get the node corresponding to a link */
+        Node* toNode(const Link link) const { return link; }
+
+        /** \brief Get the link corresponding to a node */
+        Link toLink(Node* const node) const { return node; }
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
+
+// Check if the split layout is enabled
+#if (NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED == 1)
+
+        /** \brief Get the item of a node */
+        ItemType& getItem(Node* const node) const { return m_items[node - m_nodes]; }
+
+        /** \brief Get the item of a node */
+        const ItemType& getItem(const Node* const node) const { return m_items[node - m_nodes]; }
+
+#else
+
+        /** \brief Get the item of a node */
+        ItemType& getItem(Node* const node) const { return node->item; }
 
+        /** \brief Get the item of a node */
+        const ItemType& getItem(const Node* const node) const { return node->item; }
 
-        /** \brief Initializes the free nodes list */
-        void initFreeList()
+#endif // NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED
+
+        /** \brief Get the left child of a node */
+        Node* getLeft(const Node* const node) const { return toNode(node->left); }
+
+        /** \brief Get the right child of a node */
+        Node* getRight(const Node* const node) const { return toNode(node->right); }
+
+        /** \brief Set the left child of a node */
+        void setLeft(Node* const node, Node* const left) const { node->left = toLink(left); }
+
+        /** \brief Set the right child of a node */
+        void setRight(Node* const node, Node* const right) const { node->right = toLink(right); }
+
+        /** \brief Get the parent of a node */
+        Node* getParent(const Node* const node) const { return toNode(node->parent); }
+
+        /** \brief Set the parent of a node */
+        void setParent(Node* const node, Node* const parent) const { node->parent = toLink(parent); }
+
+        /** \brief Mark a node as free : the left link of a free node points to the node itself */
+        void setFree(Node* const node) const { setLeft(node, node); }
+
+        /** \brief Check if a node is free */
+        bool isFree(const Node* const node) const { return (getLeft(node) == node); }
+
+        /** \brief Make all the nodes free again */
+        void resetFreeNodes()
+        {
+            m_used_count = 0u;
+            m_first_free = nullptr;
+        }
+
+        /** \brief Check if a node can be allocated */
+        bool hasFreeNode() const { return ((m_first_free != nullptr) || (m_used_count != m_size)); }
+
+        /** \brief Allocate a node : a removed node if any, otherwise the first node which has never been used 
+         *         (the caller must check that a node is available) */
+        Node* allocateNode()
         {
-            // Put back all the nodes into the free list
-            m_first_free = m_nodes;
-            for (nano_stl_size_t i = 0; i < (m_size - 1u); i++)
+            Node* node = m_first_free;
+            if (node != nullptr)
+            {
+                m_first_free = getRight(node);
+            }
+            else
             {
-                m_first_free[i].right = &m_first_free[i+1];
+                node = &m_nodes[m_used_count];
+                m_used_count++;
             }
-            m_first_free[m_size - 1u].right = nullptr;
+            return node;
         }
 
-        /** \brief Look for a key in the binary search tree */
-        bool lookForKey(const KeyType& key, Node*& current, Node*& parent, bool& left) const
+        /** \brief Link the nodes of a [first, last[ range of sorted nodes as a balanced sub-tree and return its root */
+        Node* buildSorted(const nano_stl_size_t first, const nano_stl_size_t last, const nano_stl_size_t depth, const nano_stl_size_t max_depth, Node* const parent)
+        {
+            Node* node = nullptr;
+            if (first < last)
+            {
+                const nano_stl_size_t middle = first + ((last - first) / 2u);
+                node = &m_nodes[middle];
+                setLeft(node, buildSorted(first, middle, depth + 1u, max_depth, node));
+                setRight(node, buildSorted(middle + 1u, last, depth + 1u, max_depth, node));
+                setParent(node, parent);
+
+                // Check if the self-balancing is enabled
+                #if (NANO_STL_BSTREE_BALANCING_ENABLED == 1)
+                node->red = ((depth != 0u) && (depth == max_depth));
+                #else
+                (void)depth;
+                (void)max_depth;
+                #endif // NANO_STL_BSTREE_BALANCING_ENABLED
+            }
+
+            return node;
+        }
+
+        /** \brief Look for a key in the binary search tree 
+         *         (LookupKeyType is the key type or any type which can be compared to the keys by the comparator) */
+        template <typename LookupKeyType>
+        bool lookForKey(const LookupKeyType& key, Node*& current, Node*& parent, bool& left) const
         {
             bool found = false;
 
             left = false;
             parent = nullptr;
             current = m_root;
+
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            nano_stl_size_t depth = 0u;
+            #endif // NANO_STL_STATS_ENABLED
+
             while (!found && (current != nullptr))
             {
-                if (key > current->key)
+                // Check if containers statistics are enabled
+                #if (NANO_STL_STATS_ENABLED == 1)
+                depth++;
+                #endif // NANO_STL_STATS_ENABLED
+
+                const int compare = m_comparator(key, current->key);
+                if (compare > 0)
                 {
                     left = false;
                     parent = current;
-                    current = current->right;
+                    current = getRight(current);
                 }
-                else if (key < current->key)
+                else if (compare < 0)
                 {
                     left = true;
                     parent = current;
-                    current = current->left;
+                    current = getLeft(current);
                 }
                 else
                 {
@@ -344,34 +850,376 @@ class BSTreeBase : public IBSTree<KeyType, ItemType>
                 }
             }
 
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            ContainerStats::recordSearch(depth);
+            #endif // NANO_STL_STATS_ENABLED
+
             return found;
         }
 
-        /** \brief Recursivly checks if a node or its childs contains a specific item */
-        bool nodeContains(const Node* const node, const ItemType& item) const
+        /** \brief Get the node with the smallest key */
+        Node* getMinimum() const
         {
-            bool contains = false;
+            Node* current = m_root;
+            if (current != nullptr)
+            {
+                while (getLeft(current) != nullptr)
+                {
+                    current = getLeft(current);
+                }
+            }
+
+            return current;
+        }
+
+        /** \brief Get the first node whose key is not less than a key */
+        Node* getLowerBound(const KeyType& key) const
+        {
+            Node* bound = nullptr;
+            Node* current = m_root;
+            while (current != nullptr)
+            {
+                if (m_comparator(key, current->key) > 0)
+                {
+                    current = getRight(current);
+                }
+                else
+                {
+                    bound = current;
+                    current = getLeft(current);
+                }
+            }
+
+            return bound;
+        }
+
+        /** \brief Get the first node whose key is greater than a key */
+        Node* getUpperBound(const KeyType& key) const
+        {
+            Node* bound = nullptr;
+            Node* current = m_root;
+            while (current != nullptr)
+            {
+                if (m_comparator(key, current->key) < 0)
+                {
+                    bound = current;
+                    current = getLeft(current);
+                }
+                else
+                {
+                    current = getRight(current);
+                }
+            }
+
+            return bound;
+        }
+
+        /** \brief Get the node with the greatest key less than or equal to a key */
+        Node* getFloor(const KeyType& key) const
+        {
+            Node* bound = nullptr;
+            Node* current = m_root;
+            while (current != nullptr)
+            {
+                if (m_comparator(key, current->key) < 0)
+                {
+                    current = getLeft(current);
+                }
+                else
+                {
+                    bound = current;
+                    current = getRight(current);
+                }
+            }
+
+            return bound;
+        }
+
+        /** \brief Get the node with the next key in ascending order (O(1) amortized through the parent links) */
+        Node* getNext(const Node* const node) const
+        {
+            Node* next = getRight(node);
+            if (next != nullptr)
+            {
+                while (getLeft(next) != nullptr)
+                {
+                    next = getLeft(next);
+                }
+            }
+            else
+            {
+                const Node* child = node;
+                next = getParent(node);
+                while ((next != nullptr) && (child == getRight(next)))
+                {
+                    child = next;
+                    next = getParent(next);
+                }
+            }
+
+            return next;
+        }
+
+// Check if the self-balancing is enabled
+#if (NANO_STL_BSTREE_BALANCING_ENABLED == 1)
+
+        /** \brief Check if a node is red (null leaves are black) */
+        static bool isRed(const Node* const node) { return ((node != nullptr) && node->red); }
+
+        /** \brief Rotate a node to the left : its right child takes its place */
+        void rotateLeft(Node* const node)
+        {
+            Node* const child = getRight(node);
+            Node* const grand_child = getLeft(child);
+            setRight(node, grand_child);
+            if (grand_child != nullptr)
+            {
+                setParent(grand_child, node);
+            }
+            replaceChild(node, child);
+            setLeft(child, node);
+            setParent(node, child);
+        }
 
-            if (node->item == item)
+        /** \brief Rotate a node to the right : its left child takes its place */
+        void rotateRight(Node* const node)
+        {
+            Node* const child = getLeft(node);
+            Node* const grand_child = getRight(child);
+            setLeft(node, grand_child);
+            if (grand_child != nullptr)
             {
-                contains = true;
+                setParent(grand_child, node);
+            }
+            replaceChild(node, child);
+            setRight(child, node);
+            setParent(node, child);
+        }
+
+        /** \brief Replace a node by another node (or by an empty leaf) in its parent */
+        void replaceChild(Node* const node, Node* const new_node)
+        {
+            Node* const parent = getParent(node);
+            if (parent == nullptr)
+            {
+                m_root = new_node;
+            }
+            else if (getLeft(parent) == node)
+            {
+                setLeft(parent, new_node);
             }
             else
             {
-                if (node->left != nullptr)
+                setRight(parent, new_node);
+            }
+            if (new_node != nullptr)
+            {
+                setParent(new_node, parent);
+            }
+        }
+
+        /** \brief Restore the red-black properties after the insertion of a red node */
+        void addFixup(Node* node)
+        {
+            Node* parent = getParent(node);
+            while (isRed(parent))
+            {
+                // The parent is red so it is not the root and the grand parent exists
+                Node* const grand_parent = getParent(parent);
+                if (parent == getLeft(grand_parent))
                 {
-                    contains = nodeContains(node->left, item);
+                    Node* const uncle = getRight(grand_parent);
+                    if (isRed(uncle))
+                    {
+                        parent->red = false;
+                        uncle->red = false;
+                        grand_parent->red = true;
+                        node = grand_parent;
+                    }
+                    else
+                    {
+                        if (node == getRight(parent))
+                        {
+                            node = parent;
+                            rotateLeft(node);
+                            parent = getParent(node);
+                        }
+                        parent->red = false;
+                        grand_parent->red = true;
+                        rotateRight(grand_parent);
+                    }
                 }
-                if (!contains && (node->right != nullptr))
+                else
                 {
-                    contains = nodeContains(node->right, item);
+                    Node* const uncle = getLeft(grand_parent);
+                    if (isRed(uncle))
+                    {
+                        parent->red = false;
+                        uncle->red = false;
+                        grand_parent->red = true;
+                        node = grand_parent;
+                    }
+                    else
+                    {
+                        if (node == getLeft(parent))
+                        {
+                            node = parent;
+                            rotateRight(node);
+                            parent = getParent(node);
+                        }
+                        parent->red = false;
+                        grand_parent->red = true;
+                        rotateLeft(grand_parent);
+                    }
                 }
+                parent = getParent(node);
             }
+            m_root->red = false;
+        }
 
-            return contains;
+        /** \brief Unlink a node from the red-black tree 
+         *         (the nodes are relinked instead of moving the items so that the items of the other nodes keep their address) */
+        void removeBalanced(Node* const node)
+        {
+            Node* child = nullptr;
+            Node* child_parent = nullptr;
+            bool removed_red = node->red;
+
+            if (getLeft(node) == nullptr)
+            {
+                child = getRight(node);
+                child_parent = getParent(node);
+                replaceChild(node, child);
+            }
+            else if (getRight(node) == nullptr)
+            {
+                child = getLeft(node);
+                child_parent = getParent(node);
+                replaceChild(node, child);
+            }
+            else
+            {
+                // Replace the node by its successor
+                Node* successor = getRight(node);
+                while (getLeft(successor) != nullptr)
+                {
+                    successor = getLeft(successor);
+                }
+                removed_red = successor->red;
+                child = getRight(successor);
+                if (getParent(successor) == node)
+                {
+                    child_parent = successor;
+                }
+                else
+                {
+                    child_parent = getParent(successor);
+                    replaceChild(successor, child);
+                    setRight(successor, getRight(node));
+                    setParent(getRight(successor), successor);
+                }
+                replaceChild(node, successor);
+                setLeft(successor, getLeft(node));
+                setParent(getLeft(successor), successor);
+                successor->red = node->red;
+            }
+
+            if (!removed_red)
+            {
+                removeFixup(child, child_parent);
+            }
         }
+
+        /** \brief Restore the red-black properties after the removal of a black node */
+        void removeFixup(Node* node, Node* parent)
+        {
+            while ((node != m_root) && !isRed(node))
+            {
+                // The removed node was black so the sibling exists
+                if (node == getLeft(parent))
+                {
+                    Node* sibling = getRight(parent);
+                    if (sibling->red)
+                    {
+                        sibling->red = false;
+                        parent->red = true;
+                        rotateLeft(parent);
+                        sibling = getRight(parent);
+                    }
+                    if (!isRed(getLeft(sibling)) && !isRed(getRight(sibling)))
+                    {
+                        sibling->red = true;
+                        node = parent;
+                        parent = getParent(node);
+                    }
+                    else
+                    {
+                        if (!isRed(getRight(sibling)))
+                        {
+                            getLeft(sibling)->red = false;
+                            sibling->red = true;
+                            rotateRight(sibling);
+                            sibling = getRight(parent);
+                        }
+                        sibling->red = parent->red;
+                        parent->red = false;
+                        getRight(sibling)->red = false;
+                        rotateLeft(parent);
+                        node = m_root;
+                    }
+                }
+                else
+                {
+                    Node* sibling = getLeft(parent);
+                    if (sibling->red)
+                    {
+                        sibling->red = false;
+                        parent->red = true;
+                        rotateRight(parent);
+                        sibling = getLeft(parent);
+                    }
+                    if (!isRed(getLeft(sibling)) && !isRed(getRight(sibling)))
+                    {
+                        sibling->red = true;
+                        node = parent;
+                        parent = getParent(node);
+                    }
+                    else
+                    {
+                        if (!isRed(getLeft(sibling)))
+                        {
+                            getRight(sibling)->red = false;
+                            sibling->red = true;
+                            rotateLeft(sibling);
+                            sibling = getLeft(parent);
+                        }
+                        sibling->red = parent->red;
+                        parent->red = false;
+                        getLeft(sibling)->red = false;
+                        rotateRight(parent);
+                        node = m_root;
+                    }
+                }
+            }
+            if (node != nullptr)
+            {
+                node->red = false;
+            }
+        }
+
+#endif // NANO_STL_BSTREE_BALANCING_ENABLED
 };
 
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+/** \brief Link value of a null node */
+template <typename KeyType, typename ItemType, typename IndexType, typename ComparatorType>
+const IndexType BSTreeBase<KeyType, ItemType, IndexType, ComparatorType>::NULL_LINK;
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
+
 }
 
 #endif // BSTREEBASE_H
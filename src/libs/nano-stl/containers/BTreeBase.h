@@ -0,0 +1,1026 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef BTREEBASE_H
+#define BTREEBASE_H
+
+#include "IMap.h"
+#include "IErrorHandler.h"
+#include "ContainerStats.h"
+#include "NodeIndex.h"
+
+namespace nano_stl
+{
+
+/** \brief Base class for all B+tree maps implementations 
+ *         The keys are stored in nodes of NODE_KEY_COUNT keys (sized by default so that the keys of a node fill a 
+ *         64 bytes cache line) : a key search costs one cache miss per level of a shallow tree instead of one per 
+ *         level of a binary tree. The leaves are linked together and the items are linked in the keys order so that 
+ *         the iterators walk through the items in the keys order.
+ *         IndexType is the type of the indexes of the nodes and of the items, the number of keys of a node is stored 
+ *         on the smallest type able to hold NODE_KEY_COUNT.
+*/
+template <typename KeyType, typename ItemType, typename IndexType, nano_stl_size_t NODE_KEY_COUNT>
+class BTreeBase : public IMap<KeyType, ItemType>
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+                , public ContainerStats
+#endif // NANO_STL_STATS_ENABLED
+{
+    public:
+
+        /** \brief Map entry */
+        typedef typename IMap<KeyType, ItemType>::Node Entry;
+
+        /** \brief Type of the number of keys of a node */
+        typedef typename NodeIndex<NODE_KEY_COUNT + 1u>::Type KeyCount;
+
+        /** \brief Leaf node : keys and indexes of the corresponding entries */
+        struct Leaf
+        {
+            /** \brief Keys */
+            KeyType keys[NODE_KEY_COUNT];
+            /** \brief Indexes of the entries */
+            IndexType entries[NODE_KEY_COUNT];
+            /** \brief Number of keys */
+            KeyCount count;
+            /** \brief Index of the next leaf */
+            IndexType next;
+        };
+
+        /** \brief Inner node : separator keys and indexes of the children (the keys of children[i + 1] are not less than keys[i]) */
+        struct Inner
+        {
+            /** \brief Separator keys */
+            KeyType keys[NODE_KEY_COUNT];
+            /** \brief Indexes of the children */
+            IndexType children[NODE_KEY_COUNT + 1u];
+            /** \brief Number of keys */
+            KeyCount count;
+        };
+
+
+        /** \brief Constructor */
+        BTreeBase(Entry* const entries, const nano_stl_size_t size, Leaf* const leaves, const nano_stl_size_t leaf_count, 
+                  Inner* const inners, const nano_stl_size_t inner_count)
+        :
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+          ContainerStats(m_count, size),
+
+#endif // NANO_STL_STATS_ENABLED
+
+          m_entries(entries)
+        , m_size(size)
+        , m_leaves(leaves)
+        , m_leaf_count(leaf_count)
+        , m_inners(inners)
+        , m_inner_count(inner_count)
+        , m_count(0u)
+        , m_used_entry_count(0u)
+        , m_used_leaf_count(0u)
+        , m_used_inner_count(0u)
+        , m_free_entry(nullptr)
+        , m_free_leaf(NULL_INDEX)
+        , m_free_inner(NULL_INDEX)
+        , m_root(NULL_INDEX)
+        , m_height(0u)
+        , m_first(nullptr)
+        , m_last(nullptr)
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        , m_begin(*this, nullptr)
+        , m_end(*this, nullptr)
+        , m_it(*this, nullptr)
+        , m_const_begin(m_begin)
+        , m_const_end(m_end)
+        , m_const_it(m_it)
+        , m_pconst_it(&m_const_it)
+        
+#endif // NANO_STL_ITERATORS_ENABLED
+        {}
+
+
+        ////// Implementation of IContainer interface //////
+
+
+        /** \brief Get the number of objects that the container can handle */
+        virtual nano_stl_size_t getCapacity() const override { return m_size; }
+
+        /** \brief Get the number of objects that the container contains */
+        virtual nano_stl_size_t getCount() const override { return m_count; }
+
+        /** \brief Check if the container contains an item */
+        virtual bool contains(const ItemType& item) const override
+        {
+            bool found = false;
+
+            for (const Entry* entry = m_first; !found && (entry != nullptr); entry = entry->next)
+            {
+                found = (entry->item == item);
+            }
+
+            return found;
+        }
+
+
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        ////// Implementation of IIterable interface //////
+
+
+        /** \brief Get the iterator which points to the start of the container */
+        virtual const IIterator<ItemType>& begin() const override { return m_begin; }
+
+        /** \brief Get the iterator which points to the end of the container */
+        virtual const IIterator<ItemType>& end() const override { return m_end; }
+
+        /** \brief Get the iterator of the container */
+        virtual IIterator<ItemType>& it() override { begin(m_it); return m_it; }
+
+        /** \brief Get the const iterator which points to the start of the container */
+        virtual const IConstIterator<ItemType>& cbegin() const override { return m_const_begin; }
+
+        /** \brief Get the const iterator which points to the end of the container */
+        virtual const IConstIterator<ItemType>& cend() const override { return m_const_end; }
+
+        /** \brief Get the const iterator of the container */
+        virtual IConstIterator<ItemType>& const_it() const override { cbegin(*m_pconst_it); return (*m_pconst_it); }
+
+#endif // NANO_STL_ITERATORS_ENABLED
+
+
+        ////// Implementation of IMap interface //////
+        
+
+        /** \brief Get the item corresponding to a key */
+        virtual ItemType& operator [] (const KeyType& key) override
+        {
+            Entry* const entry = lookForKey(key);
+            if (entry != nullptr)
+            {
+                return entry->item;
+            }
+            else
+            {
+                NANO_STL_CRITICAL_ERROR();
+                return (*reinterpret_cast<ItemType*>(0));
+            }
+        }
+
+        /** \brief Get the item corresponding to a key */
+        virtual const ItemType& operator [] (const KeyType& key) const override
+        {
+            const Entry* const entry = lookForKey(key);
+            if (entry != nullptr)
+            {
+                return entry->item;
+            }
+            else
+            {
+                NANO_STL_CRITICAL_ERROR();
+                return (*reinterpret_cast<const ItemType*>(0));
+            }
+        }
+
+        /** \brief Add an item to the map */
+        virtual bool add(const KeyType& key, const ItemType& item) override
+        {
+            bool ret = false;
+
+            // Check for free space
+            if (m_count != m_size)
+            {
+                // Create the root leaf
+                if (m_root == NULL_INDEX)
+                {
+                    m_root = allocateLeaf();
+                    m_leaves[m_root].count = 0u;
+                    m_leaves[m_root].next = NULL_INDEX;
+                    m_height = 0u;
+                }
+
+                // Insert the key
+                KeyType split_key;
+                IndexType split_node = NULL_INDEX;
+                const InsertResult result = insert(m_root, m_height, key, item, split_key, split_node);
+                if (result == INSERT_SPLIT)
+                {
+                    // Grow the tree
+                    const IndexType root = allocateInner();
+                    Inner& inner = m_inners[root];
+                    inner.keys[0u] = split_key;
+                    inner.children[0u] = m_root;
+                    inner.children[1u] = split_node;
+                    inner.count = 1u;
+                    m_root = root;
+                    m_height++;
+                }
+                if (result != INSERT_EXISTS)
+                {
+                    // Update count
+                    m_count++;
+
+                    ret = true;
+                }
+            }
+
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            if (ret || (m_count == m_size))
+            {
+                ContainerStats::recordInsert(ret);
+            }
+            #endif // NANO_STL_STATS_ENABLED
+
+            return ret;
+        }
+
+        /** \brief Check if the map contains a specific key */
+        virtual bool containsKey(const KeyType& key) const override
+        {
+            return (lookForKey(key) != nullptr);
+        }
+
+        /** \brief Get an item from the map */
+        virtual bool get(const KeyType& key, ItemType& item) const override
+        {
+            const Entry* const entry = lookForKey(key);
+            const bool found = (entry != nullptr);
+            if (found)
+            {
+                item = entry->item;
+            }
+
+            return found;
+        }
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual ItemType* find(const KeyType& key) override
+        {
+            Entry* const entry = lookForKey(key);
+            return ((entry != nullptr) ? &entry->item : nullptr);
+        }
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual const ItemType* find(const KeyType& key) const override
+        {
+            const Entry* const entry = lookForKey(key);
+            return ((entry != nullptr) ? &entry->item : nullptr);
+        }
+
+        /** \brief Remove an item from the map */
+        virtual bool remove(const KeyType& key) override
+        {
+            bool found = false;
+
+            if (m_root != NULL_INDEX)
+            {
+                found = removeFrom(m_root, m_height, key);
+                if (found)
+                {
+                    // Update count
+                    m_count--;
+
+                    // Shrink the tree
+                    if (m_height == 0u)
+                    {
+                        if (m_leaves[m_root].count == 0u)
+                        {
+                            freeLeaf(m_root);
+                            m_root = NULL_INDEX;
+                        }
+                    }
+                    else if (m_inners[m_root].count == 0u)
+                    {
+                        const IndexType root = m_root;
+                        m_root = m_inners[root].children[0u];
+                        freeInner(root);
+                        m_height--;
+                    }
+                }
+            }
+
+            return found;
+        }
+
+        /** \brief Remove all the items from the map */
+        virtual void clear() override
+        {
+            if (m_count != 0u)
+            {
+                // All the nodes and entries are free again
+                m_count = 0u;
+                m_used_entry_count = 0u;
+                m_used_leaf_count = 0u;
+                m_used_inner_count = 0u;
+                m_free_entry = nullptr;
+                m_free_leaf = NULL_INDEX;
+                m_free_inner = NULL_INDEX;
+                m_root = NULL_INDEX;
+                m_height = 0u;
+                m_last = nullptr;
+                setFirst(nullptr);
+            }
+        }
+
+
+    protected:
+
+        /** \brief Get the first item of the map */
+        virtual Entry* getFirst() const override { return m_first; }
+
+        /** \brief Get the last item of the map */
+        virtual Entry* getLast() const override { return m_last; }
+
+    public:
+
+
+        ////// Implementation of BTreeBase methods //////
+
+
+        /** \brief Get the number of levels of the tree */
+        nano_stl_size_t getHeight() const { return ((m_root == NULL_INDEX) ? 0u : (m_height + 1u)); }
+
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        /** \brief Get the iterator which points to the start of the container */
+        const void begin(typename IMap<KeyType, ItemType>::Iterator& it) const { it = m_begin; }
+
+        /** \brief Get the iterator which points to the end of the container */
+        const void end(typename IMap<KeyType, ItemType>::Iterator& it) const { it = m_end; }
+
+        /** \brief Get the const iterator which points to the start of the container */
+        const void cbegin(typename IMap<KeyType, ItemType>::ConstIterator& it) const { it = m_const_begin; }
+
+        /** \brief Get the const iterator which points to the end of the container */
+        const void cend(typename IMap<KeyType, ItemType>::ConstIterator& it) const { it = m_const_end; }
+
+#endif // NANO_STL_ITERATORS_ENABLED
+
+
+    private:
+
+        /** \brief Index of a null node */
+        static const IndexType NULL_INDEX = static_cast<IndexType>(-1);
+
+        /** \brief Minimum number of keys of the nodes other than the root */
+        static const nano_stl_size_t MIN_KEY_COUNT = (NODE_KEY_COUNT / 2u);
+
+        /** \brief Result of an insertion into a sub-tree */
+        enum InsertResult
+        {
+            /** \brief The key is already in the tree */
+            INSERT_EXISTS,
+            /** \brief The key has been inserted */
+            INSERT_DONE,
+            /** \brief The key has been inserted and the node has been split */
+            INSERT_SPLIT
+        };
+
+
+        /** \brief Underlying C array of entries */
+        Entry* const m_entries;
+
+        /** \brief Underlying C array of entries size */
+        const nano_stl_size_t m_size;
+
+        /** \brief Underlying C array of leaves */
+        Leaf* const m_leaves;
+
+        /** \brief Underlying C array of leaves size */
+        const nano_stl_size_t m_leaf_count;
+
+        /** \brief Underlying C array of inner nodes */
+        Inner* const m_inners;
+
+        /** \brief Underlying C array of inner nodes size */
+        const nano_stl_size_t m_inner_count;
+
+        /** \brief Item count */
+        nano_stl_size_t m_count;
+
+        /** \brief Number of entries which have been used at least once since the last clear */
+        nano_stl_size_t m_used_entry_count;
+
+        /** \brief Number of leaves which have been used at least once since the last clear */
+        nano_stl_size_t m_used_leaf_count;
+
+        /** \brief Number of inner nodes which have been used at least once since the last clear */
+        nano_stl_size_t m_used_inner_count;
+
+        /** \brief First free entry (free entries are chained through their next link) */
+        Entry* m_free_entry;
+
+        /** \brief First free leaf (free leaves are chained through their next index) */
+        IndexType m_free_leaf;
+
+        /** \brief First free inner node (free inner nodes are chained through their first child index) */
+        IndexType m_free_inner;
+
+        /** \brief Root node */
+        IndexType m_root;
+
+        /** \brief Number of inner levels above the leaves */
+        nano_stl_size_t m_height;
+
+        /** \brief First entry in the keys order */
+        Entry* m_first;
+
+        /** \brief Last entry in the keys order */
+        Entry* m_last;
+
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        /** \brief Iterator to the beginning of the map */
+        typename IMap<KeyType, ItemType>::Iterator m_begin;
+
+        /** \brief Iterator to the end of the map */
+        typename IMap<KeyType, ItemType>::Iterator m_end;
+
+        /** \brief Iterator of the container */
+        typename IMap<KeyType, ItemType>::Iterator m_it;
+
+        /** \brief Iterator to the beginning of the map */
+        typename IMap<KeyType, ItemType>::ConstIterator m_const_begin;
+
+        /** \brief Iterator to the end of the map */
+        typename IMap<KeyType, ItemType>::ConstIterator m_const_end;
+
+        /** \brief Const iterator of the container */
+        typename IMap<KeyType, ItemType>::ConstIterator m_const_it;
+
+        /** \brief Pointer to the const iterator of the container */
+        typename IMap<KeyType, ItemType>::ConstIterator* const m_pconst_it;
+
+#endif // NANO_STL_ITERATORS_ENABLED
+
+
+        /** \brief Get the number of keys of a node which are lower than a key 
+         *         (linear scan without early exit so that the compiler can vectorize it for integer keys) */
+        static nano_stl_size_t lowerBoundInNode(const KeyType* const keys, const nano_stl_size_t count, const KeyType& key)
+        {
+            nano_stl_size_t index = 0u;
+            for (nano_stl_size_t i = 0u; i < count; i++)
+            {
+                index += ((keys[i] < key) ? 1u : 0u);
+            }
+            return index;
+        }
+
+        /** \brief Get the number of keys of a node which are lower than or equal to a key 
+         *         (linear scan without early exit so that the compiler can vectorize it for integer keys) */
+        static nano_stl_size_t upperBoundInNode(const KeyType* const keys, const nano_stl_size_t count, const KeyType& key)
+        {
+            nano_stl_size_t index = 0u;
+            for (nano_stl_size_t i = 0u; i < count; i++)
+            {
+                index += ((key < keys[i]) ? 0u : 1u);
+            }
+            return index;
+        }
+
+        /** \brief Look for the entry corresponding to a key */
+        Entry* lookForKey(const KeyType& key) const
+        {
+            Entry* entry = nullptr;
+
+            if (m_root != NULL_INDEX)
+            {
+                // Go down to the leaf
+                IndexType node = m_root;
+                for (nano_stl_size_t level = m_height; level != 0u; level--)
+                {
+                    const Inner& inner = m_inners[node];
+                    node = inner.children[upperBoundInNode(inner.keys, inner.count, key)];
+                }
+
+                // Look for the key in the leaf
+                const Leaf& leaf = m_leaves[node];
+                const nano_stl_size_t index = lowerBoundInNode(leaf.keys, leaf.count, key);
+                if ((index < leaf.count) && !(key < leaf.keys[index]))
+                {
+                    entry = &m_entries[leaf.entries[index]];
+                }
+
+                // Check if containers statistics are enabled
+                #if (NANO_STL_STATS_ENABLED == 1)
+                ContainerStats::recordSearch(m_height + 1u);
+                #endif // NANO_STL_STATS_ENABLED
+            }
+
+            return entry;
+        }
+
+        /** \brief Insert a key into a sub-tree (the new node and its first key are returned when the node is split) */
+        InsertResult insert(const IndexType node, const nano_stl_size_t level, const KeyType& key, const ItemType& item, 
+                            KeyType& split_key, IndexType& split_node)
+        {
+            InsertResult result;
+
+            if (level == 0u)
+            {
+                result = insertInLeaf(node, key, item, split_key, split_node);
+            }
+            else
+            {
+                Inner& inner = m_inners[node];
+                const nano_stl_size_t index = upperBoundInNode(inner.keys, inner.count, key);
+                KeyType child_split_key;
+                IndexType child_split_node = NULL_INDEX;
+                result = insert(inner.children[index], level - 1u, key, item, child_split_key, child_split_node);
+                if (result == INSERT_SPLIT)
+                {
+                    result = insertInInner(node, index, child_split_key, child_split_node, split_key, split_node);
+                }
+            }
+
+            return result;
+        }
+
+        /** \brief Insert a key into a leaf */
+        InsertResult insertInLeaf(const IndexType node, const KeyType& key, const ItemType& item, KeyType& split_key, IndexType& split_node)
+        {
+            InsertResult result = INSERT_EXISTS;
+
+            Leaf& leaf = m_leaves[node];
+            const nano_stl_size_t index = lowerBoundInNode(leaf.keys, leaf.count, key);
+            if ((index == leaf.count) || (key < leaf.keys[index]))
+            {
+                // Create the entry and insert it before the entry of the next key
+                Entry* next = nullptr;
+                if (index < leaf.count)
+                {
+                    next = &m_entries[leaf.entries[index]];
+                }
+                else if (leaf.next != NULL_INDEX)
+                {
+                    next = &m_entries[m_leaves[leaf.next].entries[0u]];
+                }
+                Entry* const entry = allocateEntry();
+                entry->item = item;
+                linkEntry(entry, next);
+                const IndexType entry_index = static_cast<IndexType>(entry - m_entries);
+
+                if (leaf.count < NODE_KEY_COUNT)
+                {
+                    insertInLeafAt(leaf, index, key, entry_index);
+                    result = INSERT_DONE;
+                }
+                else
+                {
+                    // Split the leaf : the upper half of the keys goes to a new leaf
+                    const IndexType right_node = allocateLeaf();
+                    Leaf& right = m_leaves[right_node];
+                    const nano_stl_size_t left_count = ((NODE_KEY_COUNT + 1u) / 2u);
+                    const nano_stl_size_t moved_start = ((index < left_count) ? (left_count - 1u) : left_count);
+                    for (nano_stl_size_t i = moved_start; i < NODE_KEY_COUNT; i++)
+                    {
+                        right.keys[i - moved_start] = leaf.keys[i];
+                        right.entries[i - moved_start] = leaf.entries[i];
+                    }
+                    right.count = static_cast<KeyCount>(NODE_KEY_COUNT - moved_start);
+                    leaf.count = static_cast<KeyCount>(moved_start);
+                    if (index < left_count)
+                    {
+                        insertInLeafAt(leaf, index, key, entry_index);
+                    }
+                    else
+                    {
+                        insertInLeafAt(right, index - left_count, key, entry_index);
+                    }
+                    right.next = leaf.next;
+                    leaf.next = right_node;
+
+                    split_key = right.keys[0u];
+                    split_node = right_node;
+                    result = INSERT_SPLIT;
+                }
+            }
+
+            return result;
+        }
+
+        /** \brief Insert a key and its entry at a given position into a leaf which is not full */
+        static void insertInLeafAt(Leaf& leaf, const nano_stl_size_t index, const KeyType& key, const IndexType entry)
+        {
+            for (nano_stl_size_t i = leaf.count; i > index; i--)
+            {
+                leaf.keys[i] = leaf.keys[i - 1u];
+                leaf.entries[i] = leaf.entries[i - 1u];
+            }
+            leaf.keys[index] = key;
+            leaf.entries[index] = entry;
+            leaf.count++;
+        }
+
+        /** \brief Insert the separator key and the new node of a split child into an inner node */
+        InsertResult insertInInner(const IndexType node, const nano_stl_size_t index, const KeyType& child_key, const IndexType child_node, 
+                                   KeyType& split_key, IndexType& split_node)
+        {
+            InsertResult result = INSERT_DONE;
+
+            Inner& inner = m_inners[node];
+            if (inner.count < NODE_KEY_COUNT)
+            {
+                insertInInnerAt(inner, index, child_key, child_node);
+            }
+            else
+            {
+                // Gather all the keys and children
+                KeyType keys[NODE_KEY_COUNT + 1u];
+                IndexType children[NODE_KEY_COUNT + 2u];
+                for (nano_stl_size_t i = 0u; i < NODE_KEY_COUNT; i++)
+                {
+                    keys[i] = inner.keys[i];
+                    children[i] = inner.children[i];
+                }
+                children[NODE_KEY_COUNT] = inner.children[NODE_KEY_COUNT];
+                for (nano_stl_size_t i = NODE_KEY_COUNT; i > index; i--)
+                {
+                    keys[i] = keys[i - 1u];
+                    children[i + 1u] = children[i];
+                }
+                keys[index] = child_key;
+                children[index + 1u] = child_node;
+
+                // Split the node : the middle key goes up to the parent
+                const nano_stl_size_t left_count = ((NODE_KEY_COUNT + 1u) / 2u);
+                const IndexType right_node = allocateInner();
+                Inner& right = m_inners[right_node];
+                for (nano_stl_size_t i = 0u; i < left_count; i++)
+                {
+                    inner.keys[i] = keys[i];
+                    inner.children[i] = children[i];
+                }
+                inner.children[left_count] = children[left_count];
+                inner.count = static_cast<KeyCount>(left_count);
+                for (nano_stl_size_t i = (left_count + 1u); i <= NODE_KEY_COUNT; i++)
+                {
+                    right.keys[i - left_count - 1u] = keys[i];
+                    right.children[i - left_count - 1u] = children[i];
+                }
+                right.children[NODE_KEY_COUNT - left_count] = children[NODE_KEY_COUNT + 1u];
+                right.count = static_cast<KeyCount>(NODE_KEY_COUNT - left_count);
+
+                split_key = keys[left_count];
+                split_node = right_node;
+                result = INSERT_SPLIT;
+            }
+
+            return result;
+        }
+
+        /** \brief Insert a separator key and its right child at a given position into an inner node which is not full */
+        static void insertInInnerAt(Inner& inner, const nano_stl_size_t index, const KeyType& key, const IndexType child)
+        {
+            for (nano_stl_size_t i = inner.count; i > index; i--)
+            {
+                inner.keys[i] = inner.keys[i - 1u];
+                inner.children[i + 1u] = inner.children[i];
+            }
+            inner.keys[index] = key;
+            inner.children[index + 1u] = child;
+            inner.count++;
+        }
+
+        /** \brief Remove a key from a sub-tree */
+        bool removeFrom(const IndexType node, const nano_stl_size_t level, const KeyType& key)
+        {
+            bool found = false;
+
+            if (level == 0u)
+            {
+                Leaf& leaf = m_leaves[node];
+                const nano_stl_size_t index = lowerBoundInNode(leaf.keys, leaf.count, key);
+                if ((index < leaf.count) && !(key < leaf.keys[index]))
+                {
+                    // Release the entry
+                    Entry* const entry = &m_entries[leaf.entries[index]];
+                    unlinkEntry(entry);
+                    freeEntry(entry);
+
+                    // Remove the key from the leaf
+                    leaf.count--;
+                    for (nano_stl_size_t i = index; i < leaf.count; i++)
+                    {
+                        leaf.keys[i] = leaf.keys[i + 1u];
+                        leaf.entries[i] = leaf.entries[i + 1u];
+                    }
+                    found = true;
+                }
+            }
+            else
+            {
+                Inner& inner = m_inners[node];
+                const nano_stl_size_t index = upperBoundInNode(inner.keys, inner.count, key);
+                const IndexType child = inner.children[index];
+                found = removeFrom(child, level - 1u, key);
+                if (found)
+                {
+                    // Restore the minimum number of keys of the child
+                    if (level == 1u)
+                    {
+                        if (m_leaves[child].count < MIN_KEY_COUNT)
+                        {
+                            fixLeaf(inner, index);
+                        }
+                    }
+                    else
+                    {
+                        if (m_inners[child].count < MIN_KEY_COUNT)
+                        {
+                            fixInner(inner, index);
+                        }
+                    }
+                }
+            }
+
+            return found;
+        }
+
+        /** \brief Restore the minimum number of keys of a leaf by borrowing a key from a sibling or by merging it with a sibling */
+        void fixLeaf(Inner& parent, const nano_stl_size_t index)
+        {
+            Leaf& leaf = m_leaves[parent.children[index]];
+            if ((index > 0u) && (m_leaves[parent.children[index - 1u]].count > MIN_KEY_COUNT))
+            {
+                // Borrow the last key of the left sibling
+                Leaf& left = m_leaves[parent.children[index - 1u]];
+                left.count--;
+                insertInLeafAt(leaf, 0u, left.keys[left.count], left.entries[left.count]);
+                parent.keys[index - 1u] = leaf.keys[0u];
+            }
+            else if ((index < parent.count) && (m_leaves[parent.children[index + 1u]].count > MIN_KEY_COUNT))
+            {
+                // Borrow the first key of the right sibling
+                Leaf& right = m_leaves[parent.children[index + 1u]];
+                insertInLeafAt(leaf, leaf.count, right.keys[0u], right.entries[0u]);
+                right.count--;
+                for (nano_stl_size_t i = 0u; i < right.count; i++)
+                {
+                    right.keys[i] = right.keys[i + 1u];
+                    right.entries[i] = right.entries[i + 1u];
+                }
+                parent.keys[index] = right.keys[0u];
+            }
+            else
+            {
+                // Merge with a sibling
+                const nano_stl_size_t left_index = ((index > 0u) ? (index - 1u) : index);
+                Leaf& left = m_leaves[parent.children[left_index]];
+                const IndexType right_node = parent.children[left_index + 1u];
+                Leaf& right = m_leaves[right_node];
+                for (nano_stl_size_t i = 0u; i < right.count; i++)
+                {
+                    left.keys[left.count + i] = right.keys[i];
+                    left.entries[left.count + i] = right.entries[i];
+                }
+                left.count = static_cast<KeyCount>(left.count + right.count);
+                left.next = right.next;
+                freeLeaf(right_node);
+                removeFromInnerAt(parent, left_index);
+            }
+        }
+
+        /** \brief Restore the minimum number of keys of an inner node by borrowing a key from a sibling or by merging it with a sibling */
+        void fixInner(Inner& parent, const nano_stl_size_t index)
+        {
+            Inner& inner = m_inners[parent.children[index]];
+            if ((index > 0u) && (m_inners[parent.children[index - 1u]].count > MIN_KEY_COUNT))
+            {
+                // Rotate the last child of the left sibling through the parent
+                Inner& left = m_inners[parent.children[index - 1u]];
+                inner.children[inner.count + 1u] = inner.children[inner.count];
+                for (nano_stl_size_t i = inner.count; i > 0u; i--)
+                {
+                    inner.keys[i] = inner.keys[i - 1u];
+                    inner.children[i] = inner.children[i - 1u];
+                }
+                inner.keys[0u] = parent.keys[index - 1u];
+                inner.children[0u] = left.children[left.count];
+                inner.count++;
+                left.count--;
+                parent.keys[index - 1u] = left.keys[left.count];
+            }
+            else if ((index < parent.count) && (m_inners[parent.children[index + 1u]].count > MIN_KEY_COUNT))
+            {
+                // Rotate the first child of the right sibling through the parent
+                Inner& right = m_inners[parent.children[index + 1u]];
+                inner.keys[inner.count] = parent.keys[index];
+                inner.children[inner.count + 1u] = right.children[0u];
+                inner.count++;
+                parent.keys[index] = right.keys[0u];
+                right.count--;
+                for (nano_stl_size_t i = 0u; i < right.count; i++)
+                {
+                    right.keys[i] = right.keys[i + 1u];
+                    right.children[i] = right.children[i + 1u];
+                }
+                right.children[right.count] = right.children[right.count + 1u];
+            }
+            else
+            {
+                // Merge with a sibling : the separator key goes down into the merged node
+                const nano_stl_size_t left_index = ((index > 0u) ? (index - 1u) : index);
+                Inner& left = m_inners[parent.children[left_index]];
+                const IndexType right_node = parent.children[left_index + 1u];
+                Inner& right = m_inners[right_node];
+                left.keys[left.count] = parent.keys[left_index];
+                for (nano_stl_size_t i = 0u; i < right.count; i++)
+                {
+                    left.keys[left.count + 1u + i] = right.keys[i];
+                    left.children[left.count + 1u + i] = right.children[i];
+                }
+                left.children[left.count + 1u + right.count] = right.children[right.count];
+                left.count = static_cast<KeyCount>(left.count + 1u + right.count);
+                freeInner(right_node);
+                removeFromInnerAt(parent, left_index);
+            }
+        }
+
+        /** \brief Remove a separator key and its right child from an inner node */
+        static void removeFromInnerAt(Inner& inner, const nano_stl_size_t index)
+        {
+            inner.count--;
+            for (nano_stl_size_t i = index; i < inner.count; i++)
+            {
+                inner.keys[i] = inner.keys[i + 1u];
+                inner.children[i + 1u] = inner.children[i + 2u];
+            }
+        }
+
+        /** \brief Allocate an entry */
+        Entry* allocateEntry()
+        {
+            Entry* entry = m_free_entry;
+            if (entry != nullptr)
+            {
+                m_free_entry = entry->next;
+            }
+            else
+            {
+                entry = &m_entries[m_used_entry_count];
+                m_used_entry_count++;
+            }
+            return entry;
+        }
+
+        /** \brief Release an entry */
+        void freeEntry(Entry* const entry)
+        {
+            entry->next = m_free_entry;
+            m_free_entry = entry;
+        }
+
+        /** \brief Allocate a leaf */
+        IndexType allocateLeaf()
+        {
+            IndexType leaf = m_free_leaf;
+            if (leaf != NULL_INDEX)
+            {
+                m_free_leaf = m_leaves[leaf].next;
+            }
+            else
+            {
+                if (m_used_leaf_count == m_leaf_count)
+                {
+                    NANO_STL_CRITICAL_ERROR();
+                }
+                leaf = static_cast<IndexType>(m_used_leaf_count);
+                m_used_leaf_count++;
+            }
+            return leaf;
+        }
+
+        /** \brief Release a leaf */
+        void freeLeaf(const IndexType leaf)
+        {
+            m_leaves[leaf].next = m_free_leaf;
+            m_free_leaf = leaf;
+        }
+
+        /** \brief Allocate an inner node */
+        IndexType allocateInner()
+        {
+            IndexType inner = m_free_inner;
+            if (inner != NULL_INDEX)
+            {
+                m_free_inner = m_inners[inner].children[0u];
+            }
+            else
+            {
+                if (m_used_inner_count == m_inner_count)
+                {
+                    NANO_STL_CRITICAL_ERROR();
+                }
+                inner = static_cast<IndexType>(m_used_inner_count);
+                m_used_inner_count++;
+            }
+            return inner;
+        }
+
+        /** \brief Release an inner node */
+        void freeInner(const IndexType inner)
+        {
+            m_inners[inner].children[0u] = m_free_inner;
+            m_free_inner = inner;
+        }
+
+        /** \brief Insert an entry into the keys order list before the entry of the next key (nullptr = at the end of the list) */
+        void linkEntry(Entry* const entry, Entry* const next)
+        {
+            entry->next = next;
+            if (next != nullptr)
+            {
+                entry->previous = next->previous;
+                next->previous = entry;
+            }
+            else
+            {
+                entry->previous = m_last;
+                m_last = entry;
+            }
+            if (entry->previous != nullptr)
+            {
+                entry->previous->next = entry;
+            }
+            else
+            {
+                setFirst(entry);
+            }
+        }
+
+        /** \brief Remove an entry from the keys order list */
+        void unlinkEntry(Entry* const entry)
+        {
+            if (entry->previous != nullptr)
+            {
+                entry->previous->next = entry->next;
+            }
+            else
+            {
+                setFirst(entry->next);
+            }
+            if (entry->next != nullptr)
+            {
+                entry->next->previous = entry->previous;
+            }
+            else
+            {
+                m_last = entry->previous;
+            }
+        }
+
+        /** \brief Set the first entry of the list and update the iterators */
+        void setFirst(Entry* const first)
+        {
+            m_first = first;
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+            m_begin = typename IMap<KeyType, ItemType>::Iterator(*this, m_first);
+            m_const_begin = m_begin;
+
+#endif // NANO_STL_ITERATORS_ENABLED
+        }
+};
+
+/** \brief Index of a null node */
+template <typename KeyType, typename ItemType, typename IndexType, nano_stl_size_t NODE_KEY_COUNT>
+const IndexType BTreeBase<KeyType, ItemType, IndexType, NODE_KEY_COUNT>::NULL_INDEX;
+
+/** \brief Minimum number of keys of the nodes other than the root */
+template <typename KeyType, typename ItemType, typename IndexType, nano_stl_size_t NODE_KEY_COUNT>
+const nano_stl_size_t BTreeBase<KeyType, ItemType, IndexType, NODE_KEY_COUNT>::MIN_KEY_COUNT;
+
+}
+
+#endif // BTREEBASE_H
@@ -0,0 +1,166 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CONTAINERSTATS_H
+#define CONTAINERSTATS_H
+
+#include "IContainerStats.h"
+#include "IString.h"
+
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+namespace nano_stl
+{
+
+/** \brief Usage statistics of a container, updated by the containers base classes */
+class ContainerStats : public IContainerStats
+{
+    public:
+
+        /** \brief Constructor */
+        ContainerStats(const nano_stl_size_t& count, const nano_stl_size_t capacity)
+        : m_count(count)
+        , m_capacity(capacity)
+        , m_high_water_count(0u)
+        , m_failed_insert_count(0u)
+        , m_overwrite_count(0u)
+        , m_max_search_depth(0u)
+        , m_search_count(0u)
+        , m_probe_count(0u)
+        {}
+
+
+        ////// Implementation of IContainerStats interface //////
+
+
+        /** \brief Get the maximum number of items which have been simultaneously stored in the container */
+        virtual nano_stl_size_t getHighWaterCount() const override { return m_high_water_count; }
+
+        /** \brief Get the number of insertions which have failed because the container was full */
+        virtual nano_stl_size_t getFailedInsertCount() const override { return m_failed_insert_count; }
+
+        /** \brief Get the number of items which have been overwritten because the container was full (ring buffers only) */
+        virtual nano_stl_size_t getOverwriteCount() const override { return m_overwrite_count; }
+
+        /** \brief Get the maximum number of nodes visited by a key search (binary search trees and maps only) */
+        virtual nano_stl_size_t getMaxSearchDepth() const override { return m_max_search_depth; }
+
+        /** \brief Get the number of key searches (binary search trees and maps only) */
+        virtual nano_stl_size_t getSearchCount() const override { return m_search_count; }
+
+        /** \brief Get the total number of nodes visited by the key searches, the average probe length 
+         *         is getProbeCount() / getSearchCount() (binary search trees and maps only) */
+        virtual nano_stl_size_t getProbeCount() const override { return m_probe_count; }
+
+        /** \brief Reset the statistics (the high-water count restarts from the current item count) */
+        virtual void resetStats() override
+        {
+            m_high_water_count = m_count;
+            m_failed_insert_count = 0u;
+            m_overwrite_count = 0u;
+            m_max_search_depth = 0u;
+            m_search_count = 0u;
+            m_probe_count = 0u;
+        }
+
+        /** \brief Write the statistics on a single line into a string */
+        virtual void dumpStats(IString& output) const override
+        {
+            // Average probe length with 2 decimals
+            nano_stl_size_t average = 0u;
+            if (m_search_count != 0u)
+            {
+                average = static_cast<nano_stl_size_t>((static_cast<uint64_t>(m_probe_count) * 100u) / m_search_count);
+            }
+
+            output.format("count=%u/%u high_water=%u failed_inserts=%u overwrites=%u max_depth=%u avg_probe=%u.%02u",
+                          static_cast<unsigned int>(m_count), static_cast<unsigned int>(m_capacity), 
+                          static_cast<unsigned int>(m_high_water_count), static_cast<unsigned int>(m_failed_insert_count), 
+                          static_cast<unsigned int>(m_overwrite_count), static_cast<unsigned int>(m_max_search_depth),
+                          static_cast<unsigned int>(average / 100u), static_cast<unsigned int>(average % 100u));
+        }
+
+
+        ////// Implementation of ContainerStats methods //////
+
+
+        /** \brief Record an insertion (a failed insertion must be recorded only if it has failed because the container was full) */
+        void recordInsert(const bool inserted)
+        {
+            if (!inserted)
+            {
+                m_failed_insert_count++;
+            }
+            else if (m_count > m_high_water_count)
+            {
+                m_high_water_count = m_count;
+            }
+            else
+            {}
+        }
+
+        /** \brief Record an item overwritten because the container was full */
+        void recordOverwrite() { m_overwrite_count++; }
+
+        /** \brief Record a key search which has visited the given number of nodes */
+        void recordSearch(const nano_stl_size_t depth) const
+        {
+            m_search_count++;
+            m_probe_count += depth;
+            if (depth > m_max_search_depth)
+            {
+                m_max_search_depth = depth;
+            }
+        }
+
+
+    private:
+
+        /** \brief Item count of the container */
+        const nano_stl_size_t& m_count;
+
+        /** \brief Capacity of the container */
+        const nano_stl_size_t m_capacity;
+
+        /** \brief High-water count */
+        nano_stl_size_t m_high_water_count;
+
+        /** \brief Failed insertions count */
+        nano_stl_size_t m_failed_insert_count;
+
+        /** \brief Overwritten items count */
+        nano_stl_size_t m_overwrite_count;
+
+        /** \brief Maximum search depth */
+        mutable nano_stl_size_t m_max_search_depth;
+
+        /** \brief Search count */
+        mutable nano_stl_size_t m_search_count;
+
+        /** \brief Total number of nodes visited by the searches */
+        mutable nano_stl_size_t m_probe_count;
+};
+
+}
+
+#endif // NANO_STL_STATS_ENABLED
+
+#endif // CONTAINERSTATS_H
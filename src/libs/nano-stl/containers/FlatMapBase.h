@@ -0,0 +1,581 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef FLATMAPBASE_H
+#define FLATMAPBASE_H
+
+#include "IMap.h"
+#include "IErrorHandler.h"
+#include "ContainerStats.h"
+
+namespace nano_stl
+{
+
+/** \brief Base class for all flat maps implementations 
+ *         The keys and the items are stored in 2 separate arrays sorted by key so that the key searches 
+ *         (branchless binary search) only touch the keys. Adding or removing an item shifts the following 
+ *         items : this map is intended to be filled at startup and then mostly read.
+ *         The iterators walk through the items array in the keys order (the IMap node based iterators are not used).
+*/
+template <typename KeyType, typename ItemType>
+class FlatMapBase : public IMap<KeyType, ItemType>
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+                  , public ContainerStats
+#endif // NANO_STL_STATS_ENABLED
+{
+    public:
+
+        /** \brief Constructor */
+        FlatMapBase(KeyType* const keys, ItemType* const items, const nano_stl_size_t size)
+        :
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+          ContainerStats(m_count, size),
+
+#endif // NANO_STL_STATS_ENABLED
+
+          m_keys(keys)
+        , m_items(items)
+        , m_size(size)
+        , m_count(0u)
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        , m_begin(*this, IIteratorBase<ItemType>::INVALID_POSITION)
+        , m_end(*this, IIteratorBase<ItemType>::INVALID_POSITION)
+        , m_it(*this, IIteratorBase<ItemType>::INVALID_POSITION)
+        , m_const_begin(m_begin)
+        , m_const_end(m_end)
+        , m_const_it(m_it)
+        , m_pconst_it(&m_const_it)
+        
+#endif // NANO_STL_ITERATORS_ENABLED
+        {}
+
+
+        ////// Implementation of IContainer interface //////
+
+
+        /** \brief Get the number of objects that the container can handle */
+        virtual nano_stl_size_t getCapacity() const override { return m_size; }
+
+        /** \brief Get the number of objects that the container contains */
+        virtual nano_stl_size_t getCount() const override { return m_count; }
+
+        /** \brief Check if the container contains an item */
+        virtual bool contains(const ItemType& item) const override
+        {
+            bool found = false;
+
+            for (nano_stl_size_t i = 0u; !found && (i < m_count); i++)
+            {
+                found = (m_items[i] == item);
+            }
+
+            return found;
+        }
+
+
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        ////// Implementation of IIterable interface //////
+
+
+        /** \brief Get the iterator which points to the start of the container */
+        virtual const IIterator<ItemType>& begin() const override { return m_begin; }
+
+        /** \brief Get the iterator which points to the end of the container */
+        virtual const IIterator<ItemType>& end() const override { return m_end; }
+
+        /** \brief Get the iterator of the container */
+        virtual IIterator<ItemType>& it() override { begin(m_it); return m_it; }
+
+        /** \brief Get the const iterator which points to the start of the container */
+        virtual const IConstIterator<ItemType>& cbegin() const override { return m_const_begin; }
+
+        /** \brief Get the const iterator which points to the end of the container */
+        virtual const IConstIterator<ItemType>& cend() const override { return m_const_end; }
+
+        /** \brief Get the const iterator of the container */
+        virtual IConstIterator<ItemType>& const_it() const override { cbegin(*m_pconst_it); return (*m_pconst_it); }
+
+#endif // NANO_STL_ITERATORS_ENABLED
+
+
+        ////// Implementation of IMap interface //////
+        
+
+        /** \brief Get the item corresponding to a key */
+        virtual ItemType& operator [] (const KeyType& key) override
+        {
+            const nano_stl_size_t index = lowerBound(key);
+            if (isKeyAt(key, index))
+            {
+                return m_items[index];
+            }
+            else
+            {
+                NANO_STL_CRITICAL_ERROR();
+                return (*reinterpret_cast<ItemType*>(0));
+            }
+        }
+
+        /** \brief Get the item corresponding to a key */
+        virtual const ItemType& operator [] (const KeyType& key) const override
+        {
+            const nano_stl_size_t index = lowerBound(key);
+            if (isKeyAt(key, index))
+            {
+                return m_items[index];
+            }
+            else
+            {
+                NANO_STL_CRITICAL_ERROR();
+                return (*reinterpret_cast<const ItemType*>(0));
+            }
+        }
+
+        /** \brief Add an item to the map */
+        virtual bool add(const KeyType& key, const ItemType& item) override
+        {
+            bool ret = false;
+
+            // Check for free space
+            if (m_count != m_size)
+            {
+                // Look for the key
+                const nano_stl_size_t index = lowerBound(key);
+                if (!isKeyAt(key, index))
+                {
+                    // Make room for the new item
+                    for (nano_stl_size_t i = m_count; i > index; i--)
+                    {
+                        m_keys[i] = m_keys[i - 1u];
+                        m_items[i] = m_items[i - 1u];
+                    }
+                    m_keys[index] = key;
+                    m_items[index] = item;
+
+                    // Update count
+                    setCount(m_count + 1u);
+
+                    ret = true;
+                }
+            }
+
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            if (ret || (m_count == m_size))
+            {
+                ContainerStats::recordInsert(ret);
+            }
+            #endif // NANO_STL_STATS_ENABLED
+
+            return ret;
+        }
+
+        /** \brief Check if the map contains a specific key */
+        virtual bool containsKey(const KeyType& key) const override
+        {
+            return isKeyAt(key, lowerBound(key));
+        }
+
+        /** \brief Get an item from the map */
+        virtual bool get(const KeyType& key, ItemType& item) const override
+        {
+            const nano_stl_size_t index = lowerBound(key);
+            const bool found = isKeyAt(key, index);
+            if (found)
+            {
+                item = m_items[index];
+            }
+
+            return found;
+        }
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual ItemType* find(const KeyType& key) override
+        {
+            const nano_stl_size_t index = lowerBound(key);
+            return (isKeyAt(key, index) ? &m_items[index] : nullptr);
+        }
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual const ItemType* find(const KeyType& key) const override
+        {
+            const nano_stl_size_t index = lowerBound(key);
+            return (isKeyAt(key, index) ? &m_items[index] : nullptr);
+        }
+
+        /** \brief Remove an item from the map */
+        virtual bool remove(const KeyType& key) override
+        {
+            const nano_stl_size_t index = lowerBound(key);
+            const bool found = isKeyAt(key, index);
+            if (found)
+            {
+                // Fill the hole
+                for (nano_stl_size_t i = index + 1u; i < m_count; i++)
+                {
+                    m_keys[i - 1u] = m_keys[i];
+                    m_items[i - 1u] = m_items[i];
+                }
+
+                // Update count
+                setCount(m_count - 1u);
+            }
+
+            return found;
+        }
+
+        /** \brief Remove all the items from the map */
+        virtual void clear() override
+        {
+            setCount(0u);
+        }
+
+
+    protected:
+
+        /** \brief Get the first item of the map (no node : the items are walked by the flat map iterators) */
+        virtual typename IMap<KeyType, ItemType>::Node* getFirst() const override { return nullptr; }
+
+        /** \brief Get the last item of the map (no node : the items are walked by the flat map iterators) */
+        virtual typename IMap<KeyType, ItemType>::Node* getLast() const override { return nullptr; }
+
+    public:
+
+
+        ////// Implementation of FlatMapBase methods //////
+
+
+        /** \brief Replace the contents of the map by items sorted in strictly ascending key order 
+         *         (the arrays are filled in O(n) without any key search or shift, the map is left unchanged if the keys 
+         *          are not strictly ascending or if there are more items than the capacity) */
+        bool assignSorted(const KeyType* const keys, const ItemType* const items, const nano_stl_size_t count)
+        {
+            // Check the keys
+            bool ret = (count <= m_size);
+            for (nano_stl_size_t i = 1u; ret && (i < count); i++)
+            {
+                ret = (keys[i - 1u] < keys[i]);
+            }
+            if (ret)
+            {
+                for (nano_stl_size_t i = 0u; i < count; i++)
+                {
+                    m_keys[i] = keys[i];
+                    m_items[i] = items[i];
+                }
+                setCount(count);
+            }
+
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            if (ret || (count > m_size))
+            {
+                ContainerStats::recordInsert(ret);
+            }
+            #endif // NANO_STL_STATS_ENABLED
+
+            return ret;
+        }
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        // Iterator forward declaration
+        class Iterator;
+
+        /** \brief Const iterator (position in the items array) */
+        class ConstIterator : public IConstIterator<ItemType>
+        {
+            public:
+
+                /** \brief Constructor */
+                ConstIterator(const FlatMapBase<KeyType, ItemType>& map, const nano_stl_size_t position)
+                : m_map(&map)
+                , m_current(position)
+                {}
+
+                /** \brief Copy constructor */
+                ConstIterator(const ConstIterator& copy)
+                : m_map(copy.m_map)
+                , m_current(copy.m_current)
+                {}
+
+                /**\brief Conversion constructor */
+                ConstIterator(const Iterator& it)
+                : m_map(it.m_map)
+                , m_current(it.m_current)
+                {}
+
+                /** \brief Get the element at the current position */
+                virtual const ItemType& operator * () override
+                {
+                    return m_map->m_items[m_current];
+                }
+
+                /** \brief Move to the next element */
+                virtual void operator ++ () override
+                {
+                    if (m_current < m_map->m_count)
+                    {
+                        m_current++;
+                        if (m_current == m_map->m_count)
+                        {
+                            m_current = IIteratorBase<ItemType>::INVALID_POSITION;
+                        }
+                    }
+                }
+
+                /** \brief Move to the previous element */
+                virtual void operator -- () override
+                {
+                    if ((m_current != 0u) && (m_current < m_map->m_count))
+                    {
+                        m_current--;
+                    }
+                }
+
+                /** \brief Get the position of an iterator */
+                virtual nano_stl_size_t getPosition() const override { return m_current; }
+
+                /** \brief Get the iterable instance */
+                virtual const IIterable<ItemType>& getIterable() const override { return (*m_map); }
+
+                /** \brief Copy operator */
+                ConstIterator& operator = (const ConstIterator& copy)
+                {
+                    m_map = copy.m_map;
+                    m_current = copy.m_current;
+                    return (*this);
+                }
+
+                /** \brief Copy operator */
+                ConstIterator& operator = (const Iterator& copy)
+                {
+                    m_map = copy.m_map;
+                    m_current = copy.m_current;
+                    return (*this);
+                }
+
+            private:
+
+                /** \brief Underlying flat map */
+                const FlatMapBase<KeyType, ItemType>* m_map;
+
+                /** \brief Current position */
+                nano_stl_size_t m_current;
+        };
+
+        /** \brief Iterator (position in the items array) */
+        class Iterator : public IIterator<ItemType>
+        {
+                /* To allow conversion to ConstIterator */
+                friend class ConstIterator;
+
+            public:
+
+                /** \brief Constructor */
+                Iterator(FlatMapBase<KeyType, ItemType>& map, const nano_stl_size_t position)
+                : m_map(&map)
+                , m_current(position)
+                {}
+
+                /** \brief Copy constructor */
+                Iterator(const Iterator& copy)
+                : m_map(copy.m_map)
+                , m_current(copy.m_current)
+                {}
+
+                /** \brief Get the element at the current position */
+                virtual ItemType& operator * () override
+                {
+                    return m_map->m_items[m_current];
+                }
+
+                /** \brief Move to the next element */
+                virtual void operator ++ () override
+                {
+                    if (m_current < m_map->m_count)
+                    {
+                        m_current++;
+                        if (m_current == m_map->m_count)
+                        {
+                            m_current = IIteratorBase<ItemType>::INVALID_POSITION;
+                        }
+                    }
+                }
+
+                /** \brief Move to the previous element */
+                virtual void operator -- () override
+                {
+                    if ((m_current != 0u) && (m_current < m_map->m_count))
+                    {
+                        m_current--;
+                    }
+                }
+
+                /** \brief Get the position of an iterator */
+                virtual nano_stl_size_t getPosition() const override { return m_current; }
+
+                /** \brief Get the iterable instance */
+                virtual const IIterable<ItemType>& getIterable() const override { return (*m_map); }
+
+                /** \brief Copy operator */
+                Iterator& operator = (const Iterator& copy)
+                {
+                    m_map = copy.m_map;
+                    m_current = copy.m_current;
+                    return (*this);
+                }
+
+            private:
+
+                /** \brief Underlying flat map */
+                FlatMapBase<KeyType, ItemType>* m_map;
+
+                /** \brief Current position */
+                nano_stl_size_t m_current;
+        };
+
+        /** \brief Get the iterator which points to the start of the container */
+        const void begin(Iterator& it) const { it = m_begin; }
+
+        /** \brief Get the iterator which points to the end of the container */
+        const void end(Iterator& it) const { it = m_end; }
+
+        /** \brief Get the const iterator which points to the start of the container */
+        const void cbegin(ConstIterator& it) const { it = m_const_begin; }
+
+        /** \brief Get the const iterator which points to the end of the container */
+        const void cend(ConstIterator& it) const { it = m_const_end; }
+
+#endif // NANO_STL_ITERATORS_ENABLED
+
+
+    private:
+
+        /** \brief Underlying C array of keys */
+        KeyType* const m_keys;
+
+        /** \brief Underlying C array of items */
+        ItemType* const m_items;
+
+        /** \brief Underlying C arrays size */
+        const nano_stl_size_t m_size;
+
+        /** \brief Item count */
+        nano_stl_size_t m_count;
+
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        /** \brief Iterator to the beginning of the map */
+        Iterator m_begin;
+
+        /** \brief Iterator to the end of the map */
+        Iterator m_end;
+
+        /** \brief Iterator of the container */
+        Iterator m_it;
+
+        /** \brief Iterator to the beginning of the map */
+        ConstIterator m_const_begin;
+
+        /** \brief Iterator to the end of the map */
+        ConstIterator m_const_end;
+
+        /** \brief Const iterator of the container */
+        ConstIterator m_const_it;
+
+        /** \brief Pointer to the const iterator of the container */
+        ConstIterator* const m_pconst_it;
+
+#endif // NANO_STL_ITERATORS_ENABLED
+
+
+        /** \brief Get the index of the first key which is not lower than a key (branchless binary search) */
+        nano_stl_size_t lowerBound(const KeyType& key) const
+        {
+            nano_stl_size_t index = 0u;
+            nano_stl_size_t length = m_count;
+
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            nano_stl_size_t depth = 1u;
+            #endif // NANO_STL_STATS_ENABLED
+
+            if (length != 0u)
+            {
+                // The loop only selects the start of the remaining half : the compiler turns it into a conditional move
+                while (length > 1u)
+                {
+                    const nano_stl_size_t half = (length / 2u);
+                    index = ((m_keys[index + half] < key) ? (index + half) : index);
+                    length -= half;
+
+                    // Check if containers statistics are enabled
+                    #if (NANO_STL_STATS_ENABLED == 1)
+                    depth++;
+                    #endif // NANO_STL_STATS_ENABLED
+                }
+                index += ((m_keys[index] < key) ? 1u : 0u);
+            }
+
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            ContainerStats::recordSearch(depth);
+            #endif // NANO_STL_STATS_ENABLED
+
+            return index;
+        }
+
+        /** \brief Check if a key is stored at the index returned by lowerBound() */
+        bool isKeyAt(const KeyType& key, const nano_stl_size_t index) const
+        {
+            return ((index < m_count) && !(key < m_keys[index]));
+        }
+
+        /** \brief Set the item count and update the iterators */
+        void setCount(const nano_stl_size_t count)
+        {
+            m_count = count;
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+            m_begin = Iterator(*this, ((m_count == 0u) ? IIteratorBase<ItemType>::INVALID_POSITION : 0u));
+            m_const_begin = m_begin;
+
+#endif // NANO_STL_ITERATORS_ENABLED
+        }
+};
+
+}
+
+#endif // FLATMAPBASE_H
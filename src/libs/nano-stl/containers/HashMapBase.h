@@ -0,0 +1,646 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HASHMAPBASE_H
+#define HASHMAPBASE_H
+
+#include "IMap.h"
+#include "IErrorHandler.h"
+#include "ContainerStats.h"
+#include "Hash.h"
+
+namespace nano_stl
+{
+
+/** \brief Base class for all hash maps implementations 
+ *         The keys and the items are stored in an open addressing table using Robin Hood hashing with backward shift 
+ *         deletion : a slot only contains the key, the item and its distance to the home slot of the key so that a 
+ *         search reads a single array. Adding or removing an item may move the other items : a pointer returned by 
+ *         find() is only valid until the next modification of the map. The iterators walk through the used slots 
+ *         in the table order.
+*/
+template <typename KeyType, typename ItemType, typename HasherType, typename DistanceType = nano_stl_size_t>
+class HashMapBase : public IMap<KeyType, ItemType>
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+                  , public ContainerStats
+#endif // NANO_STL_STATS_ENABLED
+{
+    public:
+
+        /** \brief Hash table slot */
+        struct Slot
+        {
+            /** \brief Key */
+            KeyType key;
+            /** \brief Item */
+            ItemType item;
+            /** \brief Distance to the home slot of the key + 1 (0 = empty slot) */
+            DistanceType distance;
+        };
+
+
+        /** \brief Constructor (the number of slots must be a power of 2 greater than the number of items) */
+        HashMapBase(Slot* const slots, const nano_stl_size_t size, const nano_stl_size_t slot_count)
+        :
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+          ContainerStats(m_count, size),
+
+#endif // NANO_STL_STATS_ENABLED
+
+          m_slots(slots)
+        , m_size(size)
+        , m_mask(slot_count - 1u)
+        , m_count(0u)
+        , m_hasher()
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        , m_begin(*this, IIteratorBase<ItemType>::INVALID_POSITION)
+        , m_end(*this, IIteratorBase<ItemType>::INVALID_POSITION)
+        , m_it(*this, IIteratorBase<ItemType>::INVALID_POSITION)
+        , m_const_begin(m_begin)
+        , m_const_end(m_end)
+        , m_const_it(m_it)
+        , m_pconst_it(&m_const_it)
+        
+#endif // NANO_STL_ITERATORS_ENABLED
+        {
+            // Empty the table
+            clearSlots();
+        }
+
+
+        ////// Implementation of IContainer interface //////
+
+
+        /** \brief Get the number of objects that the container can handle */
+        virtual nano_stl_size_t getCapacity() const override { return m_size; }
+
+        /** \brief Get the number of objects that the container contains */
+        virtual nano_stl_size_t getCount() const override { return m_count; }
+
+        /** \brief Check if the container contains an item */
+        virtual bool contains(const ItemType& item) const override
+        {
+            bool found = false;
+
+            for (nano_stl_size_t i = 0u; !found && (i <= m_mask); i++)
+            {
+                found = ((m_slots[i].distance != 0u) && (m_slots[i].item == item));
+            }
+
+            return found;
+        }
+
+
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        ////// Implementation of IIterable interface //////
+
+
+        /** \brief Get the iterator which points to the start of the container */
+        virtual const IIterator<ItemType>& begin() const override { return m_begin; }
+
+        /** \brief Get the iterator which points to the end of the container */
+        virtual const IIterator<ItemType>& end() const override { return m_end; }
+
+        /** \brief Get the iterator of the container */
+        virtual IIterator<ItemType>& it() override { begin(m_it); return m_it; }
+
+        /** \brief Get the const iterator which points to the start of the container */
+        virtual const IConstIterator<ItemType>& cbegin() const override { return m_const_begin; }
+
+        /** \brief Get the const iterator which points to the end of the container */
+        virtual const IConstIterator<ItemType>& cend() const override { return m_const_end; }
+
+        /** \brief Get the const iterator of the container */
+        virtual IConstIterator<ItemType>& const_it() const override { cbegin(*m_pconst_it); return (*m_pconst_it); }
+
+#endif // NANO_STL_ITERATORS_ENABLED
+
+
+        ////// Implementation of IMap interface //////
+        
+
+        /** \brief Get the item corresponding to a key */
+        virtual ItemType& operator [] (const KeyType& key) override
+        {
+            const nano_stl_size_t slot = lookForKey(key);
+            if (slot != INVALID_SLOT)
+            {
+                return m_slots[slot].item;
+            }
+            else
+            {
+                NANO_STL_CRITICAL_ERROR();
+                return (*reinterpret_cast<ItemType*>(0));
+            }
+        }
+
+        /** \brief Get the item corresponding to a key */
+        virtual const ItemType& operator [] (const KeyType& key) const override
+        {
+            const nano_stl_size_t slot = lookForKey(key);
+            if (slot != INVALID_SLOT)
+            {
+                return m_slots[slot].item;
+            }
+            else
+            {
+                NANO_STL_CRITICAL_ERROR();
+                return (*reinterpret_cast<const ItemType*>(0));
+            }
+        }
+
+        /** \brief Add an item to the map */
+        virtual bool add(const KeyType& key, const ItemType& item) override
+        {
+            bool ret = false;
+
+            // Check for free space
+            if (m_count != m_size)
+            {
+                // Look for the key
+                if (lookForKey(key) == INVALID_SLOT)
+                {
+                    // Update count
+                    m_count++;
+
+                    // Index it
+                    insertSlot(key, item);
+
+                    ret = true;
+                }
+            }
+
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            if (ret || (m_count == m_size))
+            {
+                ContainerStats::recordInsert(ret);
+            }
+            #endif // NANO_STL_STATS_ENABLED
+
+            return ret;
+        }
+
+        /** \brief Check if the map contains a specific key */
+        virtual bool containsKey(const KeyType& key) const override
+        {
+            return (lookForKey(key) != INVALID_SLOT);
+        }
+
+        /** \brief Get an item from the map */
+        virtual bool get(const KeyType& key, ItemType& item) const override
+        {
+            const nano_stl_size_t slot = lookForKey(key);
+            const bool found = (slot != INVALID_SLOT);
+            if (found)
+            {
+                item = m_slots[slot].item;
+            }
+
+            return found;
+        }
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual ItemType* find(const KeyType& key) override
+        {
+            const nano_stl_size_t slot = lookForKey(key);
+            return ((slot != INVALID_SLOT) ? &m_slots[slot].item : nullptr);
+        }
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual const ItemType* find(const KeyType& key) const override
+        {
+            const nano_stl_size_t slot = lookForKey(key);
+            return ((slot != INVALID_SLOT) ? &m_slots[slot].item : nullptr);
+        }
+
+        /** \brief Remove an item from the map */
+        virtual bool remove(const KeyType& key) override
+        {
+            const nano_stl_size_t slot = lookForKey(key);
+            const bool found = (slot != INVALID_SLOT);
+            if (found)
+            {
+                // Update count
+                m_count--;
+
+                // Unindex it
+                removeSlot(slot);
+            }
+
+            return found;
+        }
+
+        /** \brief Remove all the items from the map */
+        virtual void clear() override
+        {
+            if (m_count != 0u)
+            {
+                clearSlots();
+                m_count = 0u;
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+                setBegin(IIteratorBase<ItemType>::INVALID_POSITION);
+
+#endif // NANO_STL_ITERATORS_ENABLED
+            }
+        }
+
+
+    protected:
+
+        /** \brief Get the first item of the map (no node : the items are walked by the hash map iterators) */
+        virtual typename IMap<KeyType, ItemType>::Node* getFirst() const override { return nullptr; }
+
+        /** \brief Get the last item of the map (no node : the items are walked by the hash map iterators) */
+        virtual typename IMap<KeyType, ItemType>::Node* getLast() const override { return nullptr; }
+
+    public:
+
+
+        ////// Implementation of HashMapBase methods //////
+
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        // Iterator forward declaration
+        class Iterator;
+
+        /** \brief Const iterator (index of a used slot) */
+        class ConstIterator : public IConstIterator<ItemType>
+        {
+            public:
+
+                /** \brief Constructor */
+                ConstIterator(const HashMapBase& map, const nano_stl_size_t position)
+                : m_map(&map)
+                , m_current(position)
+                {}
+
+                /** \brief Copy constructor */
+                ConstIterator(const ConstIterator& copy)
+                : m_map(copy.m_map)
+                , m_current(copy.m_current)
+                {}
+
+                /**\brief Conversion constructor */
+                ConstIterator(const Iterator& it)
+                : m_map(it.m_map)
+                , m_current(it.m_current)
+                {}
+
+                /** \brief Get the element at the current position */
+                virtual const ItemType& operator * () override
+                {
+                    return m_map->m_slots[m_current].item;
+                }
+
+                /** \brief Move to the next element */
+                virtual void operator ++ () override
+                {
+                    if (m_current != IIteratorBase<ItemType>::INVALID_POSITION)
+                    {
+                        m_current = m_map->nextUsedSlot(m_current + 1u);
+                    }
+                }
+
+                /** \brief Move to the previous element */
+                virtual void operator -- () override
+                {
+                    if (m_current != IIteratorBase<ItemType>::INVALID_POSITION)
+                    {
+                        m_current = m_map->previousUsedSlot(m_current);
+                    }
+                }
+
+                /** \brief Get the position of an iterator */
+                virtual nano_stl_size_t getPosition() const override { return m_current; }
+
+                /** \brief Get the iterable instance */
+                virtual const IIterable<ItemType>& getIterable() const override { return (*m_map); }
+
+                /** \brief Copy operator */
+                ConstIterator& operator = (const ConstIterator& copy)
+                {
+                    m_map = copy.m_map;
+                    m_current = copy.m_current;
+                    return (*this);
+                }
+
+                /** \brief Copy operator */
+                ConstIterator& operator = (const Iterator& copy)
+                {
+                    m_map = copy.m_map;
+                    m_current = copy.m_current;
+                    return (*this);
+                }
+
+            private:
+
+                /** \brief Underlying hash map */
+                const HashMapBase* m_map;
+
+                /** \brief Current slot */
+                nano_stl_size_t m_current;
+        };
+
+        /** \brief Iterator (index of a used slot) */
+        class Iterator : public IIterator<ItemType>
+        {
+                /* To allow conversion to ConstIterator */
+                friend class ConstIterator;
+
+            public:
+
+                /** \brief Constructor */
+                Iterator(HashMapBase& map, const nano_stl_size_t position)
+                : m_map(&map)
+                , m_current(position)
+                {}
+
+                /** \brief Copy constructor */
+                Iterator(const Iterator& copy)
+                : m_map(copy.m_map)
+                , m_current(copy.m_current)
+                {}
+
+                /** \brief Get the element at the current position */
+                virtual ItemType& operator * () override
+                {
+                    return m_map->m_slots[m_current].item;
+                }
+
+                /** \brief Move to the next element */
+                virtual void operator ++ () override
+                {
+                    if (m_current != IIteratorBase<ItemType>::INVALID_POSITION)
+                    {
+                        m_current = m_map->nextUsedSlot(m_current + 1u);
+                    }
+                }
+
+                /** \brief Move to the previous element */
+                virtual void operator -- () override
+                {
+                    if (m_current != IIteratorBase<ItemType>::INVALID_POSITION)
+                    {
+                        m_current = m_map->previousUsedSlot(m_current);
+                    }
+                }
+
+                /** \brief Get the position of an iterator */
+                virtual nano_stl_size_t getPosition() const override { return m_current; }
+
+                /** \brief Get the iterable instance */
+                virtual const IIterable<ItemType>& getIterable() const override { return (*m_map); }
+
+                /** \brief Copy operator */
+                Iterator& operator = (const Iterator& copy)
+                {
+                    m_map = copy.m_map;
+                    m_current = copy.m_current;
+                    return (*this);
+                }
+
+            private:
+
+                /** \brief Underlying hash map */
+                HashMapBase* m_map;
+
+                /** \brief Current slot */
+                nano_stl_size_t m_current;
+        };
+
+        /** \brief Get the iterator which points to the start of the container */
+        const void begin(Iterator& it) const { it = m_begin; }
+
+        /** \brief Get the iterator which points to the end of the container */
+        const void end(Iterator& it) const { it = m_end; }
+
+        /** \brief Get the const iterator which points to the start of the container */
+        const void cbegin(ConstIterator& it) const { it = m_const_begin; }
+
+        /** \brief Get the const iterator which points to the end of the container */
+        const void cend(ConstIterator& it) const { it = m_const_end; }
+
+#endif // NANO_STL_ITERATORS_ENABLED
+
+
+    private:
+
+        /** \brief Invalid slot index */
+        static const nano_stl_size_t INVALID_SLOT = static_cast<nano_stl_size_t>(-1);
+
+
+        /** \brief Underlying C array of slots */
+        Slot* const m_slots;
+
+        /** \brief Maximum number of items */
+        const nano_stl_size_t m_size;
+
+        /** \brief Mask to apply on a slot index (number of slots - 1) */
+        const nano_stl_size_t m_mask;
+
+        /** \brief Item count */
+        nano_stl_size_t m_count;
+
+        /** \brief Key hasher */
+        HasherType m_hasher;
+
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        /** \brief Iterator to the beginning of the map */
+        Iterator m_begin;
+
+        /** \brief Iterator to the end of the map */
+        Iterator m_end;
+
+        /** \brief Iterator of the container */
+        Iterator m_it;
+
+        /** \brief Iterator to the beginning of the map */
+        ConstIterator m_const_begin;
+
+        /** \brief Iterator to the end of the map */
+        ConstIterator m_const_end;
+
+        /** \brief Const iterator of the container */
+        ConstIterator m_const_it;
+
+        /** \brief Pointer to the const iterator of the container */
+        ConstIterator* const m_pconst_it;
+
+#endif // NANO_STL_ITERATORS_ENABLED
+
+
+        /** \brief Empty all the slots of the table */
+        void clearSlots()
+        {
+            for (nano_stl_size_t i = 0; i <= m_mask; i++)
+            {
+                m_slots[i].distance = 0u;
+            }
+        }
+
+        /** \brief Look for the slot of a key, returns INVALID_SLOT if the key is not in the table */
+        nano_stl_size_t lookForKey(const KeyType& key) const
+        {
+            nano_stl_size_t found = INVALID_SLOT;
+            nano_stl_size_t slot = (m_hasher(key) & m_mask);
+            nano_stl_size_t distance = 1u;
+
+            // With Robin Hood hashing the search stops on the first slot whose key is closer to its home slot than the key
+            while ((found == INVALID_SLOT) && (m_slots[slot].distance >= distance))
+            {
+                if (m_slots[slot].key == key)
+                {
+                    found = slot;
+                }
+                else
+                {
+                    slot = ((slot + 1u) & m_mask);
+                    distance++;
+                }
+            }
+
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            ContainerStats::recordSearch(distance);
+            #endif // NANO_STL_STATS_ENABLED
+
+            return found;
+        }
+
+        /** \brief Insert an item in the table, the items which are closer to their home slot are moved forward */
+        void insertSlot(const KeyType& key, const ItemType& item)
+        {
+            Slot inserted;
+            inserted.key = key;
+            inserted.item = item;
+            inserted.distance = 1u;
+
+            nano_stl_size_t slot = (m_hasher(key) & m_mask);
+            while (m_slots[slot].distance != 0u)
+            {
+                if (m_slots[slot].distance < inserted.distance)
+                {
+                    const Slot displaced = m_slots[slot];
+                    m_slots[slot] = inserted;
+                    inserted = displaced;
+                }
+                slot = ((slot + 1u) & m_mask);
+                inserted.distance = static_cast<DistanceType>(inserted.distance + 1u);
+            }
+            m_slots[slot] = inserted;
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+            // The filled slot may be the new first used slot of the table
+            if (slot < m_begin.getPosition())
+            {
+                setBegin(slot);
+            }
+
+#endif // NANO_STL_ITERATORS_ENABLED
+        }
+
+        /** \brief Remove an item from the table, the following items are shifted back towards their home slot */
+        void removeSlot(nano_stl_size_t slot)
+        {
+            nano_stl_size_t next = ((slot + 1u) & m_mask);
+            while (m_slots[next].distance > 1u)
+            {
+                m_slots[slot] = m_slots[next];
+                m_slots[slot].distance = static_cast<DistanceType>(m_slots[slot].distance - 1u);
+                slot = next;
+                next = ((next + 1u) & m_mask);
+            }
+            m_slots[slot].distance = 0u;
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+            // The emptied slot may have been the first used slot of the table
+            if (m_count == 0u)
+            {
+                setBegin(IIteratorBase<ItemType>::INVALID_POSITION);
+            }
+            else if (slot == m_begin.getPosition())
+            {
+                setBegin(nextUsedSlot(slot));
+            }
+            else
+            {}
+
+#endif // NANO_STL_ITERATORS_ENABLED
+        }
+
+// Check if iterators are enabled
+#if (NANO_STL_ITERATORS_ENABLED == 1)
+
+        /** \brief Get the first used slot starting from a slot index (INVALID_POSITION if there is none) */
+        nano_stl_size_t nextUsedSlot(nano_stl_size_t slot) const
+        {
+            while ((slot <= m_mask) && (m_slots[slot].distance == 0u))
+            {
+                slot++;
+            }
+            return ((slot <= m_mask) ? slot : IIteratorBase<ItemType>::INVALID_POSITION);
+        }
+
+        /** \brief Get the last used slot before a slot index (the slot itself if there is none) */
+        nano_stl_size_t previousUsedSlot(const nano_stl_size_t slot) const
+        {
+            nano_stl_size_t previous = slot;
+            while ((previous != 0u) && (m_slots[previous - 1u].distance == 0u))
+            {
+                previous--;
+            }
+            return ((previous != 0u) ? (previous - 1u) : slot);
+        }
+
+        /** \brief Set the first used slot of the table and update the iterators */
+        void setBegin(const nano_stl_size_t slot)
+        {
+            m_begin = Iterator(*this, slot);
+            m_const_begin = m_begin;
+        }
+
+#endif // NANO_STL_ITERATORS_ENABLED
+};
+
+}
+
+#endif // HASHMAPBASE_H
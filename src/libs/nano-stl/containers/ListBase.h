@@ -21,45 +21,55 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 #define LISTBASE_H
 
 #include "IList.h"
+#include "ContainerStats.h"
 
 namespace nano_stl
 {
 
-/** \brief Base class for all lists implementations */
-template <typename ItemType>
-class ListBase : public IList<ItemType>
+/** \brief Base class for all lists implementations 
+ *         (IndexType is the type of the links between the items when the index links are enabled)
+*/
+template <typename ItemType, typename IndexType = nano_stl_size_t>
+class ListBase : public IList<ItemType, IndexType>
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+               , public ContainerStats
+#endif // NANO_STL_STATS_ENABLED
 {
     public:
 
         /** \brief Constructor */
-        ListBase(typename IList<ItemType>::Item* const items, const nano_stl_size_t size)
-        : m_items(items)
+        ListBase(typename IList<ItemType, IndexType>::Item* const items, const nano_stl_size_t size)
+        :
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+          ContainerStats(m_count, size),
+
+#endif // NANO_STL_STATS_ENABLED
+
+          m_items(items)
         , m_size(size)
         , m_count(0u)
+        , m_used_count(0u)
         , m_first(nullptr)
         , m_last(nullptr)
-        , m_first_free(items)
+        , m_first_free(nullptr)
 
 // Check if iterators are enabled
 #if (NANO_STL_ITERATORS_ENABLED == 1)
 
-        , m_begin(*this, nullptr)
-        , m_end(*this, nullptr)
-        , m_it(*this, nullptr)
+        , m_begin(*this, items, nullptr)
+        , m_end(*this, items, nullptr)
+        , m_it(*this, items, nullptr)
         , m_const_begin(m_begin)
         , m_const_end(m_end)
         , m_const_it(m_it)
         , m_pconst_it(&m_const_it)
 
 #endif // NANO_STL_ITERATORS_ENABLED
-        {
-            // Initialize free list
-            for (nano_stl_size_t i = 0; i < (size - 1u); i++)
-            {
-                m_first_free[i].next = &m_first_free[i+1];
-            }
-            m_first_free[size - 1u].next = nullptr;
-        }
+        {}
 
 
         ////// Implementation of IContainer interface //////
@@ -76,7 +86,7 @@ class ListBase : public IList<ItemType>
         {
             bool found = false;
 
-            typename IList<ItemType>::Item* current = m_first;
+            typename IList<ItemType, IndexType>::Item* current = m_first;
             while (!found && (current != nullptr))
             {
                 if (item == current->value)
@@ -85,7 +95,7 @@ class ListBase : public IList<ItemType>
                 }
                 else
                 {
-                    current = current->next;
+                    current = toItem(current->next);
                 }
             }
 
@@ -129,20 +139,17 @@ class ListBase : public IList<ItemType>
             bool ret = false;
 
             // Check for free space
-            if (m_first_free != nullptr)
+            if (hasFreeItem())
             {
-                typename IList<ItemType>::Item* const new_item = m_first_free;
-
-                // Remove item from free list
-                m_first_free = m_first_free->next;
+                typename IList<ItemType, IndexType>::Item* const new_item = allocateItem();
 
                 // Add item at the start of the list
                 new_item->value = item;
-                new_item->previous = nullptr;
-                new_item->next = m_first;
+                new_item->previous = toLink(nullptr);
+                new_item->next = toLink(m_first);
                 if (m_first != nullptr)
                 {
-                    m_first->previous = new_item;
+                    m_first->previous = toLink(new_item);
                 }
                 setFirst(new_item);
 
@@ -158,6 +165,11 @@ class ListBase : public IList<ItemType>
                 ret = true;
             }
 
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            ContainerStats::recordInsert(ret);
+            #endif // NANO_STL_STATS_ENABLED
+
             return ret;
         }
 
@@ -169,14 +181,14 @@ class ListBase : public IList<ItemType>
             // Check for empty list
             if (m_first != nullptr)
             {
-                typename IList<ItemType>::Item* const del_item = m_first;
+                typename IList<ItemType, IndexType>::Item* const del_item = m_first;
 
                 // Remove item from list
                 item = m_first->value;
-                setFirst(m_first->next);
+                setFirst(toItem(m_first->next));
                 if (m_first != nullptr)
                 {
-                    m_first->previous = nullptr;
+                    m_first->previous = toLink(nullptr);
                 }     
                 else
                 {
@@ -185,7 +197,7 @@ class ListBase : public IList<ItemType>
                 
 
                 // Add item to the free list
-                del_item->next = m_first_free;
+                del_item->next = toLink(m_first_free);
                 m_first_free = del_item;
 
                 // Update list count
@@ -203,20 +215,17 @@ class ListBase : public IList<ItemType>
             bool ret = false;
 
             // Check for free space
-            if (m_first_free != nullptr)
+            if (hasFreeItem())
             {
-                typename IList<ItemType>::Item* const new_item = m_first_free;
-
-                // Remove item from free list
-                m_first_free = m_first_free->next;
+                typename IList<ItemType, IndexType>::Item* const new_item = allocateItem();
 
                 // Add item at the end of the list
                 new_item->value = item;
-                new_item->previous = m_last;
-                new_item->next = nullptr;
+                new_item->previous = toLink(m_last);
+                new_item->next = toLink(nullptr);
                 if (m_last != nullptr)
                 {
-                    m_last->next = new_item;
+                    m_last->next = toLink(new_item);
                 }
                 setLast(new_item);
 
@@ -232,6 +241,11 @@ class ListBase : public IList<ItemType>
                 ret = true;
             }
 
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            ContainerStats::recordInsert(ret);
+            #endif // NANO_STL_STATS_ENABLED
+
             return ret;
         }
 
@@ -243,14 +257,14 @@ class ListBase : public IList<ItemType>
             // Check for empty list
             if (m_last != nullptr)
             {
-                typename IList<ItemType>::Item* const del_item = m_last;
+                typename IList<ItemType, IndexType>::Item* const del_item = m_last;
 
                 // Remove item from list
                 item = m_last->value;
-                setLast(m_last->previous);
+                setLast(toItem(m_last->previous));
                 if (m_last != nullptr)
                 {
-                    m_last->next = nullptr;
+                    m_last->next = toLink(nullptr);
                 }     
                 else
                 {
@@ -258,7 +272,7 @@ class ListBase : public IList<ItemType>
                 }           
 
                 // Add item to the free list
-                del_item->next = m_first_free;
+                del_item->next = toLink(m_first_free);
                 m_first_free = del_item;
 
                 // Update list count
@@ -275,44 +289,42 @@ class ListBase : public IList<ItemType>
 #if (NANO_STL_ITERATORS_ENABLED == 1)
 
         /** \brief Insert an item at a specific location (before item pointed by the iterator) */
-        virtual bool insert(const typename IList<ItemType>::Iterator& position, const ItemType& item) override
+        virtual bool insert(const typename IList<ItemType, IndexType>::Iterator& position, const ItemType& item) override
         {
             bool ret = false;
 
             // Check for free space and matching iterator
-            if ((m_first_free != nullptr) && 
+            if (hasFreeItem() && 
                 (&position.getIterable() == static_cast<IIterable<ItemType>*>(this)))
             {
-                typename IList<ItemType>::Item* const new_item = m_first_free;
-
-                // Remove item from free list
-                m_first_free = m_first_free->next;
+                typename IList<ItemType, IndexType>::Item* const new_item = allocateItem();
 
                 // Add item before the selected item
-                typename IList<ItemType>::Item* const next_item = IList<ItemType>::getItem(position);
+                typename IList<ItemType, IndexType>::Item* const next_item = IList<ItemType, IndexType>::getItem(position);
                 new_item->value = item;
-                new_item->next = next_item;
+                new_item->next = toLink(next_item);
                 if (next_item != nullptr)
                 {
-                    new_item->previous = next_item->previous;
-                    if (next_item->previous != nullptr)
+                    typename IList<ItemType, IndexType>::Item* const previous_item = toItem(next_item->previous);
+                    new_item->previous = toLink(previous_item);
+                    if (previous_item != nullptr)
                     {
-                        next_item->previous->next = new_item;
+                        previous_item->next = toLink(new_item);
                     }
                 }
                 else
                 {
                     if (m_last != nullptr)
                     {
-                        m_last->next = new_item;
-                        new_item->previous = m_last;
+                        m_last->next = toLink(new_item);
+                        new_item->previous = toLink(m_last);
                     }
                     setLast(new_item);
                 }
                 if ((m_first == nullptr) || (m_first == next_item))
                 {
                     setFirst(new_item);
-                    new_item->previous = nullptr;
+                    new_item->previous = toLink(nullptr);
                 }
 
                 // Update list count
@@ -321,20 +333,28 @@ class ListBase : public IList<ItemType>
                 ret = true;
             }
 
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            if (ret || !hasFreeItem())
+            {
+                ContainerStats::recordInsert(ret);
+            }
+            #endif // NANO_STL_STATS_ENABLED
+
             return ret;
         }
 
         /** \brief Remove an item at a specific location */
-        virtual bool remove(const typename IList<ItemType>::Iterator& position) override
+        virtual bool remove(const typename IList<ItemType, IndexType>::Iterator& position) override
         {
             bool ret = false;
 
-            // Check for free space and matching iterator
-            if ((m_first_free != nullptr) && 
+            // Check for empty list and matching iterator
+            if ((m_count != 0u) && 
                 (&position.getIterable() == static_cast<IIterable<ItemType>*>(this)))
             {
                 // Remove the item
-                typename IList<ItemType>::Iterator last(position);
+                typename IList<ItemType, IndexType>::Iterator last(position);
                 ++last;
                 ret = remove(position, last);
             }
@@ -343,7 +363,7 @@ class ListBase : public IList<ItemType>
         }
 
         /** \brief Remove a range of items (item pointed by the last iterator is not removed) */
-        virtual bool remove(const typename IList<ItemType>::Iterator& first, const typename IList<ItemType>::Iterator& last) override
+        virtual bool remove(const typename IList<ItemType, IndexType>::Iterator& first, const typename IList<ItemType, IndexType>::Iterator& last) override
         {
             bool ret = false;
 
@@ -355,13 +375,14 @@ class ListBase : public IList<ItemType>
                 (last.getPosition() > first.getPosition()))
             {
                 // Get the first and the last item to remove
-                typename IList<ItemType>::Item* const first_item = IList<ItemType>::getItem(first);
-                typename IList<ItemType>::Item* const last_item = IList<ItemType>::getItem(last);
+                typename IList<ItemType, IndexType>::Item* const first_item = IList<ItemType, IndexType>::getItem(first);
+                typename IList<ItemType, IndexType>::Item* const last_item = IList<ItemType, IndexType>::getItem(last);
 
                 // Remove items
-                if (first_item->previous != nullptr)
+                typename IList<ItemType, IndexType>::Item* const previous_item = toItem(first_item->previous);
+                if (previous_item != nullptr)
                 {
-                    first_item->previous->next = last_item;
+                    previous_item->next = toLink(last_item);
                 }                
                 else
                 {
@@ -369,23 +390,23 @@ class ListBase : public IList<ItemType>
                 }
                 if (last_item != nullptr)
                 {
-                    last_item->previous = first_item->previous;
+                    last_item->previous = toLink(previous_item);
                 }
                 else
                 {
-                    setLast(first_item->previous);
+                    setLast(previous_item);
                 }
 
                 // Update count
-                typename IList<ItemType>::Item* item_before_last = nullptr;
-                for (typename IList<ItemType>::Item* item = first_item; item != last_item; item = item->next)
+                typename IList<ItemType, IndexType>::Item* item_before_last = nullptr;
+                for (typename IList<ItemType, IndexType>::Item* item = first_item; item != last_item; item = toItem(item->next))
                 {
                     m_count--;
                     item_before_last = item;
                 }
 
                 // Put back items into free list
-                item_before_last->next = m_first_free;
+                item_before_last->next = toLink(m_first_free);
                 m_first_free = first_item;
                 
                 ret = true;
@@ -402,9 +423,9 @@ class ListBase : public IList<ItemType>
             // Check for already empty list
             if (m_count != 0u)
             {
-                // Put back all the items into the free list
-                m_last->next = m_first_free;
-                m_first_free = m_first;
+                // All the items are free again
+                m_used_count = 0u;
+                m_first_free = nullptr;
 
                 // Clear list
                 setFirst(nullptr);
@@ -416,10 +437,18 @@ class ListBase : public IList<ItemType>
     protected:
 
         /** \brief Get the first item of the list */
-        virtual typename IList<ItemType>::Item* getFirst() const override { return m_first; }
+        virtual typename IList<ItemType, IndexType>::Item* getFirst() const override { return m_first; }
 
         /** \brief Get the last item of the list */
-        virtual typename IList<ItemType>::Item* getLast() const override { return m_last; }
+        virtual typename IList<ItemType, IndexType>::Item* getLast() const override { return m_last; }
+
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+        /** \brief Get the items array of the list */
+        virtual typename IList<ItemType, IndexType>::Item* getItems() const override { return m_items; }
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
 
 
     public:
@@ -432,16 +461,16 @@ class ListBase : public IList<ItemType>
 #if (NANO_STL_ITERATORS_ENABLED == 1)
 
         /** \brief Get the iterator which points to the start of the container */
-        const void begin(typename IList<ItemType>::Iterator& it) const { it = m_begin; }
+        const void begin(typename IList<ItemType, IndexType>::Iterator& it) const { it = m_begin; }
 
         /** \brief Get the iterator which points to the end of the container */
-        const void end(typename IList<ItemType>::Iterator& it) const { it = m_end; }
+        const void end(typename IList<ItemType, IndexType>::Iterator& it) const { it = m_end; }
 
         /** \brief Get the const iterator which points to the start of the container */
-        const void cbegin(typename IList<ItemType>::ConstIterator& it) const { it = m_const_begin; }
+        const void cbegin(typename IList<ItemType, IndexType>::ConstIterator& it) const { it = m_const_begin; }
 
         /** \brief Get the const iterator which points to the end of the container */
-        const void cend(typename IList<ItemType>::ConstIterator& it) const { it = m_const_end; }
+        const void cend(typename IList<ItemType, IndexType>::ConstIterator& it) const { it = m_const_end; }
 
 #endif // NANO_STL_ITERATORS_ENABLED
 
@@ -449,7 +478,7 @@ class ListBase : public IList<ItemType>
     private:
 
         /** \brief Underlying C array */
-        typename IList<ItemType>::Item* const m_items;
+        typename IList<ItemType, IndexType>::Item* const m_items;
 
         /** \brief Underlying C array size */
         const nano_stl_size_t m_size;
@@ -457,64 +486,100 @@ class ListBase : public IList<ItemType>
         /** \brief Item count */
         nano_stl_size_t m_count;
 
+        /** \brief Number of items of the underlying C array which have been used at least once since the last clear */
+        nano_stl_size_t m_used_count;
+
 
         /** \brief First item */
-        typename IList<ItemType>::Item* m_first;
+        typename IList<ItemType, IndexType>::Item* m_first;
 
         /** \brief Last item */
-        typename IList<ItemType>::Item* m_last;
+        typename IList<ItemType, IndexType>::Item* m_last;
 
-        /** \brief First free item */
-        typename IList<ItemType>::Item* m_first_free;
+        /** \brief First free item (removed items are chained through their next link, the items which have never 
+         *         been used since the last clear are not chained) */
+        typename IList<ItemType, IndexType>::Item* m_first_free;
 
 
 // Check if iterators are enabled
 #if (NANO_STL_ITERATORS_ENABLED == 1)
 
         /** \brief Iterator to the beginning of the list */
-        typename IList<ItemType>::Iterator m_begin;
+        typename IList<ItemType, IndexType>::Iterator m_begin;
 
         /** \brief Iterator to the end of the list */
-        typename IList<ItemType>::Iterator m_end;
+        typename IList<ItemType, IndexType>::Iterator m_end;
 
         /** \brief Iterator of the container */
-        typename IList<ItemType>::Iterator m_it;
+        typename IList<ItemType, IndexType>::Iterator m_it;
 
         /** \brief Iterator to the beginning of the list */
-        typename IList<ItemType>::ConstIterator m_const_begin;
+        typename IList<ItemType, IndexType>::ConstIterator m_const_begin;
 
         /** \brief Iterator to the end of the list */
-        typename IList<ItemType>::ConstIterator m_const_end;
+        typename IList<ItemType, IndexType>::ConstIterator m_const_end;
 
         /** \brief Const iterator of the container */
-        typename IList<ItemType>::ConstIterator m_const_it;
+        typename IList<ItemType, IndexType>::ConstIterator m_const_it;
 
         /** \brief Pointer to the const iterator of the container */
-        typename IList<ItemType>::ConstIterator* const m_pconst_it;
+        typename IList<ItemType, IndexType>::ConstIterator* const m_pconst_it;
 
 #endif // NANO_STL_ITERATORS_ENABLED
 
 
+        /** \brief Get the item corresponding to a link */
+        typename IList<ItemType, IndexType>::Item* toItem(const typename IList<ItemType, IndexType>::Link link) const 
+        { 
+            return IList<ItemType, IndexType>::toItem(m_items, link); 
+        }
+
+        /** \brief Get the link corresponding to an item */
+        typename IList<ItemType, IndexType>::Link toLink(typename IList<ItemType, IndexType>::Item* const item) const 
+        { 
+            return IList<ItemType, IndexType>::toLink(m_items, item); 
+        }
+
         /** \brief Set the first item of the list and update the iterators */
-        void setFirst(typename IList<ItemType>::Item* const first)
+        void setFirst(typename IList<ItemType, IndexType>::Item* const first)
         {
             m_first = first;
 
 // Check if iterators are enabled
 #if (NANO_STL_ITERATORS_ENABLED == 1)
 
-            m_begin = typename IList<ItemType>::Iterator(*this, m_first);
+            m_begin = typename IList<ItemType, IndexType>::Iterator(*this, m_items, m_first);
             m_const_begin = m_begin;
 
 #endif // NANO_STL_ITERATORS_ENABLED
         }
 
         /** \brief Set the last item of the list and update the iterators */
-        void setLast(typename IList<ItemType>::Item* const last)
+        void setLast(typename IList<ItemType, IndexType>::Item* const last)
         {
             m_last = last;
         }  
 
+        /** \brief Check if an item can be allocated */
+        bool hasFreeItem() const { return ((m_first_free != nullptr) || (m_used_count != m_size)); }
+
+        /** \brief Allocate an item : a removed item if any, otherwise the first item which has never been used 
+         *         (the caller must check that an item is available) */
+        typename IList<ItemType, IndexType>::Item* allocateItem()
+        {
+            typename IList<ItemType, IndexType>::Item* item = m_first_free;
+            if (item != nullptr)
+            {
+                m_first_free = toItem(item->next);
+            }
+            else
+            {
+                item = &m_items[m_used_count];
+                m_used_count++;
+            }
+            return item;
+        }
+
 };
 
 }
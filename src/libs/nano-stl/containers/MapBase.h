@@ -22,6 +22,7 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "IMap.h"
 #include "IBSTree.h"
+#include "IContainerStats.h"
 
 namespace nano_stl
 {
@@ -29,6 +30,10 @@ namespace nano_stl
 /** \brief Base class for all maps implementations */
 template <typename KeyType, typename ItemType>
 class MapBase : public IMap<KeyType, ItemType>
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+              , public IContainerStats
+#endif // NANO_STL_STATS_ENABLED
 {
     public:
 
@@ -140,18 +145,30 @@ class MapBase : public IMap<KeyType, ItemType>
         /** \brief Get an item from the map */
         virtual bool get(const KeyType& key, ItemType& item) const override
         { 
-            typename IMap<KeyType, ItemType>::Node node;
-            node.pitem = &item;
-            
-            const bool found = m_bstree.get(key, node); 
+            const typename IMap<KeyType, ItemType>::Node* const node = m_bstree.find(key);
+            const bool found = (node != nullptr);
             if (found)
             {
-                item = (*node.pitem);
+                item = node->item;
             }
 
             return found;
         }
 
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual ItemType* find(const KeyType& key) override
+        {
+            typename IMap<KeyType, ItemType>::Node* const node = m_bstree.find(key);
+            return ((node != nullptr) ? &node->item : nullptr);
+        }
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual const ItemType* find(const KeyType& key) const override
+        {
+            const typename IMap<KeyType, ItemType>::Node* const node = m_bstree.find(key);
+            return ((node != nullptr) ? &node->item : nullptr);
+        }
+
         /** \brief Remove an item from the map */
         virtual bool remove(const KeyType& key) override
         { 
@@ -188,6 +205,40 @@ class MapBase : public IMap<KeyType, ItemType>
             setLast(nullptr);
         }
 
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+        ////// Implementation of IContainerStats interface //////
+
+
+        /** \brief Get the maximum number of items which have been simultaneously stored in the container */
+        virtual nano_stl_size_t getHighWaterCount() const override { return m_bstree.getStats().getHighWaterCount(); }
+
+        /** \brief Get the number of insertions which have failed because the container was full */
+        virtual nano_stl_size_t getFailedInsertCount() const override { return m_bstree.getStats().getFailedInsertCount(); }
+
+        /** \brief Get the number of items which have been overwritten because the container was full (ring buffers only) */
+        virtual nano_stl_size_t getOverwriteCount() const override { return m_bstree.getStats().getOverwriteCount(); }
+
+        /** \brief Get the maximum number of nodes visited by a key search (binary search trees and maps only) */
+        virtual nano_stl_size_t getMaxSearchDepth() const override { return m_bstree.getStats().getMaxSearchDepth(); }
+
+        /** \brief Get the number of key searches (binary search trees and maps only) */
+        virtual nano_stl_size_t getSearchCount() const override { return m_bstree.getStats().getSearchCount(); }
+
+        /** \brief Get the total number of nodes visited by the key searches, the average probe length 
+         *         is getProbeCount() / getSearchCount() (binary search trees and maps only) */
+        virtual nano_stl_size_t getProbeCount() const override { return m_bstree.getStats().getProbeCount(); }
+
+        /** \brief Reset the statistics (the high-water count restarts from the current item count) */
+        virtual void resetStats() override { m_bstree.getStats().resetStats(); }
+
+        /** \brief Write the statistics on a single line into a string */
+        virtual void dumpStats(IString& output) const override { m_bstree.getStats().dumpStats(output); }
+
+#endif // NANO_STL_STATS_ENABLED
+
     protected:
 
         /** \brief Get the first item of the map */
@@ -196,12 +247,70 @@ class MapBase : public IMap<KeyType, ItemType>
         /** \brief Get the last item of the map */
         virtual typename IMap<KeyType, ItemType>::Node* getLast() const override { return m_last; }
 
+        /** \brief Initializer of the bulk assignment which copies the items from an array and links the nodes 
+         *         as if the items had been added in this order */
+        struct NodesLinker
+        {
+            /** \brief Constructor */
+            NodesLinker(const ItemType* const _items, typename IMap<KeyType, ItemType>::Node*& _first, typename IMap<KeyType, ItemType>::Node*& _last) 
+            : items(_items)
+            , first(_first)
+            , last(_last)
+            {}
+
+            /** \brief Copy the item of the given index and link its node */
+            void operator () (const nano_stl_size_t index, typename IMap<KeyType, ItemType>::Node& node) const
+            {
+                node.item = items[index];
+                node.previous = nullptr;
+                node.next = first;
+                if (first != nullptr)
+                {
+                    first->previous = &node;
+                }
+                else
+                {
+                    last = &node;
+                }
+                first = &node;
+            }
+
+            /** \brief Items to copy */
+            const ItemType* const items;
+            /** \brief First linked node */
+            typename IMap<KeyType, ItemType>::Node*& first;
+            /** \brief Last linked node */
+            typename IMap<KeyType, ItemType>::Node*& last;
+        };
+
+        /** \brief Replace the contents of the map by items sorted in strictly ascending key order using the bulk assignment 
+         *         of the underlying binary search tree (the nodes are linked as if the items had been added in this order) */
+        template <typename BSTreeType>
+        bool assignSortedNodes(BSTreeType& bstree, const KeyType* const keys, const ItemType* const items, const nano_stl_size_t count)
+        {
+            typename IMap<KeyType, ItemType>::Node* first = nullptr;
+            typename IMap<KeyType, ItemType>::Node* last = nullptr;
+            const bool ret = bstree.assignSorted(keys, count, NodesLinker(items, first, last));
+            if (ret)
+            {
+                setFirst(first);
+                setLast(last);
+            }
+
+            return ret;
+        }
+
     public:
 
 
         ////// Implementation of MapBase methods //////
 
 
+        /** \brief Replace the contents of the map by items sorted in strictly ascending key order 
+         *         (the balanced tree is built in O(n) without any key search, the map is left unchanged if the keys 
+         *          are not strictly ascending or if there are more items than the capacity) */
+        virtual bool assignSorted(const KeyType* const keys, const ItemType* const items, const nano_stl_size_t count) = 0;
+
 // Check if iterators are enabled
 #if (NANO_STL_ITERATORS_ENABLED == 1)
 
@@ -21,6 +21,7 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 #define QUEUEBASE_H
 
 #include "IQueue.h"
+#include "ContainerStats.h"
 
 namespace nano_stl
 {
@@ -28,6 +29,10 @@ namespace nano_stl
 /** \brief Base class for all queues implementations */
 template <typename ItemType>
 class QueueBase : public IQueue<ItemType>
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+                , public ContainerStats
+#endif // NANO_STL_STATS_ENABLED
 {
     public:
 
@@ -35,7 +40,16 @@ class QueueBase : public IQueue<ItemType>
 
         /** \brief Constructor */
         QueueBase(ItemType* const items, const nano_stl_size_t size)
-        : m_items(items)
+        :
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+          ContainerStats(m_count, size),
+
+#endif // NANO_STL_STATS_ENABLED
+
+          m_items(items)
         , m_size(size)
         , m_count(0u)
         , m_read(m_items)
@@ -109,6 +123,11 @@ class QueueBase : public IQueue<ItemType>
                 ret = true;
             }
 
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            ContainerStats::recordInsert(ret);
+            #endif // NANO_STL_STATS_ENABLED
+
             return ret;
         }
 
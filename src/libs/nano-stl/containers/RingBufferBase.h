@@ -21,6 +21,7 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 #define RINGBUFFERBASE_H
 
 #include "IRingBuffer.h"
+#include "ContainerStats.h"
 
 namespace nano_stl
 {
@@ -28,6 +29,10 @@ namespace nano_stl
 /** \brief Base class for all ring buffers implementations */
 template <typename ItemType>
 class RingBufferBase : public IRingBuffer<ItemType>
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+                     , public ContainerStats
+#endif // NANO_STL_STATS_ENABLED
 {
     public:
 
@@ -35,7 +40,16 @@ class RingBufferBase : public IRingBuffer<ItemType>
 
         /** \brief Constructor */
         RingBufferBase(ItemType* const items, const nano_stl_size_t size)
-        : m_items(items)
+        :
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+          ContainerStats(m_count, size),
+
+#endif // NANO_STL_STATS_ENABLED
+
+          m_items(items)
         , m_size(size)
         , m_count(0u)
         , m_read(m_items)
@@ -97,10 +111,20 @@ class RingBufferBase : public IRingBuffer<ItemType>
                 {
                     m_read = &m_items[0u];
                 }
+
+                // Check if containers statistics are enabled
+                #if (NANO_STL_STATS_ENABLED == 1)
+                ContainerStats::recordOverwrite();
+                #endif // NANO_STL_STATS_ENABLED
             }
             else
             {
                 m_count++;
+
+                // Check if containers statistics are enabled
+                #if (NANO_STL_STATS_ENABLED == 1)
+                ContainerStats::recordInsert(true);
+                #endif // NANO_STL_STATS_ENABLED
             }
 
             return true;
@@ -27,20 +27,44 @@ namespace nano_stl
 
 /** \brief Static binary search tree implementation 
  *         The binary search tree memory is statically allocated by the class.
+ *         ComparatorType is the three-way comparator of the keys (see Compare).
 */
-template <typename KeyType, typename ItemType, nano_stl_size_t MAX_NODE_COUNT>
-class StaticBSTree : public BSTreeBase<KeyType, ItemType>
+template <typename KeyType, typename ItemType, nano_stl_size_t MAX_NODE_COUNT, typename ComparatorType = Compare<KeyType> >
+class StaticBSTree : public BSTreeBase<KeyType, ItemType, typename NodeIndex<MAX_NODE_COUNT>::Type, ComparatorType>
 {
+    private:
+
+        /** \brief Base binary search tree type */
+        typedef BSTreeBase<KeyType, ItemType, typename NodeIndex<MAX_NODE_COUNT>::Type, ComparatorType> BSTreeBaseType;
+
     public:
 
         /** \brief Constructor */
-        StaticBSTree() : BSTreeBase<KeyType, ItemType>(m_nodes, MAX_NODE_COUNT)
+        StaticBSTree() 
+        : BSTreeBaseType(m_nodes, 
+
+// Check if the split layout is enabled
+#if (NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED == 1)
+
+                         m_items,
+
+#endif // NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED
+
+                         MAX_NODE_COUNT)
         {}
 
     private:
 
         /** \brief Internal C array */
-        typename BSTreeBase<KeyType, ItemType>::Node m_nodes[MAX_NODE_COUNT];
+        typename BSTreeBaseType::Node m_nodes[MAX_NODE_COUNT];
+
+// Check if the split layout is enabled
+#if (NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED == 1)
+
+        /** \brief Internal C array of the items */
+        ItemType m_items[MAX_NODE_COUNT];
+
+#endif // NANO_STL_BSTREE_SPLIT_LAYOUT_ENABLED
 
 };
 
@@ -0,0 +1,99 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STATICBTREE_H
+#define STATICBTREE_H
+
+#include "BTreeBase.h"
+#include "NodeIndex.h"
+
+namespace nano_stl
+{
+
+/** \brief Compute the default number of keys of a B+tree node : the keys of a node fill a 64 bytes cache line (4 keys minimum) */
+template <typename KeyType>
+struct BTreeNodeKeyCount
+{
+    /** \brief Number of keys */
+    static const nano_stl_size_t value = (((64u / sizeof(KeyType)) < 4u) ? 4u : (64u / sizeof(KeyType)));
+};
+
+/** \brief Compute the number of inner nodes needed above a level of a B+tree 
+ *         (every node except the root has at least MIN_CHILD_COUNT children) */
+template <nano_stl_size_t NODE_COUNT, nano_stl_size_t MIN_CHILD_COUNT, bool DONE = (NODE_COUNT <= 1u)>
+struct BTreeInnerCount
+{
+    /** \brief Number of inner nodes */
+    static const nano_stl_size_t value = ((NODE_COUNT / MIN_CHILD_COUNT) + 1u) + 
+                                         BTreeInnerCount<((NODE_COUNT / MIN_CHILD_COUNT) + 1u), MIN_CHILD_COUNT>::value;
+};
+
+/** \brief Compute the number of inner nodes needed above a level of a B+tree : end of recursion 
+ *         (at least one inner node so that the inner nodes array is never empty) */
+template <nano_stl_size_t NODE_COUNT, nano_stl_size_t MIN_CHILD_COUNT>
+struct BTreeInnerCount<NODE_COUNT, MIN_CHILD_COUNT, true>
+{
+    /** \brief Number of inner nodes */
+    static const nano_stl_size_t value = 1u;
+};
+
+
+/** \brief Static B+tree map implementation 
+ *         The map memory is statically allocated by the class.
+ *         NODE_KEY_COUNT is the number of keys of a node (at least 4).
+*/
+template <typename KeyType, typename ItemType, nano_stl_size_t MAX_ITEM_COUNT, nano_stl_size_t NODE_KEY_COUNT = BTreeNodeKeyCount<KeyType>::value>
+class StaticBTree : public BTreeBase<KeyType, ItemType, typename NodeIndex<MAX_ITEM_COUNT>::Type, NODE_KEY_COUNT>
+{
+    public:
+
+        /** \brief Constructor */
+        StaticBTree() : BTreeBase<KeyType, ItemType, typename NodeIndex<MAX_ITEM_COUNT>::Type, NODE_KEY_COUNT>(m_entries, MAX_ITEM_COUNT, 
+                                                                                                              m_leaves, LEAF_COUNT, 
+                                                                                                              m_inners, INNER_COUNT)
+        {}
+
+    private:
+
+        /** \brief B+tree base type */
+        typedef BTreeBase<KeyType, ItemType, typename NodeIndex<MAX_ITEM_COUNT>::Type, NODE_KEY_COUNT> BTreeBaseType;
+
+        /** \brief Compile-time check of the number of keys of a node (the array size is negative if the check fails) */
+        typedef char NODE_KEY_COUNT_MUST_BE_AT_LEAST_4[(NODE_KEY_COUNT >= 4u) ? 1 : -1];
+
+        /** \brief Number of leaves : every leaf except the root is at least half full */
+        static const nano_stl_size_t LEAF_COUNT = ((MAX_ITEM_COUNT / (NODE_KEY_COUNT / 2u)) + 1u);
+
+        /** \brief Number of inner nodes : every inner node except the root is at least half full */
+        static const nano_stl_size_t INNER_COUNT = BTreeInnerCount<LEAF_COUNT, ((NODE_KEY_COUNT / 2u) + 1u)>::value;
+
+        /** \brief Internal C array of entries */
+        typename BTreeBaseType::Entry m_entries[MAX_ITEM_COUNT];
+
+        /** \brief Internal C array of leaves */
+        typename BTreeBaseType::Leaf m_leaves[LEAF_COUNT];
+
+        /** \brief Internal C array of inner nodes */
+        typename BTreeBaseType::Inner m_inners[INNER_COUNT];
+
+};
+
+}
+
+#endif // STATICBTREE_H
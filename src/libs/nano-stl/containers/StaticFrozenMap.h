@@ -0,0 +1,298 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STATICFROZENMAP_H
+#define STATICFROZENMAP_H
+
+#include "IErrorHandler.h"
+
+
+// Check C++ version >= C++14
+#if (__cplusplus >= 201402L)
+
+namespace nano_stl
+{
+
+/** \brief Key and item of a frozen map */
+template <typename KeyType, typename ItemType>
+struct FrozenMapItem
+{
+    /** \brief Key */
+    KeyType key;
+    /** \brief Item */
+    ItemType item;
+};
+
+
+/** \brief Seeded hash functions usable at compile time for the frozen maps keys : integer and enum keys
+ *         (specialize this template or give another hasher to the frozen maps for the other key types)
+*/
+template <typename KeyType>
+struct FrozenHash
+{
+    /** \brief Compute the hash of a key */
+    static constexpr uint32_t hash(const KeyType& key, const uint32_t seed)
+    {
+        uint64_t value = static_cast<uint64_t>(key) ^ (static_cast<uint64_t>(seed) * 0x9E3779B97F4A7C15ull);
+        value ^= (value >> 33u);
+        value *= 0xFF51AFD7ED558CCDull;
+        value ^= (value >> 33u);
+        value *= 0xC4CEB9FE1A85EC53ull;
+        value ^= (value >> 33u);
+        return static_cast<uint32_t>(value);
+    }
+
+    /** \brief Check if 2 keys are equal */
+    static constexpr bool equals(const KeyType& left, const KeyType& right) { return (left == right); }
+};
+
+/** \brief Seeded hash functions usable at compile time for the frozen maps keys : null terminated string keys */
+template <>
+struct FrozenHash<const char*>
+{
+    /** \brief Compute the hash of a key (FNV-1a) */
+    static constexpr uint32_t hash(const char* const key, const uint32_t seed)
+    {
+        uint32_t value = (0x811C9DC5u ^ (seed * 0x9E3779B9u));
+        for (const char* c = key; (*c) != 0; c++)
+        {
+            value ^= static_cast<uint8_t>(*c);
+            value *= 0x01000193u;
+        }
+        value ^= (value >> 16u);
+        value *= 0x85EBCA6Bu;
+        value ^= (value >> 13u);
+        return value;
+    }
+
+    /** \brief Check if 2 keys are equal */
+    static constexpr bool equals(const char* const left, const char* const right)
+    {
+        nano_stl_size_t i = 0u;
+        while ((left[i] == right[i]) && (left[i] != 0))
+        {
+            i++;
+        }
+        return (left[i] == right[i]);
+    }
+};
+
+
+/** \brief Called when no perfect hash has been found for the keys of a frozen map 
+ *         (at compile time this non constexpr function stops the compilation : look for duplicate keys) */
+inline void FROZENMAP_BuildFailed()
+{
+    NANO_STL_CRITICAL_ERROR();
+}
+
+
+/** \brief Static frozen map implementation 
+ *         Immutable map built at compile time from a C array of keys and items : when it is declared as a constexpr 
+ *         object, the map lies in read-only memory and costs nothing at startup. The keys are placed with a minimal 
+ *         perfect hash (hash and displace algorithm) : a lookup reads the displacement seed of the key's bucket and 
+ *         then compares a single key.
+ *         The map provides the const query methods of the IMap interface but doesn't inherit it since a class 
+ *         with virtual methods cannot be built at compile time.
+*/
+template <typename KeyType, typename ItemType, nano_stl_size_t ITEM_COUNT, typename HasherType = FrozenHash<KeyType> >
+class StaticFrozenMap
+{
+    public:
+
+        /** \brief Constructor */
+        constexpr StaticFrozenMap(const FrozenMapItem<KeyType, ItemType> (&items)[ITEM_COUNT])
+        : m_items{}
+        , m_seeds{}
+        {
+            build(items);
+        }
+
+
+        ////// Implementation of IContainer const methods //////
+
+
+        /** \brief Get the number of objects that the container can handle */
+        constexpr nano_stl_size_t getCapacity() const { return ITEM_COUNT; }
+
+        /** \brief Get the number of objects that the container contains */
+        constexpr nano_stl_size_t getCount() const { return ITEM_COUNT; }
+
+        /** \brief Check if the container contains an item */
+        constexpr bool contains(const ItemType& item) const
+        {
+            bool found = false;
+            for (nano_stl_size_t i = 0u; !found && (i < ITEM_COUNT); i++)
+            {
+                found = (m_items[i].item == item);
+            }
+            return found;
+        }
+
+
+        ////// Implementation of IMap const methods //////
+
+
+        /** \brief Get the item corresponding to a key */
+        const ItemType& operator [] (const KeyType& key) const
+        {
+            const FrozenMapItem<KeyType, ItemType>& item = m_items[getSlot(key)];
+            if (!HasherType::equals(item.key, key))
+            {
+                NANO_STL_CRITICAL_ERROR();
+            }
+            return item.item;
+        }
+
+        /** \brief Check if the map contains a specific key */
+        constexpr bool containsKey(const KeyType& key) const
+        {
+            return HasherType::equals(m_items[getSlot(key)].key, key);
+        }
+
+        /** \brief Get an item from the map */
+        constexpr bool get(const KeyType& key, ItemType& item) const
+        {
+            const FrozenMapItem<KeyType, ItemType>& found_item = m_items[getSlot(key)];
+            const bool found = HasherType::equals(found_item.key, key);
+            if (found)
+            {
+                item = found_item.item;
+            }
+            return found;
+        }
+
+
+        ////// Implementation of StaticFrozenMap methods //////
+
+
+        /** \brief Get the key and the item stored at an index (0 to getCount() - 1, in the order of the perfect hash) */
+        constexpr const FrozenMapItem<KeyType, ItemType>& getItem(const nano_stl_size_t index) const { return m_items[index]; }
+
+
+    private:
+
+        /** \brief Number of buckets of the first level hash (2 keys per bucket in average) */
+        static constexpr nano_stl_size_t BUCKET_COUNT = ((ITEM_COUNT / 2u) + 1u);
+
+        /** \brief Maximum number of displacement seeds tried for a bucket */
+        static constexpr uint32_t MAX_SEED = 0x10000u;
+
+
+        /** \brief Keys and items at their perfect hash slot */
+        FrozenMapItem<KeyType, ItemType> m_items[ITEM_COUNT];
+
+        /** \brief Displacement seed of each bucket */
+        uint32_t m_seeds[BUCKET_COUNT];
+
+
+        /** \brief Reduce a hash to a range without division */
+        static constexpr nano_stl_size_t reduce(const uint32_t hash, const nano_stl_size_t range)
+        {
+            return static_cast<nano_stl_size_t>((static_cast<uint64_t>(hash) * range) >> 32u);
+        }
+
+        /** \brief Get the slot of a key */
+        constexpr nano_stl_size_t getSlot(const KeyType& key) const
+        {
+            const uint32_t seed = m_seeds[reduce(HasherType::hash(key, 0u), BUCKET_COUNT)];
+            return reduce(HasherType::hash(key, seed), ITEM_COUNT);
+        }
+
+        /** \brief Place the keys at their slot : the buckets are processed from the biggest to the smallest and for each bucket
+         *         a seed is searched so that all the keys of the bucket fall into free slots */
+        constexpr void build(const FrozenMapItem<KeyType, ItemType> (&items)[ITEM_COUNT])
+        {
+            nano_stl_size_t bucket_sizes[BUCKET_COUNT] = {};
+            nano_stl_size_t bucket_starts[BUCKET_COUNT + 1u] = {};
+            nano_stl_size_t bucket_items[ITEM_COUNT] = {};
+            nano_stl_size_t slots[ITEM_COUNT] = {};
+            bool used[ITEM_COUNT] = {};
+            nano_stl_size_t max_bucket_size = 0u;
+
+            // Sort the keys by bucket
+            for (nano_stl_size_t i = 0u; i < ITEM_COUNT; i++)
+            {
+                bucket_sizes[reduce(HasherType::hash(items[i].key, 0u), BUCKET_COUNT)]++;
+            }
+            for (nano_stl_size_t bucket = 0u; bucket < BUCKET_COUNT; bucket++)
+            {
+                bucket_starts[bucket + 1u] = bucket_starts[bucket] + bucket_sizes[bucket];
+                if (bucket_sizes[bucket] > max_bucket_size)
+                {
+                    max_bucket_size = bucket_sizes[bucket];
+                }
+                bucket_sizes[bucket] = 0u;
+            }
+            for (nano_stl_size_t i = 0u; i < ITEM_COUNT; i++)
+            {
+                const nano_stl_size_t bucket = reduce(HasherType::hash(items[i].key, 0u), BUCKET_COUNT);
+                bucket_items[bucket_starts[bucket] + bucket_sizes[bucket]] = i;
+                bucket_sizes[bucket]++;
+            }
+
+            // Place the buckets
+            for (nano_stl_size_t size = max_bucket_size; size != 0u; size--)
+            {
+                for (nano_stl_size_t bucket = 0u; bucket < BUCKET_COUNT; bucket++)
+                {
+                    if (bucket_sizes[bucket] == size)
+                    {
+                        const nano_stl_size_t* const keys = &bucket_items[bucket_starts[bucket]];
+                        uint32_t seed = 1u;
+                        bool placed = false;
+                        while (!placed && (seed != MAX_SEED))
+                        {
+                            // Check that the keys fall into free and distinct slots
+                            placed = true;
+                            for (nano_stl_size_t i = 0u; placed && (i < size); i++)
+                            {
+                                slots[i] = reduce(HasherType::hash(items[keys[i]].key, seed), ITEM_COUNT);
+                                placed = !used[slots[i]];
+                                for (nano_stl_size_t j = 0u; placed && (j < i); j++)
+                                {
+                                    placed = (slots[i] != slots[j]);
+                                }
+                            }
+                            if (!placed)
+                            {
+                                seed++;
+                            }
+                        }
+                        if (!placed)
+                        {
+                            FROZENMAP_BuildFailed();
+                        }
+
+                        m_seeds[bucket] = seed;
+                        for (nano_stl_size_t i = 0u; i < size; i++)
+                        {
+                            used[slots[i]] = true;
+                            m_items[slots[i]] = items[keys[i]];
+                        }
+                    }
+                }
+            }
+        }
+};
+
+}
+
+#endif // __cplusplus
+
+#endif // STATICFROZENMAP_H
@@ -0,0 +1,71 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STATICHASHMAP_H
+#define STATICHASHMAP_H
+
+#include "HashMapBase.h"
+#include "NodeIndex.h"
+
+namespace nano_stl
+{
+
+/** \brief Compute the number of slots of a hash map table : smallest power of 2 which keeps the load factor under 80% */
+template <nano_stl_size_t MAX_ITEM_COUNT, nano_stl_size_t SLOT_COUNT = 1u, bool DONE = ((SLOT_COUNT * 4u) >= ((MAX_ITEM_COUNT * 5u) + 4u))>
+struct HashMapSlotCount
+{
+    /** \brief Number of slots */
+    static const nano_stl_size_t value = HashMapSlotCount<MAX_ITEM_COUNT, SLOT_COUNT * 2u>::value;
+};
+
+/** \brief Compute the number of slots of a hash map table : end of recursion */
+template <nano_stl_size_t MAX_ITEM_COUNT, nano_stl_size_t SLOT_COUNT>
+struct HashMapSlotCount<MAX_ITEM_COUNT, SLOT_COUNT, true>
+{
+    /** \brief Number of slots */
+    static const nano_stl_size_t value = SLOT_COUNT;
+};
+
+
+/** \brief Static hash map implementation 
+ *         The hash map memory is statically allocated by the class, the probe distances are stored on the smallest 
+ *         integer type able to count the items.
+*/
+template <typename KeyType, typename ItemType, nano_stl_size_t MAX_ITEM_COUNT, typename HasherType = Hash<KeyType> >
+class StaticHashMap : public HashMapBase<KeyType, ItemType, HasherType, typename NodeIndex<MAX_ITEM_COUNT>::Type>
+{
+    public:
+
+        /** \brief Constructor */
+        StaticHashMap() : HashMapBase<KeyType, ItemType, HasherType, typename NodeIndex<MAX_ITEM_COUNT>::Type>(m_slots, MAX_ITEM_COUNT, SLOT_COUNT)
+        {}
+
+    private:
+
+        /** \brief Number of slots of the table */
+        static const nano_stl_size_t SLOT_COUNT = HashMapSlotCount<MAX_ITEM_COUNT>::value;
+
+        /** \brief Internal C array of slots */
+        typename HashMapBase<KeyType, ItemType, HasherType, typename NodeIndex<MAX_ITEM_COUNT>::Type>::Slot m_slots[SLOT_COUNT];
+
+};
+
+}
+
+#endif // STATICHASHMAP_H
@@ -21,26 +21,46 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 #define STATICLIST_H
 
 #include "ListBase.h"
+#include "NodeIndex.h"
 
 namespace nano_stl
 {
 
+/** \brief Index type of the links between the items of a list of MAX_ITEM_COUNT items */
+template <nano_stl_size_t MAX_ITEM_COUNT>
+struct ListIndex
+{
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+    /** \brief Index type : smallest type able to index the items array */
+    typedef typename NodeIndex<MAX_ITEM_COUNT>::Type Type;
+
+#else
+
+    /** \brief Index type : unused by the pointer links, the default one so that all the lists of 
+     *         the same item type implement the same IList interface */
+    typedef nano_stl_size_t Type;
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
+};
+
 /** \brief Static list implementation 
  *         The list memory is statically allocated by the class.
 */
 template <typename ItemType, nano_stl_size_t MAX_ITEM_COUNT>
-class StaticList : public ListBase<ItemType>
+class StaticList : public ListBase<ItemType, typename ListIndex<MAX_ITEM_COUNT>::Type>
 {
     public:
 
         /** \brief Constructor */
-        StaticList() : ListBase<ItemType>(m_items, MAX_ITEM_COUNT)
+        StaticList() : ListBase<ItemType, typename ListIndex<MAX_ITEM_COUNT>::Type>(m_items, MAX_ITEM_COUNT)
         {}
 
     private:
 
         /** \brief Internal C array */
-        typename IList<ItemType>::Item m_items[MAX_ITEM_COUNT];
+        typename IList<ItemType, typename ListIndex<MAX_ITEM_COUNT>::Type>::Item m_items[MAX_ITEM_COUNT];
 
 };
 
@@ -26,22 +26,308 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 namespace nano_stl
 {
 
+/** \brief Reverse index policy of the static maps : no reverse index, the item lookups scan the map */
+template <typename KeyType, typename ItemType, nano_stl_size_t MAX_ITEM_COUNT, typename ComparatorType, bool REVERSE_INDEX>
+class MapReverseIndex
+{
+    protected:
+
+        /** \brief Add an item to the reverse index */
+        void indexItem(const KeyType& key, const ItemType& item) { (void)key; (void)item; }
+
+        /** \brief Remove an item from the reverse index */
+        void unindexItem(const KeyType& key, const ItemType& item) { (void)key; (void)item; }
+
+        /** \brief Check if the reverse index contains an item */
+        bool containsIndexedItem(const ItemType& item) const { (void)item; return false; }
+
+        /** \brief Remove all the items from the reverse index */
+        void clearIndex() {}
+};
+
+/** \brief Reverse index policy of the static maps : the (item, key) pairs are stored in a second binary search tree 
+ *         ordered by item, then by key, so that the item lookups are O(log n) instead of a scan of the map 
+ *         (the items must be ordered by Compare<ItemType> and must not be modified in place through operator [] 
+ *          or find() : remove and add them again instead)
+*/
+template <typename KeyType, typename ItemType, nano_stl_size_t MAX_ITEM_COUNT, typename ComparatorType>
+class MapReverseIndex<KeyType, ItemType, MAX_ITEM_COUNT, ComparatorType, true>
+{
+    public:
+
+        /** \brief Get a key mapped to an item (any of them if several keys are mapped to equal items) */
+        bool findKey(const ItemType& item, KeyType& key) const
+        {
+            const ReverseKey* const found = m_index.findEquivalentKey(item);
+            if (found != nullptr)
+            {
+                key = found->key;
+            }
+
+            return (found != nullptr);
+        }
+
+
+    protected:
+
+        /** \brief Add an item to the reverse index */
+        void indexItem(const KeyType& key, const ItemType& item) { m_index.add(ReverseKey(item, key), NoItem()); }
+
+        /** \brief Remove an item from the reverse index */
+        void unindexItem(const KeyType& key, const ItemType& item) { m_index.remove(ReverseKey(item, key)); }
+
+        /** \brief Check if the reverse index contains an item */
+        bool containsIndexedItem(const ItemType& item) const { return (m_index.findEquivalentKey(item) != nullptr); }
+
+        /** \brief Remove all the items from the reverse index */
+        void clearIndex() { m_index.clear(); }
+
+
+    private:
+
+        /** \brief Key of the reverse index : item and key of a map entry */
+        struct ReverseKey
+        {
+            /** \brief Item */
+            ItemType item;
+            /** \brief Key */
+            KeyType key;
+
+            /** \brief Default constructor */
+            ReverseKey() : item(), key() {}
+
+            /** \brief Constructor */
+            ReverseKey(const ItemType& _item, const KeyType& _key) : item(_item), key(_key) {}
+        };
+
+        /** \brief Three-way comparator of the reverse index keys : by item, then by key */
+        struct ReverseCompare
+        {
+            /** \brief Compare two reverse index keys */
+            int operator () (const ReverseKey& key1, const ReverseKey& key2) const
+            {
+                const int compare = Compare<ItemType>()(key1.item, key2.item);
+                return ((compare != 0) ? compare : ComparatorType()(key1.key, key2.key));
+            }
+
+            /** \brief Compare an item with a reverse index key (heterogeneous lookup of the keys mapped to an item) */
+            int operator () (const ItemType& item, const ReverseKey& key) const { return Compare<ItemType>()(item, key.item); }
+        };
+
+        /** \brief The reverse index only stores keys */
+        struct NoItem
+        {
+            /** \brief Comparison operator */
+            bool operator == (const NoItem&) const { return true; }
+        };
+
+
+        /** \brief Reverse index */
+        StaticBSTree<ReverseKey, NoItem, MAX_ITEM_COUNT, ReverseCompare> m_index;
+};
+
+
 /** \brief Static map implementation 
  *         The map memory is statically allocated by the class.
+ *         ComparatorType is the three-way comparator of the keys (see Compare).
+ *         REVERSE_INDEX enables a reverse index (item to key) for the maps whose item lookups are frequent (see MapReverseIndex).
 */
-template <typename KeyType, typename ItemType, nano_stl_size_t MAX_ITEM_COUNT>
-class StaticMap : public MapBase<KeyType, ItemType>
+template <typename KeyType, typename ItemType, nano_stl_size_t MAX_ITEM_COUNT, typename ComparatorType = Compare<KeyType>, bool REVERSE_INDEX = false>
+class StaticMap : public MapBase<KeyType, ItemType>, public MapReverseIndex<KeyType, ItemType, MAX_ITEM_COUNT, ComparatorType, REVERSE_INDEX>
 {
+    private:
+
+        /** \brief Internal binary search tree type */
+        typedef StaticBSTree<KeyType, typename IMap<KeyType, ItemType>::Node, MAX_ITEM_COUNT, ComparatorType> BSTreeType;
+
     public:
 
+        /** \brief Iterator on the items of the map in ascending key order 
+         *         (the iterator becomes invalid after the last item or after the maximum key of a bounded range) */
+        template <typename BSTreeIteratorType, typename ItemRefType>
+        class RangeIteratorBase
+        {
+            public:
+
+                /** \brief Constructor */
+                RangeIteratorBase(const BSTreeIteratorType& it) : m_it(it) {}
+
+                /** \brief Check if the iterator points to an item */
+                bool isValid() const { return m_it.isValid(); }
+
+                /** \brief Get the key of the current item */
+                const KeyType& getKey() const { return m_it.getKey(); }
+
+                /** \brief Get the current item */
+                ItemRefType& operator * () const { return (*m_it).item; }
+
+                /** \brief Move to the item with the next key in ascending order */
+                void operator ++ () { ++m_it; }
+
+            private:
+
+                /** \brief Iterator of the binary search tree */
+                BSTreeIteratorType m_it;
+        };
+
+        /** \brief Iterator on the items in ascending key order */
+        typedef RangeIteratorBase<typename BSTreeType::RangeIterator, ItemType> RangeIterator;
+
+        /** \brief Const iterator on the items in ascending key order */
+        typedef RangeIteratorBase<typename BSTreeType::ConstRangeIterator, const ItemType> ConstRangeIterator;
+
+
         /** \brief Constructor */
         StaticMap() : MapBase<KeyType, ItemType>(m_bstree)
         {}
 
+
+        ////// Reverse index maintenance //////
+
+
+        /** \brief Check if the map contains an item (uses the reverse index if enabled) */
+        virtual bool contains(const ItemType& item) const override
+        {
+            return (REVERSE_INDEX ? this->containsIndexedItem(item) : MapBase<KeyType, ItemType>::contains(item));
+        }
+
+        /** \brief Add an item to the map */
+        virtual bool add(const KeyType& key, const ItemType& item) override
+        {
+            const bool ret = MapBase<KeyType, ItemType>::add(key, item);
+            if (ret)
+            {
+                this->indexItem(key, item);
+            }
+
+            return ret;
+        }
+
+        /** \brief Remove an item from the map */
+        virtual bool remove(const KeyType& key) override
+        {
+            if (REVERSE_INDEX)
+            {
+                const ItemType* const item = this->find(key);
+                if (item != nullptr)
+                {
+                    this->unindexItem(key, *item);
+                }
+            }
+
+            return MapBase<KeyType, ItemType>::remove(key);
+        }
+
+        /** \brief Remove all the items from the map */
+        virtual void clear() override
+        {
+            MapBase<KeyType, ItemType>::clear();
+            this->clearIndex();
+        }
+
+
+        ////// Bulk assignment //////
+
+
+        /** \brief Replace the contents of the map by items sorted in strictly ascending key order 
+         *         (the balanced tree is built in O(n) without any key search, the map is left unchanged if the keys 
+         *          are not strictly ascending or if there are more items than the capacity) */
+        virtual bool assignSorted(const KeyType* const keys, const ItemType* const items, const nano_stl_size_t count) override
+        {
+            const bool ret = this->assignSortedNodes(m_bstree, keys, items, count);
+            if (ret && REVERSE_INDEX)
+            {
+                this->clearIndex();
+                for (nano_stl_size_t i = 0u; i < count; i++)
+                {
+                    this->indexItem(keys[i], items[i]);
+                }
+            }
+
+            return ret;
+        }
+
+
+        ////// Heterogeneous lookups //////
+
+
+        using MapBase<KeyType, ItemType>::containsKey;
+        using MapBase<KeyType, ItemType>::get;
+        using MapBase<KeyType, ItemType>::find;
+
+        /** \brief Check if the map contains a string key given by its characters and its length (heterogeneous lookup, see BSTreeBase) */
+        bool containsKey(const char* const key, const nano_stl_size_t length) const { return m_bstree.containsKey(key, length); }
+
+        /** \brief Get an item from the map with a string key given by its characters and its length (heterogeneous lookup, see BSTreeBase) */
+        bool get(const char* const key, const nano_stl_size_t length, ItemType& item) const
+        {
+            const ItemType* const found = find(key, length);
+            if (found != nullptr)
+            {
+                item = (*found);
+            }
+
+            return (found != nullptr);
+        }
+
+        /** \brief Look for an item with a string key given by its characters and its length (heterogeneous lookup, see BSTreeBase) */
+        ItemType* find(const char* const key, const nano_stl_size_t length)
+        {
+            typename IMap<KeyType, ItemType>::Node* const node = m_bstree.find(key, length);
+            return ((node != nullptr) ? &node->item : nullptr);
+        }
+
+        /** \brief Look for an item with a string key given by its characters and its length (heterogeneous lookup, see BSTreeBase) */
+        const ItemType* find(const char* const key, const nano_stl_size_t length) const
+        {
+            const typename IMap<KeyType, ItemType>::Node* const node = m_bstree.find(key, length);
+            return ((node != nullptr) ? &node->item : nullptr);
+        }
+
+
+        ////// Ordered queries //////
+
+
+        /** \brief Get an iterator on the item with the smallest key */
+        RangeIterator first() { return RangeIterator(m_bstree.first()); }
+
+        /** \brief Get an iterator on the item with the smallest key */
+        ConstRangeIterator first() const { return ConstRangeIterator(m_bstree.first()); }
+
+        /** \brief Get an iterator on the first item whose key is not less than a key */
+        RangeIterator lowerBound(const KeyType& key) { return RangeIterator(m_bstree.lowerBound(key)); }
+
+        /** \brief Get an iterator on the first item whose key is not less than a key */
+        ConstRangeIterator lowerBound(const KeyType& key) const { return ConstRangeIterator(m_bstree.lowerBound(key)); }
+
+        /** \brief Get an iterator on the first item whose key is greater than a key */
+        RangeIterator upperBound(const KeyType& key) { return RangeIterator(m_bstree.upperBound(key)); }
+
+        /** \brief Get an iterator on the first item whose key is greater than a key */
+        ConstRangeIterator upperBound(const KeyType& key) const { return ConstRangeIterator(m_bstree.upperBound(key)); }
+
+        /** \brief Get an iterator on the item with the greatest key less than or equal to a key */
+        RangeIterator floor(const KeyType& key) { return RangeIterator(m_bstree.floor(key)); }
+
+        /** \brief Get an iterator on the item with the greatest key less than or equal to a key */
+        ConstRangeIterator floor(const KeyType& key) const { return ConstRangeIterator(m_bstree.floor(key)); }
+
+        /** \brief Get an iterator on the item with the smallest key greater than or equal to a key (same as lowerBound) */
+        RangeIterator ceiling(const KeyType& key) { return RangeIterator(m_bstree.ceiling(key)); }
+
+        /** \brief Get an iterator on the item with the smallest key greater than or equal to a key (same as lowerBound) */
+        ConstRangeIterator ceiling(const KeyType& key) const { return ConstRangeIterator(m_bstree.ceiling(key)); }
+
+        /** \brief Get an iterator on the items whose keys are in the [min_key, max_key] range */
+        RangeIterator range(const KeyType& min_key, const KeyType& max_key) { return RangeIterator(m_bstree.range(min_key, max_key)); }
+
+        /** \brief Get an iterator on the items whose keys are in the [min_key, max_key] range */
+        ConstRangeIterator range(const KeyType& min_key, const KeyType& max_key) const { return ConstRangeIterator(m_bstree.range(min_key, max_key)); }
+
     private:
 
         /** \brief Internal binary search tree */
-        StaticBSTree<KeyType, typename IMap<KeyType, ItemType>::Node, MAX_ITEM_COUNT> m_bstree;
+        BSTreeType m_bstree;
 
 };
 
@@ -0,0 +1,397 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STATICSLIMMAP_H
+#define STATICSLIMMAP_H
+
+#include "StaticBSTree.h"
+
+namespace nano_stl
+{
+
+/** \brief Insertion order policy of the slim maps : no insertion order list, the stored entry is the item only */
+template <typename ItemType, bool INSERTION_ORDER>
+class SlimMapOrder
+{
+    public:
+
+        /** \brief Stored entry */
+        typedef ItemType Entry;
+
+
+    protected:
+
+        /** \brief Get the item of an entry */
+        static ItemType& getItem(Entry& entry) { return entry; }
+
+        /** \brief Get the item of an entry */
+        static const ItemType& getItem(const Entry& entry) { return entry; }
+
+        /** \brief Add an entry to a binary search tree */
+        template <typename KeyType, typename BSTreeType>
+        bool addEntry(BSTreeType& bstree, const KeyType& key, const ItemType& item) { return bstree.add(key, item); }
+
+        /** \brief Replace the entries of a binary search tree by items sorted in strictly ascending key order */
+        template <typename KeyType, typename BSTreeType>
+        bool assignEntries(BSTreeType& bstree, const KeyType* const keys, const ItemType* const items, const nano_stl_size_t count) 
+        { 
+            return bstree.assignSorted(keys, items, count); 
+        }
+
+        /** \brief Remove an entry from a binary search tree */
+        template <typename KeyType, typename BSTreeType>
+        bool removeEntry(BSTreeType& bstree, const KeyType& key) { return bstree.remove(key); }
+
+        /** \brief Check if a binary search tree contains an item */
+        template <typename BSTreeType>
+        bool containsEntry(const BSTreeType& bstree, const ItemType& item) const { return bstree.contains(item); }
+
+        /** \brief Remove all the entries from the insertion order list */
+        void clearEntries() {}
+};
+
+/** \brief Insertion order policy of the slim maps : the stored entries are linked in an insertion order list */
+template <typename ItemType>
+class SlimMapOrder<ItemType, true>
+{
+    public:
+
+        /** \brief Stored entry */
+        struct Entry
+        {
+            /** \brief Item */
+            ItemType item;
+            /** \brief Previous entry in insertion order */
+            Entry* previous;
+            /** \brief Next entry in insertion order */
+            Entry* next;
+
+            /** \brief Comparison operator */
+            bool operator == (const Entry& entry) const { return (item == entry.item); }
+        };
+
+
+        /** \brief Call a visitor on each item of the map from the oldest to the most recently added */
+        template <typename VisitorType>
+        void forEach(VisitorType visitor)
+        {
+            for (Entry* entry = m_first; entry != nullptr; entry = entry->next)
+            {
+                visitor(entry->item);
+            }
+        }
+
+        /** \brief Call a visitor on each item of the map from the oldest to the most recently added */
+        template <typename VisitorType>
+        void forEach(VisitorType visitor) const
+        {
+            for (const Entry* entry = m_first; entry != nullptr; entry = entry->next)
+            {
+                visitor(entry->item);
+            }
+        }
+
+
+    protected:
+
+        /** \brief Constructor */
+        SlimMapOrder()
+        : m_first(nullptr)
+        , m_last(nullptr)
+        {}
+
+        /** \brief Get the item of an entry */
+        static ItemType& getItem(Entry& entry) { return entry.item; }
+
+        /** \brief Get the item of an entry */
+        static const ItemType& getItem(const Entry& entry) { return entry.item; }
+
+        /** \brief Add an entry to a binary search tree and append it to the insertion order list */
+        template <typename KeyType, typename BSTreeType>
+        bool addEntry(BSTreeType& bstree, const KeyType& key, const ItemType& item)
+        {
+            Entry entry;
+            entry.item = item;
+            const bool ret = bstree.add(key, entry);
+            if (ret)
+            {
+                Entry* const added_entry = bstree.getLastModified();
+                added_entry->previous = m_last;
+                added_entry->next = nullptr;
+                if (m_last != nullptr)
+                {
+                    m_last->next = added_entry;
+                }
+                else
+                {
+                    m_first = added_entry;
+                }
+                m_last = added_entry;
+            }
+
+            return ret;
+        }
+
+        /** \brief Initializer of the bulk assignment which copies the items from an array and appends 
+         *         the entries to the insertion order list */
+        struct EntriesLinker
+        {
+            /** \brief Constructor */
+            EntriesLinker(const ItemType* const _items, Entry*& _first, Entry*& _last) 
+            : items(_items)
+            , first(_first)
+            , last(_last)
+            {}
+
+            /** \brief Copy the item of the given index and append its entry */
+            void operator () (const nano_stl_size_t index, Entry& entry) const
+            {
+                entry.item = items[index];
+                entry.previous = last;
+                entry.next = nullptr;
+                if (last != nullptr)
+                {
+                    last->next = &entry;
+                }
+                else
+                {
+                    first = &entry;
+                }
+                last = &entry;
+            }
+
+            /** \brief Items to copy */
+            const ItemType* const items;
+            /** \brief First appended entry */
+            Entry*& first;
+            /** \brief Last appended entry */
+            Entry*& last;
+        };
+
+        /** \brief Replace the entries of a binary search tree by items sorted in strictly ascending key order 
+         *         (the entries are linked as if the items had been added in this order) */
+        template <typename KeyType, typename BSTreeType>
+        bool assignEntries(BSTreeType& bstree, const KeyType* const keys, const ItemType* const items, const nano_stl_size_t count)
+        {
+            Entry* first = nullptr;
+            Entry* last = nullptr;
+            const bool ret = bstree.assignSorted(keys, count, EntriesLinker(items, first, last));
+            if (ret)
+            {
+                m_first = first;
+                m_last = last;
+            }
+
+            return ret;
+        }
+
+        /** \brief Remove an entry from a binary search tree and from the insertion order list */
+        template <typename KeyType, typename BSTreeType>
+        bool removeEntry(BSTreeType& bstree, const KeyType& key)
+        {
+            const bool ret = bstree.remove(key);
+            if (ret)
+            {
+                Entry* const removed_entry = bstree.getLastModified();
+                if (removed_entry->previous != nullptr)
+                {
+                    removed_entry->previous->next = removed_entry->next;
+                }
+                else
+                {
+                    m_first = removed_entry->next;
+                }
+                if (removed_entry->next != nullptr)
+                {
+                    removed_entry->next->previous = removed_entry->previous;
+                }
+                else
+                {
+                    m_last = removed_entry->previous;
+                }
+            }
+
+            return ret;
+        }
+
+        /** \brief Check if a binary search tree contains an item */
+        template <typename BSTreeType>
+        bool containsEntry(const BSTreeType& bstree, const ItemType& item) const
+        {
+            bool contains = false;
+            for (const Entry* entry = m_first; !contains && (entry != nullptr); entry = entry->next)
+            {
+                contains = (entry->item == item);
+            }
+            (void)bstree;
+
+            return contains;
+        }
+
+        /** \brief Remove all the entries from the insertion order list */
+        void clearEntries()
+        {
+            m_first = nullptr;
+            m_last = nullptr;
+        }
+
+
+    private:
+
+        /** \brief Oldest entry */
+        Entry* m_first;
+
+        /** \brief Most recently added entry */
+        Entry* m_last;
+};
+
+
+/** \brief Static slim map implementation 
+ *         The map memory is statically allocated by the class.
+ *         Unlike StaticMap, a node only stores the key, the item and the tree links : the lookups return pointers 
+ *         to the stored items and the insertion order list (needed for iteration) is opt-in with INSERTION_ORDER.
+ *         ComparatorType is the three-way comparator of the keys (see Compare).
+*/
+template <typename KeyType, typename ItemType, nano_stl_size_t MAX_ITEM_COUNT, bool INSERTION_ORDER = false, typename ComparatorType = Compare<KeyType> >
+class StaticSlimMap : public SlimMapOrder<ItemType, INSERTION_ORDER>
+{
+    public:
+
+        /** \brief Stored entry */
+        typedef typename SlimMapOrder<ItemType, INSERTION_ORDER>::Entry Entry;
+
+
+        /** \brief Constructor */
+        StaticSlimMap() 
+        : SlimMapOrder<ItemType, INSERTION_ORDER>()
+        , m_bstree()
+        {}
+
+        /** \brief Get the number of objects that the map can handle */
+        nano_stl_size_t getCapacity() const { return m_bstree.getCapacity(); }
+
+        /** \brief Get the number of objects that the map contains */
+        nano_stl_size_t getCount() const { return m_bstree.getCount(); }
+
+        /** \brief Check if the map contains an item */
+        bool contains(const ItemType& item) const { return this->containsEntry(m_bstree, item); }
+
+        /** \brief Get the item corresponding to a key */
+        ItemType& operator [] (const KeyType& key) { return this->getItem(m_bstree[key]); }
+
+        /** \brief Get the item corresponding to a key */
+        const ItemType& operator [] (const KeyType& key) const { return this->getItem(m_bstree[key]); }
+
+        /** \brief Add an item to the map */
+        bool add(const KeyType& key, const ItemType& item) { return this->addEntry(m_bstree, key, item); }
+
+        /** \brief Replace the contents of the map by items sorted in strictly ascending key order 
+         *         (the balanced tree is built in O(n) without any key search, the map is left unchanged if the keys 
+         *          are not strictly ascending or if there are more items than the capacity) */
+        bool assignSorted(const KeyType* const keys, const ItemType* const items, const nano_stl_size_t count) 
+        { 
+            return this->assignEntries(m_bstree, keys, items, count); 
+        }
+
+        /** \brief Check if the map contains a specific key */
+        bool containsKey(const KeyType& key) const { return m_bstree.containsKey(key); }
+
+        /** \brief Get an item from the map */
+        bool get(const KeyType& key, ItemType& item) const
+        {
+            const ItemType* const found = find(key);
+            if (found != nullptr)
+            {
+                item = (*found);
+            }
+
+            return (found != nullptr);
+        }
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        ItemType* find(const KeyType& key)
+        {
+            Entry* const entry = m_bstree.find(key);
+            return ((entry != nullptr) ? &this->getItem(*entry) : nullptr);
+        }
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        const ItemType* find(const KeyType& key) const
+        {
+            const Entry* const entry = m_bstree.find(key);
+            return ((entry != nullptr) ? &this->getItem(*entry) : nullptr);
+        }
+
+        /** \brief Check if the map contains a string key given by its characters and its length (heterogeneous lookup, see BSTreeBase) */
+        bool containsKey(const char* const key, const nano_stl_size_t length) const { return m_bstree.containsKey(key, length); }
+
+        /** \brief Get an item from the map with a string key given by its characters and its length (heterogeneous lookup, see BSTreeBase) */
+        bool get(const char* const key, const nano_stl_size_t length, ItemType& item) const
+        {
+            const ItemType* const found = find(key, length);
+            if (found != nullptr)
+            {
+                item = (*found);
+            }
+
+            return (found != nullptr);
+        }
+
+        /** \brief Look for an item with a string key given by its characters and its length (heterogeneous lookup, see BSTreeBase) */
+        ItemType* find(const char* const key, const nano_stl_size_t length)
+        {
+            Entry* const entry = m_bstree.find(key, length);
+            return ((entry != nullptr) ? &this->getItem(*entry) : nullptr);
+        }
+
+        /** \brief Look for an item with a string key given by its characters and its length (heterogeneous lookup, see BSTreeBase) */
+        const ItemType* find(const char* const key, const nano_stl_size_t length) const
+        {
+            const Entry* const entry = m_bstree.find(key, length);
+            return ((entry != nullptr) ? &this->getItem(*entry) : nullptr);
+        }
+
+        /** \brief Remove an item from the map */
+        bool remove(const KeyType& key) { return this->removeEntry(m_bstree, key); }
+
+        /** \brief Remove all the items from the map */
+        void clear()
+        {
+            m_bstree.clear();
+            this->clearEntries();
+        }
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+        /** \brief Get the usage statistics of the map */
+        IContainerStats& getStats() { return m_bstree.getStats(); }
+
+#endif // NANO_STL_STATS_ENABLED
+
+
+    private:
+
+        /** \brief Underlying binary search tree */
+        StaticBSTree<KeyType, Entry, MAX_ITEM_COUNT, ComparatorType> m_bstree;
+};
+
+}
+
+#endif // STATICSLIMMAP_H
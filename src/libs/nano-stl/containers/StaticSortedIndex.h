@@ -0,0 +1,402 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STATICSORTEDINDEX_H
+#define STATICSORTEDINDEX_H
+
+#include "IArray.h"
+#include "Compare.h"
+
+
+namespace nano_stl
+{
+
+/** \brief Layouts of the keys of the sorted indexes */
+enum SortedIndexLayout
+{
+    /** \brief Eytzinger layout : the keys are stored in the breadth first order of an implicit binary search tree 
+     *         and the searches prefetch the keys of the levels below the current one */
+    SORTED_INDEX_EYTZINGER = 0,
+    /** \brief van Emde Boas layout : the implicit binary search tree is recursively split into a top tree and bottom 
+     *         trees which are stored contiguously so that any search path touches few cache lines whatever their size 
+     *         (the tree is completed with copies of the greatest key) */
+    SORTED_INDEX_VAN_EMDE_BOAS = 1
+};
+
+
+/** \brief Size of the smallest complete binary tree which can store a number of keys */
+template <nano_stl_size_t KEY_COUNT, nano_stl_size_t SIZE = 1u, bool DONE = (SIZE >= KEY_COUNT)>
+struct SortedIndexTreeSize
+{
+    /** \brief Number of nodes */
+    static const nano_stl_size_t value = SortedIndexTreeSize<KEY_COUNT, (2u * SIZE) + 1u>::value;
+};
+
+/** \brief Size of the smallest complete binary tree which can store a number of keys */
+template <nano_stl_size_t KEY_COUNT, nano_stl_size_t SIZE>
+struct SortedIndexTreeSize<KEY_COUNT, SIZE, true>
+{
+    /** \brief Number of nodes */
+    static const nano_stl_size_t value = SIZE;
+};
+
+/** \brief Number of key slots of a sorted index */
+template <nano_stl_size_t MAX_KEY_COUNT, SortedIndexLayout LAYOUT>
+struct SortedIndexSlotCount
+{
+    /** \brief Number of slots */
+    static const nano_stl_size_t value = ((LAYOUT == SORTED_INDEX_EYTZINGER) ? MAX_KEY_COUNT : SortedIndexTreeSize<MAX_KEY_COUNT>::value);
+};
+
+
+/** \brief Position of the nodes of the implicit binary search tree of a sorted index : Eytzinger layout */
+template <SortedIndexLayout LAYOUT>
+class SortedIndexPositions
+{
+    protected:
+
+        /** \brief Maximum depth of the implicit binary search tree */
+        static const nano_stl_size_t MAX_DEPTH = 32u;
+
+        /** \brief Compute the positions of the nodes for a tree height */
+        void initPositions(const nano_stl_size_t height) { (void)height; }
+
+        /** \brief Get the slot of a node from its breadth first index (starting at 1) */
+        nano_stl_size_t getSlot(const nano_stl_size_t slots[], const nano_stl_size_t depth, const nano_stl_size_t index) const
+        {
+            (void)slots;
+            (void)depth;
+            return (index - 1u);
+        }
+};
+
+/** \brief Position of the nodes of the implicit binary search tree of a sorted index : van Emde Boas layout 
+ *         (the slot of a node is computed from the slot of the root of the top tree above it, see initPositions())
+*/
+template <>
+class SortedIndexPositions<SORTED_INDEX_VAN_EMDE_BOAS>
+{
+    protected:
+
+        /** \brief Maximum depth of the implicit binary search tree */
+        static const nano_stl_size_t MAX_DEPTH = 32u;
+
+        /** \brief Constructor */
+        SortedIndexPositions()
+        : m_top_sizes()
+        , m_bottom_sizes()
+        , m_top_depths()
+        {}
+
+        /** \brief Compute the positions of the nodes for a tree height */
+        void initPositions(const nano_stl_size_t height) { split(1u, height); }
+
+        /** \brief Get the slot of a node from its breadth first index (starting at 1) and from the slots 
+         *         of its ancestors (indexed by depth, starting at 1 for the root) */
+        nano_stl_size_t getSlot(const nano_stl_size_t slots[], const nano_stl_size_t depth, const nano_stl_size_t index) const
+        {
+            nano_stl_size_t slot = 0u;
+            if (depth != 1u)
+            {
+                const nano_stl_size_t top_size = m_top_sizes[depth];
+                slot = slots[m_top_depths[depth]] + top_size + ((index & top_size) * m_bottom_sizes[depth]);
+            }
+            return slot;
+        }
+
+
+    private:
+
+        /** \brief Size of the top tree whose leaves are the parents of the nodes at each depth */
+        nano_stl_size_t m_top_sizes[MAX_DEPTH + 1u];
+
+        /** \brief Size of the bottom trees whose roots are the nodes at each depth */
+        nano_stl_size_t m_bottom_sizes[MAX_DEPTH + 1u];
+
+        /** \brief Depth of the root of the top tree whose leaves are the parents of the nodes at each depth */
+        uint8_t m_top_depths[MAX_DEPTH + 1u];
+
+
+        /** \brief Split a sub-tree into a top tree and bottom trees : the top tree is stored first, followed by the bottom 
+         *         trees from left to right, each of them being recursively split the same way */
+        void split(const nano_stl_size_t top_depth, const nano_stl_size_t height)
+        {
+            if (height > 1u)
+            {
+                const nano_stl_size_t top_height = (height / 2u);
+                const nano_stl_size_t bottom_height = (height - top_height);
+                const nano_stl_size_t depth = (top_depth + top_height);
+
+                m_top_sizes[depth] = ((1u << top_height) - 1u);
+                m_bottom_sizes[depth] = ((1u << bottom_height) - 1u);
+                m_top_depths[depth] = static_cast<uint8_t>(top_depth);
+
+                split(top_depth, top_height);
+                split(depth, bottom_height);
+            }
+        }
+};
+
+
+/** \brief Static sorted index implementation 
+ *         Read-only set of sorted keys built once (typically at startup) and laid out as an implicit binary search tree 
+ *         (see SortedIndexLayout) : the lookups need no links and touch less cache lines than a binary search in a sorted array.
+ *         The lookups return the slot of a key : the initializer given to build() receives the rank and the slot of each key 
+ *         so that the items of a map can be stored in a parallel array of SLOT_COUNT items indexed by slot.
+ *         ComparatorType is the three-way comparator of the keys (see Compare).
+*/
+template <typename KeyType, nano_stl_size_t MAX_KEY_COUNT, SortedIndexLayout LAYOUT = SORTED_INDEX_EYTZINGER, typename ComparatorType = Compare<KeyType> >
+class StaticSortedIndex : public SortedIndexPositions<LAYOUT>
+{
+    public:
+
+        /** \brief Number of key slots */
+        static const nano_stl_size_t SLOT_COUNT = SortedIndexSlotCount<MAX_KEY_COUNT, LAYOUT>::value;
+
+        /** \brief Slot returned when no key is found */
+        static const nano_stl_size_t INVALID_SLOT = SLOT_COUNT;
+
+
+        /** \brief Constructor */
+        StaticSortedIndex()
+        : SortedIndexPositions<LAYOUT>()
+        , m_keys()
+        , m_count(0u)
+        , m_node_count(0u)
+        , m_comparator()
+        {}
+
+
+        /** \brief Get the maximum number of keys */
+        nano_stl_size_t getCapacity() const { return MAX_KEY_COUNT; }
+
+        /** \brief Get the number of keys */
+        nano_stl_size_t getCount() const { return m_count; }
+
+        /** \brief Build the index from keys sorted in strictly ascending order 
+         *         (the index is left unchanged if the keys are not strictly ascending or if there are more keys than the capacity) */
+        bool build(const KeyType* const keys, const nano_stl_size_t count) 
+        { 
+            return buildFrom(keys, count, NoInitializer()); 
+        }
+
+        /** \brief Build the index from keys sorted in strictly ascending order (the initializer is called with the rank 
+         *         and the slot of each key, the index is left unchanged if the keys are not strictly ascending or if there 
+         *         are more keys than the capacity) */
+        template <typename InitializerType>
+        bool build(const KeyType* const keys, const nano_stl_size_t count, InitializerType initializer) 
+        { 
+            return buildFrom(keys, count, initializer); 
+        }
+
+        /** \brief Build the index from an array of keys sorted in strictly ascending order 
+         *         (the index is left unchanged if the keys are not strictly ascending or if there are more keys than the capacity) */
+        bool build(const IArray<KeyType>& keys) 
+        { 
+            return buildFrom(keys, keys.getCount(), NoInitializer()); 
+        }
+
+        /** \brief Build the index from an array of keys sorted in strictly ascending order (the initializer is called with 
+         *         the rank and the slot of each key, the index is left unchanged if the keys are not strictly ascending or 
+         *         if there are more keys than the capacity) */
+        template <typename InitializerType>
+        bool build(const IArray<KeyType>& keys, InitializerType initializer) 
+        { 
+            return buildFrom(keys, keys.getCount(), initializer); 
+        }
+
+        /** \brief Remove all the keys */
+        void clear()
+        {
+            m_count = 0u;
+            m_node_count = 0u;
+        }
+
+        /** \brief Get the slot of the smallest key which is not less than a key (INVALID_SLOT if all the keys are less) */
+        nano_stl_size_t lowerBound(const KeyType& key) const
+        {
+            return ((LAYOUT == SORTED_INDEX_EYTZINGER) ? lowerBoundEytzinger(key) : lowerBoundTree(key));
+        }
+
+        /** \brief Get the slot of a key (INVALID_SLOT if the key is not found) */
+        nano_stl_size_t find(const KeyType& key) const
+        {
+            nano_stl_size_t slot = lowerBound(key);
+            if ((slot != INVALID_SLOT) && (m_comparator(key, m_keys[slot]) != 0))
+            {
+                slot = INVALID_SLOT;
+            }
+            return slot;
+        }
+
+        /** \brief Check if the index contains a key */
+        bool contains(const KeyType& key) const { return (find(key) != INVALID_SLOT); }
+
+        /** \brief Get the key stored in a slot */
+        const KeyType& getKey(const nano_stl_size_t slot) const { return m_keys[slot]; }
+
+
+    private:
+
+        /** \brief Keys in the order of the layout */
+        KeyType m_keys[SLOT_COUNT];
+
+        /** \brief Number of keys */
+        nano_stl_size_t m_count;
+
+        /** \brief Number of nodes of the implicit binary search tree */
+        nano_stl_size_t m_node_count;
+
+        /** \brief Keys comparator */
+        ComparatorType m_comparator;
+
+
+        /** \brief Initializer of the builds without initializer : does nothing */
+        struct NoInitializer
+        {
+            /** \brief Called with the rank and the slot of each key */
+            void operator () (const nano_stl_size_t, const nano_stl_size_t) const {}
+        };
+
+        /** \brief Build the index from sorted keys (SourceType is a C array or an IArray) */
+        template <typename SourceType, typename InitializerType>
+        bool buildFrom(const SourceType& keys, const nano_stl_size_t count, InitializerType initializer)
+        {
+            // Check the keys
+            bool ret = (count <= MAX_KEY_COUNT);
+            for (nano_stl_size_t i = 1u; ret && (i < count); i++)
+            {
+                ret = (m_comparator(keys[i - 1u], keys[i]) < 0);
+            }
+            if (ret)
+            {
+                // Compute the size of the tree
+                nano_stl_size_t height = 0u;
+                nano_stl_size_t complete_count = 0u;
+                while (complete_count < count)
+                {
+                    complete_count = (2u * complete_count) + 1u;
+                    height++;
+                }
+                m_count = count;
+                m_node_count = ((LAYOUT == SORTED_INDEX_EYTZINGER) ? count : complete_count);
+                this->initPositions(height);
+
+                // Store the keys by an in-order traversal of the tree
+                nano_stl_size_t slots[SortedIndexPositions<LAYOUT>::MAX_DEPTH + 1u];
+                nano_stl_size_t rank = 0u;
+                buildNode(keys, 1u, 1u, slots, rank, initializer);
+            }
+
+            return ret;
+        }
+
+        /** \brief Store the keys of a sub-tree of the implicit binary search tree */
+        template <typename SourceType, typename InitializerType>
+        void buildNode(const SourceType& keys, const nano_stl_size_t index, const nano_stl_size_t depth, nano_stl_size_t slots[], 
+                       nano_stl_size_t& rank, InitializerType& initializer)
+        {
+            if (index <= m_node_count)
+            {
+                const nano_stl_size_t slot = this->getSlot(slots, depth, index);
+                slots[depth] = slot;
+
+                buildNode(keys, (2u * index), (depth + 1u), slots, rank, initializer);
+                if (rank < m_count)
+                {
+                    m_keys[slot] = keys[rank];
+                    initializer(rank, slot);
+                }
+                else
+                {
+                    // Complete the tree
+                    m_keys[slot] = keys[m_count - 1u];
+                }
+                rank++;
+                buildNode(keys, ((2u * index) + 1u), (depth + 1u), slots, rank, initializer);
+            }
+        }
+
+        /** \brief Get the slot of the lower bound of a key : Eytzinger layout */
+        nano_stl_size_t lowerBoundEytzinger(const KeyType& key) const
+        {
+            nano_stl_size_t index = 1u;
+            while (index <= m_node_count)
+            {
+                // Prefetch the 16 consecutive keys of the 4th level below the current node
+                const nano_stl_size_t prefetch_index = (index << 4u);
+                if (prefetch_index <= m_node_count)
+                {
+                    NANO_STL_PREFETCH(&m_keys[prefetch_index - 1u]);
+                }
+                index = (2u * index) + ((m_comparator(m_keys[index - 1u], key) < 0) ? 1u : 0u);
+            }
+
+            return getLowerBound(index, nullptr, 0u);
+        }
+
+        /** \brief Get the slot of the lower bound of a key : layouts where the slots are computed during the search */
+        nano_stl_size_t lowerBoundTree(const KeyType& key) const
+        {
+            nano_stl_size_t slots[SortedIndexPositions<LAYOUT>::MAX_DEPTH + 1u];
+            nano_stl_size_t index = 1u;
+            nano_stl_size_t depth = 1u;
+            while (index <= m_node_count)
+            {
+                const nano_stl_size_t slot = this->getSlot(slots, depth, index);
+                slots[depth] = slot;
+                index = (2u * index) + ((m_comparator(m_keys[slot], key) < 0) ? 1u : 0u);
+                depth++;
+            }
+
+            return getLowerBound(index, slots, depth);
+        }
+
+        /** \brief Get the slot of the lower bound from the index where a search has ended : the lower bound is the last node 
+         *         where the search went to the left, the trailing moves to the right and this last move to the left are removed */
+        nano_stl_size_t getLowerBound(nano_stl_size_t index, const nano_stl_size_t slots[], nano_stl_size_t depth) const
+        {
+            while ((index & 1u) != 0u)
+            {
+                index >>= 1u;
+                depth--;
+            }
+            index >>= 1u;
+            depth--;
+
+            nano_stl_size_t slot = INVALID_SLOT;
+            if (index != 0u)
+            {
+                slot = ((slots == nullptr) ? (index - 1u) : slots[depth]);
+            }
+            return slot;
+        }
+};
+
+/** \brief Number of key slots */
+template <typename KeyType, nano_stl_size_t MAX_KEY_COUNT, SortedIndexLayout LAYOUT, typename ComparatorType>
+const nano_stl_size_t StaticSortedIndex<KeyType, MAX_KEY_COUNT, LAYOUT, ComparatorType>::SLOT_COUNT;
+
+/** \brief Slot returned when no key is found */
+template <typename KeyType, nano_stl_size_t MAX_KEY_COUNT, SortedIndexLayout LAYOUT, typename ComparatorType>
+const nano_stl_size_t StaticSortedIndex<KeyType, MAX_KEY_COUNT, LAYOUT, ComparatorType>::INVALID_SLOT;
+
+}
+
+#endif // STATICSORTEDINDEX_H
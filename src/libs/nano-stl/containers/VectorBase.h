@@ -22,6 +22,7 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "IVector.h"
 #include "IErrorHandler.h"
+#include "ContainerStats.h"
 
 namespace nano_stl
 {
@@ -29,12 +30,25 @@ namespace nano_stl
 /** \brief Base class for all vectors implementations */
 template <typename ItemType>
 class VectorBase : public IVector<ItemType>
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+                 , public ContainerStats
+#endif // NANO_STL_STATS_ENABLED
 {
     public:
 
         /** \brief Constructor */
         VectorBase(ItemType* const items, const nano_stl_size_t size)
-        : m_items(items)
+        :
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+          ContainerStats(m_count, size),
+
+#endif // NANO_STL_STATS_ENABLED
+
+          m_items(items)
         , m_size(size)
         , m_count(0u)
 
@@ -161,6 +175,11 @@ class VectorBase : public IVector<ItemType>
                 ret = true;
             }
 
+            // Check if containers statistics are enabled
+            #if (NANO_STL_STATS_ENABLED == 1)
+            ContainerStats::recordInsert(ret);
+            #endif // NANO_STL_STATS_ENABLED
+
             return ret;
         }
 
@@ -0,0 +1,39 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef COMPARE_H
+#define COMPARE_H
+
+namespace nano_stl
+{
+
+/** \brief Default three-way comparator of the binary search trees and maps keys : integer, enum and any key type 
+ *         with a lower than operator (specialize this template or give another comparator to the containers for 
+ *         the key types which can be compared in a single operation)
+*/
+template <typename KeyType>
+struct Compare
+{
+    /** \brief Compare two keys : negative if key1 < key2, 0 if the keys are equal, positive if key1 > key2 */
+    int operator () (const KeyType& key1, const KeyType& key2) const { return ((key1 < key2) ? -1 : ((key2 < key1) ? 1 : 0)); }
+};
+
+}
+
+#endif // COMPARE_H
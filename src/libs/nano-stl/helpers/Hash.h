@@ -0,0 +1,94 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef HASH_H
+#define HASH_H
+
+#include "nano-stl-conf.h"
+
+namespace nano_stl
+{
+
+/** \brief Integer hash function (finalizer of the MurmurHash3 algorithm, every bit of the key affects every bit of the hash) */
+template <bool WIDE_KEY>
+struct HashInteger
+{
+    /** \brief Compute the hash of a 32 bits or smaller integer */
+    static uint32_t hash(uint32_t value)
+    {
+        value ^= (value >> 16u);
+        value *= 0x85EBCA6Bu;
+        value ^= (value >> 13u);
+        value *= 0xC2B2AE35u;
+        value ^= (value >> 16u);
+        return value;
+    }
+};
+
+/** \brief Integer hash function for keys wider than 32 bits */
+template <>
+struct HashInteger<true>
+{
+    /** \brief Compute the hash of a 64 bits integer 
+     *         (the 64 bits constants are built from 32 bits halves since C++98 has no 64 bits literals) */
+    static uint32_t hash(uint64_t value)
+    {
+        value ^= (value >> 33u);
+        value *= ((static_cast<uint64_t>(0xFF51AFD7u) << 32u) | 0xED558CCDu);
+        value ^= (value >> 33u);
+        value *= ((static_cast<uint64_t>(0xC4CEB9FEu) << 32u) | 0x1A85EC53u);
+        value ^= (value >> 33u);
+        return static_cast<uint32_t>(value);
+    }
+};
+
+/** \brief String hash function (FNV-1a) */
+static inline uint32_t HASH_String(const char* str, const nano_stl_size_t length)
+{
+    uint32_t hash = 0x811C9DC5u;
+    for (nano_stl_size_t i = 0u; i < length; i++)
+    {
+        hash ^= static_cast<uint8_t>(str[i]);
+        hash *= 0x01000193u;
+    }
+    return hash;
+}
+
+
+/** \brief Default hasher of the hash maps keys : integer and enum keys 
+ *         (specialize this template or give another hasher to the hash maps for the other key types)
+*/
+template <typename KeyType>
+struct Hash
+{
+    /** \brief Compute the hash of a key */
+    uint32_t operator () (const KeyType& key) const { return HashInteger<(sizeof(KeyType) > sizeof(uint32_t))>::hash(key); }
+};
+
+/** \brief Default hasher of the hash maps keys : pointer keys */
+template <typename KeyType>
+struct Hash<KeyType*>
+{
+    /** \brief Compute the hash of a key */
+    uint32_t operator () (KeyType* const key) const { return HashInteger<(sizeof(KeyType*) > sizeof(uint32_t))>::hash(reinterpret_cast<uintptr_t>(key)); }
+};
+
+}
+
+#endif // HASH_H
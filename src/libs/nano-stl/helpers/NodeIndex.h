@@ -0,0 +1,63 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NODEINDEX_H
+#define NODEINDEX_H
+
+#include "nano-stl-conf.h"
+
+namespace nano_stl
+{
+
+/** \brief Select the smallest unsigned integer type able to index a nodes array 
+ *         (the maximum value of the type is reserved to represent a null link) */
+template <bool FITS_8_BITS, bool FITS_16_BITS>
+struct NodeIndexSelect
+{
+    /** \brief Index type */
+    typedef uint32_t Type;
+};
+
+/** \brief Nodes arrays of less than 255 nodes are indexed on 8 bits */
+template <bool FITS_16_BITS>
+struct NodeIndexSelect<true, FITS_16_BITS>
+{
+    /** \brief Index type */
+    typedef uint8_t Type;
+};
+
+/** \brief Nodes arrays of less than 65535 nodes are indexed on 16 bits */
+template <>
+struct NodeIndexSelect<false, true>
+{
+    /** \brief Index type */
+    typedef uint16_t Type;
+};
+
+/** \brief Index type of the links between the nodes of a nodes array of MAX_NODE_COUNT nodes */
+template <nano_stl_size_t MAX_NODE_COUNT>
+struct NodeIndex
+{
+    /** \brief Index type */
+    typedef typename NodeIndexSelect<(MAX_NODE_COUNT < 0xFFu), (MAX_NODE_COUNT < 0xFFFFu)>::Type Type;
+};
+
+}
+
+#endif // NODEINDEX_H
@@ -0,0 +1,60 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STRINGREF_H
+#define STRINGREF_H
+
+#include "nano-stl-conf.h"
+
+namespace nano_stl
+{
+
+/** \brief Read-only reference to a sequence of characters which does not need to be null terminated
+ *         (used to look for a string key in a container without copying the characters into a temporary string)
+*/
+struct StringRef
+{
+    /** \brief Constructor */
+    StringRef(const char* const _str, const nano_stl_size_t _length) : str(_str), length(_length) {}
+
+    /** \brief Compare the referenced characters with a string : negative if lower, 0 if equal, positive if greater
+     *         (the chars are compared as unsigned chars whatever the signedness of char, a shorter string is lower than 
+     *          the longer strings which start with the same chars) */
+    int compare(const char* const c_str, const nano_stl_size_t c_str_length) const
+    {
+        const nano_stl_size_t min_length = ((length < c_str_length) ? length : c_str_length);
+        int ret = NANO_STL_MEMCMP(str, c_str, min_length);
+        if (ret == 0)
+        {
+            ret = ((length < c_str_length) ? -1 : ((c_str_length < length) ? 1 : 0));
+        }
+        return ret;
+    }
+
+
+    /** \brief Characters */
+    const char* str;
+
+    /** \brief Number of characters */
+    nano_stl_size_t length;
+};
+
+}
+
+#endif // STRINGREF_H
@@ -21,6 +21,7 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 #define IBSTREE_H
 
 #include "IContainer.h"
+#include "IContainerStats.h"
 
 namespace nano_stl
 {
@@ -46,6 +47,12 @@ class IBSTree : public IContainer<ItemType>
         /** \brief Get an item from the binary search tree */
         virtual bool get(const KeyType& key, ItemType& item) const = 0;
 
+        /** \brief Look for an item in the binary search tree (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual ItemType* find(const KeyType& key) = 0;
+
+        /** \brief Look for an item in the binary search tree (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual const ItemType* find(const KeyType& key) const = 0;
+
         /** \brief Remove an item from the binary search tree */
         virtual bool remove(const KeyType& key) = 0;
 
@@ -57,6 +64,14 @@ class IBSTree : public IContainer<ItemType>
 
         /** \brief Get the last item which has been modified */
         virtual const ItemType* getLastModified() const = 0;
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+        /** \brief Get the usage statistics of the binary search tree */
+        virtual IContainerStats& getStats() = 0;
+
+#endif // NANO_STL_STATS_ENABLED
 };
 
 }
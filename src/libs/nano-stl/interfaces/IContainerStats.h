@@ -0,0 +1,70 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ICONTAINERSTATS_H
+#define ICONTAINERSTATS_H
+
+#include "nano-stl-conf.h"
+
+
+// Check if containers statistics are enabled
+#if (NANO_STL_STATS_ENABLED == 1)
+
+namespace nano_stl
+{
+
+class IString;
+
+
+/** \brief Interface to the usage statistics of a container (used to size the containers capacities) */
+class IContainerStats
+{
+    public:
+
+        /** \brief Get the maximum number of items which have been simultaneously stored in the container */
+        virtual nano_stl_size_t getHighWaterCount() const = 0;
+
+        /** \brief Get the number of insertions which have failed because the container was full */
+        virtual nano_stl_size_t getFailedInsertCount() const = 0;
+
+        /** \brief Get the number of items which have been overwritten because the container was full (ring buffers only) */
+        virtual nano_stl_size_t getOverwriteCount() const = 0;
+
+        /** \brief Get the maximum number of nodes visited by a key search (binary search trees and maps only) */
+        virtual nano_stl_size_t getMaxSearchDepth() const = 0;
+
+        /** \brief Get the number of key searches (binary search trees and maps only) */
+        virtual nano_stl_size_t getSearchCount() const = 0;
+
+        /** \brief Get the total number of nodes visited by the key searches, the average probe length 
+         *         is getProbeCount() / getSearchCount() (binary search trees and maps only) */
+        virtual nano_stl_size_t getProbeCount() const = 0;
+
+        /** \brief Reset the statistics (the high-water count restarts from the current item count) */
+        virtual void resetStats() = 0;
+
+        /** \brief Write the statistics on a single line into a string */
+        virtual void dumpStats(IString& output) const = 0;
+};
+
+}
+
+#endif // NANO_STL_STATS_ENABLED
+
+#endif // ICONTAINERSTATS_H
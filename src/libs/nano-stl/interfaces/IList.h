@@ -27,8 +27,10 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 namespace nano_stl
 {
 
-/** \brief Interface for all lists implementations */
-template <typename ItemType>
+/** \brief Interface for all lists implementations 
+ *         (IndexType is the type of the links between the items when the index links are enabled)
+*/
+template <typename ItemType, typename IndexType = nano_stl_size_t>
 class IList : public IContainer<ItemType>, public IIterable<ItemType>
 {
     public:
@@ -74,15 +76,34 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
 
     protected:
 
+        // Item forward declaration
+        struct Item;
+
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+        /** \brief Link to an item : index of the item in the items array */
+        typedef IndexType Link;
+
+        /** \brief Link value of a null item */
+        static const IndexType NULL_LINK = static_cast<IndexType>(-1);
+
+#else
+
+        /** \brief Link to an item : pointer to the item */
+        typedef Item* Link;
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
+
         /** \brief List item */
         struct Item
         {
             /* Value */
             ItemType value;
             /* Previous item */
-            Item* previous;
+            Link previous;
             /* Next item */
-            Item* next;
+            Link next;
         };
 
         /** \brief Get the first item of the list */
@@ -91,6 +112,31 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
         /** \brief Get the last item of the list */
         virtual Item* getLast() const = 0;
 
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+        /** \brief Get the items array of the list */
+        virtual Item* getItems() const = 0;
+
+        /** \brief Get the item corresponding to a link */
+        static Item* toItem(Item* const items, const Link link) { return ((link == NULL_LINK) ? nullptr : &items[link]); }
+
+        /** \brief Get the link corresponding to an item */
+        static Link toLink(const Item* const items, const Item* const item) 
+        { 
+            return ((item == nullptr) ? NULL_LINK : static_cast<Link>(item - items)); 
+        }
+
+#else
+
+        /** \brief Get the item corresponding to a link */
+        static Item* toItem(Item* const, const Link link) { return link; }
+
+        /** \brief Get the link corresponding to an item */
+        static Link toLink(const Item* const, Item* const item) { return item; }
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
+
 // Check if iterators are enabled
 #if (NANO_STL_ITERATORS_ENABLED == 1)
 
@@ -113,15 +159,17 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
             public:
 
                 /** \brief Constructor */
-                ConstIterator(const IList<ItemType>& list)
+                ConstIterator(const IList& list)
                 : m_list(&list)
-                , m_current(m_list.getFirst())
+                , m_items(itemsOf(list))
+                , m_current(m_list->getFirst())
                 , m_position((m_current == nullptr) ? IIteratorBase<ItemType>::INVALID_POSITION : 0u)
                 {}
 
                 /** \brief Constructor */
-                ConstIterator(const IList<ItemType>& list, const typename IList<ItemType>::Item* const position)
+                ConstIterator(const IList& list, const typename IList::Item* const position)
                 : m_list(&list)
+                , m_items(itemsOf(list))
                 , m_current(position)
                 , m_position((m_current == nullptr) ? IIteratorBase<ItemType>::INVALID_POSITION : 0u)
                 {}
@@ -129,6 +177,7 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 /** \brief Copy constructor */
                 ConstIterator(const ConstIterator& copy)
                 : m_list(copy.m_list)
+                , m_items(copy.m_items)
                 , m_current(copy.m_current)
                 , m_position(copy.m_position)
                 {}
@@ -136,6 +185,7 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 /**\brief Conversion constructor */
                 ConstIterator(const Iterator& it)
                 : m_list(it.m_list)
+                , m_items(it.m_items)
                 , m_current(it.m_current)
                 , m_position(it.m_position)
                 {}
@@ -157,7 +207,7 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 {
                     if (m_current != nullptr)
                     {
-                        m_current = m_current->next;
+                        m_current = IList::toItem(m_items, m_current->next);
                         if (m_current == nullptr)
                         {
                             m_position = IIteratorBase<ItemType>::INVALID_POSITION;
@@ -174,9 +224,10 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 {
                     if (m_current != nullptr)
                     {
-                        if (m_current->previous != nullptr)
+                        const typename IList::Item* const previous = IList::toItem(m_items, m_current->previous);
+                        if (previous != nullptr)
                         {
-                            m_current = m_current->previous;
+                            m_current = previous;
                             m_position--;
                         }
                     }
@@ -192,6 +243,7 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 ConstIterator& operator = (const ConstIterator& copy)
                 {
                     m_list = copy.m_list;
+                    m_items = copy.m_items;
                     m_current = copy.m_current;
                     m_position = copy.m_position;
                     return (*this);
@@ -201,6 +253,7 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 ConstIterator& operator = (const Iterator& copy)
                 {
                     m_list = copy.m_list;
+                    m_items = copy.m_items;
                     m_current = copy.m_current;
                     m_position = copy.m_position;
                     return (*this);
@@ -209,10 +262,13 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
             private:
 
                 /** \brief Underlying IList object */
-                const IList<ItemType>* m_list;
+                const IList* m_list;
+
+                /** \brief Underlying items array (only needed to follow the index links) */
+                typename IList::Item* m_items;
 
                 /** \brief Current position */
-                const typename IList<ItemType>::Item* m_current;
+                const typename IList::Item* m_current;
 
                 /** \brief Current position */
                 nano_stl_size_t m_position;
@@ -230,15 +286,25 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
             public:
 
                 /** \brief Constructor */
-                Iterator(IList<ItemType>& list)
+                Iterator(IList& list)
                 : m_list(&list)
+                , m_items(itemsOf(list))
                 , m_current(m_list->getFirst())
                 , m_position((m_current == nullptr) ? IIteratorBase<ItemType>::INVALID_POSITION : 0u)
                 {}
 
                 /** \brief Constructor */
-                Iterator(IList<ItemType>& list, typename IList<ItemType>::Item* const position)
+                Iterator(IList& list, typename IList::Item* const position)
                 : m_list(&list)
+                , m_items(itemsOf(list))
+                , m_current(position)
+                , m_position((m_current == nullptr) ? IIteratorBase<ItemType>::INVALID_POSITION : 0u)
+                {}
+
+                /** \brief Constructor with the items array of the list (used by the lists to update their iterators) */
+                Iterator(IList& list, typename IList::Item* const items, typename IList::Item* const position)
+                : m_list(&list)
+                , m_items(items)
                 , m_current(position)
                 , m_position((m_current == nullptr) ? IIteratorBase<ItemType>::INVALID_POSITION : 0u)
                 {}
@@ -246,6 +312,7 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 /** \brief Copy constructor */
                 Iterator(const Iterator& copy)
                 : m_list(copy.m_list)
+                , m_items(copy.m_items)
                 , m_current(copy.m_current)
                 , m_position(copy.m_position)
                 {}
@@ -267,7 +334,7 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 {
                     if (m_current != nullptr)
                     {
-                        m_current = m_current->next;
+                        m_current = IList::toItem(m_items, m_current->next);
                         if (m_current == nullptr)
                         {
                             m_position = IIteratorBase<ItemType>::INVALID_POSITION;
@@ -284,9 +351,10 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 {
                     if (m_current != nullptr)
                     {
-                        if (m_current->previous != nullptr)
+                        typename IList::Item* const previous = IList::toItem(m_items, m_current->previous);
+                        if (previous != nullptr)
                         {
-                            m_current = m_current->previous;
+                            m_current = previous;
                             m_position--;
                         }
                     }
@@ -302,6 +370,7 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
                 Iterator& operator = (const Iterator& copy)
                 {
                     m_list = copy.m_list;
+                    m_items = copy.m_items;
                     m_current = copy.m_current;
                     m_position = copy.m_position;
                     return (*this);
@@ -310,19 +379,47 @@ class IList : public IContainer<ItemType>, public IIterable<ItemType>
             private:
 
                 /** \brief Underlying IList object */
-                IList<ItemType>* m_list;
+                IList* m_list;
+
+                /** \brief Underlying items array (only needed to follow the index links) */
+                typename IList::Item* m_items;
 
                 /** \brief Current position */
-                typename IList<ItemType>::Item* m_current;
+                typename IList::Item* m_current;
 
                 /** \brief Current position */
                 nano_stl_size_t m_position;
         };
 
+
+    private:
+
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+        /** \brief Get the items array of a list to initialize an iterator */
+        static Item* itemsOf(const IList& list) { return list.getItems(); }
+
+#else
+
+        /** \brief Get the items array of a list to initialize an iterator : not needed to follow pointer links */
+        static Item* itemsOf(const IList&) { return nullptr; }
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
+
 #endif // NANO_STL_ITERATORS_ENABLED
 
 };
 
+// Check if index links are enabled
+#if (NANO_STL_INDEX_LINKS_ENABLED == 1)
+
+/** \brief Link value of a null item */
+template <typename ItemType, typename IndexType>
+const IndexType IList<ItemType, IndexType>::NULL_LINK;
+
+#endif // NANO_STL_INDEX_LINKS_ENABLED
+
 }
 
 #endif // ILIST_H
@@ -47,6 +47,12 @@ class IMap : public IContainer<ItemType>, public IIterable<ItemType>
         /** \brief Get an item from the map */
         virtual bool get(const KeyType& key, ItemType& item) const = 0;
 
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual ItemType* find(const KeyType& key) = 0;
+
+        /** \brief Look for an item in the map (return a pointer to the stored item or nullptr if the key is not found) */
+        virtual const ItemType* find(const KeyType& key) const = 0;
+
         /** \brief Remove an item from the map */
         virtual bool remove(const KeyType& key) = 0;
 
@@ -68,6 +74,9 @@ class IMap : public IContainer<ItemType>, public IIterable<ItemType>
             /** \brief Previous node */
             Node* previous;
 
+            /** \brief Constructor (a stored node must own its item : the pointer to the item is only used by the temporary nodes) */
+            Node() : pitem(nullptr), item(), next(nullptr), previous(nullptr) {}
+
             /** \brief Copy operator */
             Node& operator = (const Node& copy)
             {
@@ -21,6 +21,9 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 #define ISTRING_H
 
 #include "IArray.h"
+#include "Compare.h"
+#include "Hash.h"
+#include "StringRef.h"
 
 
 namespace nano_stl
@@ -70,6 +73,33 @@ class IString : public IArray<char>
 
 };
 
+
+/** \brief Default three-way comparator of the binary search trees and maps keys : string keys (single string comparison) */
+template <>
+struct Compare<IString>
+{
+    /** \brief Compare two keys : negative if key1 < key2, 0 if the keys are equal, positive if key1 > key2 
+     *         (the chars are compared as unsigned chars, same ordering as the string comparison operators) */
+    int operator () (const IString& key1, const IString& key2) const 
+    { 
+        return StringRef(key1.cStr(), key1.getLenght()).compare(key2.cStr(), key2.getLenght());
+    }
+
+    /** \brief Compare a string reference with a key without copying it into a temporary key (heterogeneous lookups) */
+    int operator () (const StringRef& key1, const IString& key2) const 
+    { 
+        return key1.compare(key2.cStr(), key2.getLenght());
+    }
+};
+
+/** \brief Default hasher of the hash maps keys : string keys */
+template <>
+struct Hash<IString>
+{
+    /** \brief Compute the hash of a key */
+    uint32_t operator () (const IString& key) const { return HASH_String(key.cStr(), key.getLenght()); }
+};
+
 }
 
 #endif // ISTRING_H
@@ -0,0 +1,1200 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano-stl-libc-dtoa.h"
+
+
+/** \brief Hidden bit of the significand of a normalized double */
+#define NANO_STL_LIBC_DTOA_HIDDEN_BIT           (static_cast<uint64_t>(1u) << 52u)
+
+/** \brief Mask of the explicit bits of the significand of a double */
+#define NANO_STL_LIBC_DTOA_SIGNIFICAND_MASK     (NANO_STL_LIBC_DTOA_HIDDEN_BIT - 1u)
+
+/** \brief Exponent bias of a double (including the significand size) */
+#define NANO_STL_LIBC_DTOA_EXPONENT_BIAS        (0x3FF + 52)
+
+/** \brief Exponent of the denormalized doubles */
+#define NANO_STL_LIBC_DTOA_DENORMAL_EXPONENT    (1 - NANO_STL_LIBC_DTOA_EXPONENT_BIAS)
+
+/** \brief Range of the binary exponent of the scaled values used for the Grisu digits generation */
+#define NANO_STL_LIBC_DTOA_MIN_TARGET_EXPONENT  (-60)
+#define NANO_STL_LIBC_DTOA_MAX_TARGET_EXPONENT  (-32)
+
+/** \brief Decimal exponent of the first cached power of ten and distance between 2 cached powers of ten */
+#define NANO_STL_LIBC_DTOA_CACHED_POWERS_OFFSET 348
+#define NANO_STL_LIBC_DTOA_CACHED_POWERS_STEP   8
+
+/** \brief Approximation of log10(2) */
+#define NANO_STL_LIBC_DTOA_LOG10_2              0.30102999566398114
+
+/** \brief Number of 32 bits limbs of the big integers used by the exact conversions
+ *         (large enough to hold the largest double scaled by 4, the smallest one scaled by 4 x 10^324, 
+ *         or a 64 bits significand scaled by 10^309 or 10^343 as done by the exact decimal to binary conversion) */
+#define NANO_STL_LIBC_DTOA_BIGNUM_SIZE          40u
+
+/** \brief Maximum number of significant digits which can be padded from the shortest representation
+ *         (below 16 digits, the decimal spacing is wider than 2 ulps for every normalized double) */
+#define NANO_STL_LIBC_DTOA_SHORTEST_PRECISION   15
+
+/** \brief Smallest normalized double */
+#define NANO_STL_LIBC_DTOA_MIN_NORMAL           2.2250738585072014e-308
+
+
+/** \brief Floating point number with a 64 bits significand: value = f x 2^e */
+typedef struct _nano_stl_libc_diy_fp_t
+{
+    /** \brief Significand */
+    uint64_t f;
+    /** \brief Binary exponent */
+    int e;
+} nano_stl_libc_diy_fp_t;
+
+/** \brief Cached power of ten: 10^decimal_exponent ~= significand x 2^binary_exponent */
+typedef struct _nano_stl_libc_cached_power_t
+{
+    /** \brief Normalized significand */
+    uint64_t significand;
+    /** \brief Binary exponent */
+    int16_t binary_exponent;
+    /** \brief Decimal exponent */
+    int16_t decimal_exponent;
+} nano_stl_libc_cached_power_t;
+
+/** \brief Unsigned big integer */
+typedef struct _nano_stl_libc_bignum_t
+{
+    /** \brief Limbs (least significant first) */
+    uint32_t limbs[NANO_STL_LIBC_DTOA_BIGNUM_SIZE];
+    /** \brief Number of used limbs (the most significant one is never 0) */
+    unsigned int count;
+} nano_stl_libc_bignum_t;
+
+
+/** \brief Split a strictly positive and finite double into its significand and binary exponent */
+static nano_stl_libc_diy_fp_t NANO_STL_LIBC_DTOA_Split(const double value, bool* lower_boundary_closer);
+
+/** \brief Normalize a floating point number so that the most significant bit of its significand is set */
+static nano_stl_libc_diy_fp_t NANO_STL_LIBC_DTOA_Normalize(nano_stl_libc_diy_fp_t x);
+
+/** \brief Initialize the big integers of the exact conversions so that numerator / denominator is in [1, 10[ 
+ *         (the boundaries are only computed if they are not null) and returns the decimal point position */
+static int NANO_STL_LIBC_DTOA_Setup(const nano_stl_libc_diy_fp_t v, const bool lower_boundary_closer, const bool even, 
+                                    nano_stl_libc_bignum_t* numerator, nano_stl_libc_bignum_t* denominator, 
+                                    nano_stl_libc_bignum_t* delta_minus, nano_stl_libc_bignum_t* delta_plus);
+
+/** \brief Assign a 64 bits value to a big integer */
+static void NANO_STL_LIBC_DTOA_BignumAssign(nano_stl_libc_bignum_t* x, const uint64_t value);
+
+/** \brief Shift left a big integer */
+static void NANO_STL_LIBC_DTOA_BignumShiftLeft(nano_stl_libc_bignum_t* x, const unsigned int shift);
+
+/** \brief Multiply a big integer by a 32 bits value */
+static void NANO_STL_LIBC_DTOA_BignumMultiply(nano_stl_libc_bignum_t* x, const uint32_t factor);
+
+/** \brief Multiply a big integer by a power of five */
+static void NANO_STL_LIBC_DTOA_BignumMultiplyPow5(nano_stl_libc_bignum_t* x, unsigned int exponent);
+
+/** \brief Multiply a big integer by a power of ten */
+static void NANO_STL_LIBC_DTOA_BignumMultiplyPow10(nano_stl_libc_bignum_t* x, const unsigned int exponent);
+
+/** \brief Compare 2 big integers */
+static int NANO_STL_LIBC_DTOA_BignumCompare(const nano_stl_libc_bignum_t* x, const nano_stl_libc_bignum_t* y);
+
+/** \brief Compare the sum of 2 big integers with a third one */
+static int NANO_STL_LIBC_DTOA_BignumPlusCompare(const nano_stl_libc_bignum_t* x, const nano_stl_libc_bignum_t* y, const nano_stl_libc_bignum_t* z);
+
+/** \brief Subtract a big integer from a bigger one */
+static void NANO_STL_LIBC_DTOA_BignumSubtract(nano_stl_libc_bignum_t* x, const nano_stl_libc_bignum_t* y);
+
+/** \brief Divide a big integer by another one which is at most 10 times smaller, the remainder is stored in the dividend */
+static char NANO_STL_LIBC_DTOA_BignumDivide(nano_stl_libc_bignum_t* x, const nano_stl_libc_bignum_t* y);
+
+/** \brief Compute the number of significant bits of a big integer */
+static unsigned int NANO_STL_LIBC_DTOA_BignumBitLength(const nano_stl_libc_bignum_t* x);
+
+/** \brief Build the double closest to significand x 2^exponent, the sticky flag telling if the exact value is slightly above it */
+static double NANO_STL_LIBC_DTOA_MakeDouble(uint64_t significand, int exponent, const bool sticky);
+
+
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+/** \brief Multiply 2 floating point numbers (the result is rounded to 64 bits) */
+static nano_stl_libc_diy_fp_t NANO_STL_LIBC_DTOA_Multiply(const nano_stl_libc_diy_fp_t x, const nano_stl_libc_diy_fp_t y);
+
+/** \brief Grisu3 shortest digits generation, returns false when it cannot guarantee the shortest and closest result */
+static bool NANO_STL_LIBC_DTOA_Grisu3(const double value, char* digits, size_t* length, int* decimal_point);
+
+/** \brief Grisu3 digits generation of a scaled value within its scaled boundaries */
+static bool NANO_STL_LIBC_DTOA_DigitGen(const nano_stl_libc_diy_fp_t low, const nano_stl_libc_diy_fp_t w, const nano_stl_libc_diy_fp_t high, 
+                                        char* digits, size_t* length, int* kappa);
+
+/** \brief Grisu3 rounding of the last generated digit toward the scaled value */
+static bool NANO_STL_LIBC_DTOA_RoundWeed(char* digits, const size_t length, const uint64_t distance_too_high_w, const uint64_t unsafe_interval, 
+                                         uint64_t rest, const uint64_t ten_kappa, const uint64_t unit);
+
+/** \brief Extract the digit of a 32 bits value corresponding to the given power of ten (constant divisors are turned into multiplications) */
+static inline uint32_t NANO_STL_LIBC_DTOA_ExtractDigit(uint32_t* value, const int exponent);
+
+/** \brief Exact shortest digits generation using big integers */
+static size_t NANO_STL_LIBC_DTOA_ExactShortest(const double value, char* digits, int* decimal_point);
+
+/** \brief Exact rounded digits generation using big integers */
+static size_t NANO_STL_LIBC_DTOA_ExactPrecision(const double value, const int precision, const bool fixed, char* digits, int* decimal_point);
+
+/** \brief Compare a strictly positive and finite double with the decimal value 0.d1d2...dn x 10^decimal_point (at most 19 digits) */
+static int NANO_STL_LIBC_DTOA_CompareDecimal(const double value, const char* digits, const size_t length, const int decimal_point);
+
+/** \brief Add one unit to the last digit, propagating the carry (returns the new number of digits) */
+static size_t NANO_STL_LIBC_DTOA_RoundUp(char* digits, size_t length, int* decimal_point, const bool fixed);
+
+
+/** \brief Powers of ten which fit in 32 bits */
+static const uint32_t s_powers_of_10[] = { 1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u };
+
+/** \brief Normalized powers of ten from 10^-348 to 10^340 (rounded to 64 bits) */
+static const nano_stl_libc_cached_power_t s_cached_powers[] = {
+    { 0xFA8FD5A0081C0288u, -1220, -348 },
+    { 0xBAAEE17FA23EBF76u, -1193, -340 },
+    { 0x8B16FB203055AC76u, -1166, -332 },
+    { 0xCF42894A5DCE35EAu, -1140, -324 },
+    { 0x9A6BB0AA55653B2Du, -1113, -316 },
+    { 0xE61ACF033D1A45DFu, -1087, -308 },
+    { 0xAB70FE17C79AC6CAu, -1060, -300 },
+    { 0xFF77B1FCBEBCDC4Fu, -1034, -292 },
+    { 0xBE5691EF416BD60Cu, -1007, -284 },
+    { 0x8DD01FAD907FFC3Cu, -980, -276 },
+    { 0xD3515C2831559A83u, -954, -268 },
+    { 0x9D71AC8FADA6C9B5u, -927, -260 },
+    { 0xEA9C227723EE8BCBu, -901, -252 },
+    { 0xAECC49914078536Du, -874, -244 },
+    { 0x823C12795DB6CE57u, -847, -236 },
+    { 0xC21094364DFB5637u, -821, -228 },
+    { 0x9096EA6F3848984Fu, -794, -220 },
+    { 0xD77485CB25823AC7u, -768, -212 },
+    { 0xA086CFCD97BF97F4u, -741, -204 },
+    { 0xEF340A98172AACE5u, -715, -196 },
+    { 0xB23867FB2A35B28Eu, -688, -188 },
+    { 0x84C8D4DFD2C63F3Bu, -661, -180 },
+    { 0xC5DD44271AD3CDBAu, -635, -172 },
+    { 0x936B9FCEBB25C996u, -608, -164 },
+    { 0xDBAC6C247D62A584u, -582, -156 },
+    { 0xA3AB66580D5FDAF6u, -555, -148 },
+    { 0xF3E2F893DEC3F126u, -529, -140 },
+    { 0xB5B5ADA8AAFF80B8u, -502, -132 },
+    { 0x87625F056C7C4A8Bu, -475, -124 },
+    { 0xC9BCFF6034C13053u, -449, -116 },
+    { 0x964E858C91BA2655u, -422, -108 },
+    { 0xDFF9772470297EBDu, -396, -100 },
+    { 0xA6DFBD9FB8E5B88Fu, -369, -92 },
+    { 0xF8A95FCF88747D94u, -343, -84 },
+    { 0xB94470938FA89BCFu, -316, -76 },
+    { 0x8A08F0F8BF0F156Bu, -289, -68 },
+    { 0xCDB02555653131B6u, -263, -60 },
+    { 0x993FE2C6D07B7FACu, -236, -52 },
+    { 0xE45C10C42A2B3B06u, -210, -44 },
+    { 0xAA242499697392D3u, -183, -36 },
+    { 0xFD87B5F28300CA0Eu, -157, -28 },
+    { 0xBCE5086492111AEBu, -130, -20 },
+    { 0x8CBCCC096F5088CCu, -103, -12 },
+    { 0xD1B71758E219652Cu, -77, -4 },
+    { 0x9C40000000000000u, -50, 4 },
+    { 0xE8D4A51000000000u, -24, 12 },
+    { 0xAD78EBC5AC620000u, 3, 20 },
+    { 0x813F3978F8940984u, 30, 28 },
+    { 0xC097CE7BC90715B3u, 56, 36 },
+    { 0x8F7E32CE7BEA5C70u, 83, 44 },
+    { 0xD5D238A4ABE98068u, 109, 52 },
+    { 0x9F4F2726179A2245u, 136, 60 },
+    { 0xED63A231D4C4FB27u, 162, 68 },
+    { 0xB0DE65388CC8ADA8u, 189, 76 },
+    { 0x83C7088E1AAB65DBu, 216, 84 },
+    { 0xC45D1DF942711D9Au, 242, 92 },
+    { 0x924D692CA61BE758u, 269, 100 },
+    { 0xDA01EE641A708DEAu, 295, 108 },
+    { 0xA26DA3999AEF774Au, 322, 116 },
+    { 0xF209787BB47D6B85u, 348, 124 },
+    { 0xB454E4A179DD1877u, 375, 132 },
+    { 0x865B86925B9BC5C2u, 402, 140 },
+    { 0xC83553C5C8965D3Du, 428, 148 },
+    { 0x952AB45CFA97A0B3u, 455, 156 },
+    { 0xDE469FBD99A05FE3u, 481, 164 },
+    { 0xA59BC234DB398C25u, 508, 172 },
+    { 0xF6C69A72A3989F5Cu, 534, 180 },
+    { 0xB7DCBF5354E9BECEu, 561, 188 },
+    { 0x88FCF317F22241E2u, 588, 196 },
+    { 0xCC20CE9BD35C78A5u, 614, 204 },
+    { 0x98165AF37B2153DFu, 641, 212 },
+    { 0xE2A0B5DC971F303Au, 667, 220 },
+    { 0xA8D9D1535CE3B396u, 694, 228 },
+    { 0xFB9B7CD9A4A7443Cu, 720, 236 },
+    { 0xBB764C4CA7A44410u, 747, 244 },
+    { 0x8BAB8EEFB6409C1Au, 774, 252 },
+    { 0xD01FEF10A657842Cu, 800, 260 },
+    { 0x9B10A4E5E9913129u, 827, 268 },
+    { 0xE7109BFBA19C0C9Du, 853, 276 },
+    { 0xAC2820D9623BF429u, 880, 284 },
+    { 0x80444B5E7AA7CF85u, 907, 292 },
+    { 0xBF21E44003ACDD2Du, 933, 300 },
+    { 0x8E679C2F5E44FF8Fu, 960, 308 },
+    { 0xD433179D9C8CB841u, 986, 316 },
+    { 0x9E19DB92B4E31BA9u, 1013, 324 },
+    { 0xEB96BF6EBADF77D9u, 1039, 332 },
+    { 0xAF87023B9BF0EE6Bu, 1066, 340 },};
+
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
+
+
+/** \brief Compute the double closest to significand x 10^exponent using big integers */
+double NANO_STL_LIBC_DTOA_ScalePow10(const uint64_t significand, const int exponent)
+{
+    nano_stl_libc_bignum_t numerator;
+    nano_stl_libc_bignum_t denominator;
+    double value = 0.;
+
+    if (exponent > 309)
+    {
+        value = NANO_STL_LIBC_DTOA_FromBits(NANO_STL_LIBC_DTOA_INFINITY_BITS);
+    }
+    else if ((significand != 0u) && (exponent >= -343))
+    {
+        /* significand x 10^exponent = numerator / denominator x 2^binary_exponent, with numerator / denominator in [0.5, 1[ */
+        NANO_STL_LIBC_DTOA_BignumAssign(&numerator, significand);
+        NANO_STL_LIBC_DTOA_BignumAssign(&denominator, 1u);
+        if (exponent >= 0)
+        {
+            NANO_STL_LIBC_DTOA_BignumMultiplyPow10(&numerator, static_cast<unsigned int>(exponent));
+        }
+        else
+        {
+            NANO_STL_LIBC_DTOA_BignumMultiplyPow10(&denominator, static_cast<unsigned int>(-exponent));
+        }
+        int binary_exponent = static_cast<int>(NANO_STL_LIBC_DTOA_BignumBitLength(&numerator)) - 
+                              static_cast<int>(NANO_STL_LIBC_DTOA_BignumBitLength(&denominator));
+        if (binary_exponent >= 0)
+        {
+            NANO_STL_LIBC_DTOA_BignumShiftLeft(&denominator, static_cast<unsigned int>(binary_exponent));
+        }
+        else
+        {
+            NANO_STL_LIBC_DTOA_BignumShiftLeft(&numerator, static_cast<unsigned int>(-binary_exponent));
+        }
+        if (NANO_STL_LIBC_DTOA_BignumCompare(&numerator, &denominator) >= 0)
+        {
+            NANO_STL_LIBC_DTOA_BignumShiftLeft(&denominator, 1u);
+            binary_exponent++;
+        }
+
+        /* Binary long division giving the 64 most significant bits of the quotient, the remainder being the sticky bit */
+        uint64_t quotient = 0u;
+        for (unsigned int i = 0u; i < 64u; i++)
+        {
+            NANO_STL_LIBC_DTOA_BignumShiftLeft(&numerator, 1u);
+            quotient <<= 1u;
+            if (NANO_STL_LIBC_DTOA_BignumCompare(&numerator, &denominator) >= 0)
+            {
+                NANO_STL_LIBC_DTOA_BignumSubtract(&numerator, &denominator);
+                quotient |= 1u;
+            }
+        }
+        value = NANO_STL_LIBC_DTOA_MakeDouble(quotient, binary_exponent - 64, (numerator.count != 0u));
+    }
+    else
+    {}
+
+    return value;
+}
+
+/** \brief Compare the decimal value 0.d1d2...dn x 10^decimal_point with the middle between a positive and finite value and the next double */
+int NANO_STL_LIBC_DTOA_CompareHalfway(const double value, const char* digits, const char* end, const int decimal_point)
+{
+    nano_stl_libc_bignum_t numerator;
+    nano_stl_libc_bignum_t denominator;
+    bool lower_boundary_closer;
+    const nano_stl_libc_diy_fp_t v = NANO_STL_LIBC_DTOA_Split(value, &lower_boundary_closer);
+    const nano_stl_libc_diy_fp_t halfway = { (v.f << 1u) + 1u, v.e - 1 };
+    int ret = 0;
+
+    /* Generate the exact digits of the middle point one by one until they differ from the given ones */
+    const int halfway_decimal_point = NANO_STL_LIBC_DTOA_Setup(halfway, false, false, &numerator, &denominator, nullptr, nullptr);
+    if (decimal_point != halfway_decimal_point)
+    {
+        ret = ((decimal_point > halfway_decimal_point) ? 1 : -1);
+    }
+    else
+    {
+        bool done = false;
+        while (!done)
+        {
+            if ((digits != end) && ((*digits) == '.'))
+            {
+                digits++;
+            }
+            if (digits == end)
+            {
+                ret = ((numerator.count != 0u) ? -1 : 0);
+                done = true;
+            }
+            else if (numerator.count == 0u)
+            {
+                /* All the digits of the middle point have been generated, the remaining digits must be zeros to be equal */
+                while ((digits != end) && (((*digits) == '0') || ((*digits) == '.')))
+                {
+                    digits++;
+                }
+                ret = ((digits != end) ? 1 : 0);
+                done = true;
+            }
+            else
+            {
+                const char digit = static_cast<char>('0' + NANO_STL_LIBC_DTOA_BignumDivide(&numerator, &denominator));
+                if ((*digits) != digit)
+                {
+                    ret = (((*digits) > digit) ? 1 : -1);
+                    done = true;
+                }
+                else
+                {
+                    NANO_STL_LIBC_DTOA_BignumMultiply(&numerator, 10u);
+                    digits++;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+/** \brief Generate the shortest digits which read back to the given strictly positive and finite value */
+size_t NANO_STL_LIBC_DTOA_Shortest(const double value, char* digits, int* decimal_point)
+{
+    size_t length = 0u;
+
+    /* Grisu3 fails for about 0.5% of the values, they are handled by the exact algorithm */
+    if (!NANO_STL_LIBC_DTOA_Grisu3(value, digits, &length, decimal_point))
+    {
+        length = NANO_STL_LIBC_DTOA_ExactShortest(value, digits, decimal_point);
+    }
+
+    return length;
+}
+
+/** \brief Generate the correctly rounded digits of the given positive and finite value */
+size_t NANO_STL_LIBC_DTOA_Precision(const double value, const int precision, const bool fixed, char* digits, int* decimal_point)
+{
+    size_t length = 0u;
+    bool done = false;
+    char shortest[17u];
+    size_t shortest_length;
+    int shortest_decimal_point;
+
+    /* The digits can be rounded from the shortest representation (which is also the closest one), the exact value
+       being only needed when the rounding position falls exactly on a trailing '5'. They can be padded with zeros
+       only if the requested precision is below the precision of the double */
+    if ((value != 0.) && NANO_STL_LIBC_DTOA_Grisu3(value, shortest, &shortest_length, &shortest_decimal_point))
+    {
+        const int significant = (fixed ? (shortest_decimal_point + precision) : precision);
+        if (significant >= 1)
+        {
+            const size_t count = static_cast<size_t>(significant);
+            if (shortest_length <= count)
+            {
+                if ((significant <= NANO_STL_LIBC_DTOA_SHORTEST_PRECISION) && (value >= NANO_STL_LIBC_DTOA_MIN_NORMAL))
+                {
+                    NANO_STL_LIBC_Memcpy(digits, shortest, shortest_length);
+                    NANO_STL_LIBC_Memset(&digits[shortest_length], '0', count - shortest_length);
+                    (*decimal_point) = shortest_decimal_point;
+                    length = count;
+                    done = true;
+                }
+            }
+            else
+            {
+                bool round_up = (shortest[count] >= '5');
+                if ((shortest[count] == '5') && (shortest_length == (count + 1u)))
+                {
+                    /* The shortest representation is a tie, the exact value gives the rounding direction */
+                    const int compare = NANO_STL_LIBC_DTOA_CompareDecimal(value, shortest, shortest_length, shortest_decimal_point);
+                    round_up = ((compare > 0) || ((compare == 0) && (((shortest[count - 1u] - '0') & 1) != 0)));
+                }
+                NANO_STL_LIBC_Memcpy(digits, shortest, count);
+                (*decimal_point) = shortest_decimal_point;
+                length = count;
+                if (round_up)
+                {
+                    length = NANO_STL_LIBC_DTOA_RoundUp(digits, length, decimal_point, fixed);
+                }
+                done = true;
+            }
+        }
+    }
+    if (!done)
+    {
+        if (value != 0.)
+        {
+            length = NANO_STL_LIBC_DTOA_ExactPrecision(value, precision, fixed, digits, decimal_point);
+        }
+        if (length == 0u)
+        {
+            (*decimal_point) = 0;
+        }
+    }
+
+    return length;
+}
+
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
+
+
+/** \brief Split a strictly positive and finite double into its significand and binary exponent */
+static nano_stl_libc_diy_fp_t NANO_STL_LIBC_DTOA_Split(const double value, bool* lower_boundary_closer)
+{
+    nano_stl_libc_diy_fp_t x;
+    const uint64_t bits = NANO_STL_LIBC_DTOA_GetBits(value);
+
+    const int biased_exponent = static_cast<int>((bits >> 52u) & 0x7FFu);
+    x.f = (bits & NANO_STL_LIBC_DTOA_SIGNIFICAND_MASK);
+    if (biased_exponent == 0)
+    {
+        x.e = NANO_STL_LIBC_DTOA_DENORMAL_EXPONENT;
+        (*lower_boundary_closer) = false;
+    }
+    else
+    {
+        /* The previous double is closer than the next one when crossing a power of 2 */
+        (*lower_boundary_closer) = ((x.f == 0u) && (biased_exponent > 1));
+        x.f |= NANO_STL_LIBC_DTOA_HIDDEN_BIT;
+        x.e = biased_exponent - NANO_STL_LIBC_DTOA_EXPONENT_BIAS;
+    }
+
+    return x;
+}
+
+/** \brief Normalize a floating point number so that the most significant bit of its significand is set */
+static nano_stl_libc_diy_fp_t NANO_STL_LIBC_DTOA_Normalize(nano_stl_libc_diy_fp_t x)
+{
+#if defined(__GNUC__)
+
+    const int shift = __builtin_clzll(x.f);
+    x.f <<= static_cast<unsigned int>(shift);
+    x.e -= shift;
+
+#else // __GNUC__
+
+    while ((x.f & (static_cast<uint64_t>(0xFFC00000u) << 32u)) == 0u)
+    {
+        x.f <<= 10u;
+        x.e -= 10;
+    }
+    while ((x.f & (static_cast<uint64_t>(0x80000000u) << 32u)) == 0u)
+    {
+        x.f <<= 1u;
+        x.e--;
+    }
+
+#endif // __GNUC__
+
+    return x;
+}
+
+
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+/** \brief Multiply 2 floating point numbers (the result is rounded to 64 bits) */
+static nano_stl_libc_diy_fp_t NANO_STL_LIBC_DTOA_Multiply(const nano_stl_libc_diy_fp_t x, const nano_stl_libc_diy_fp_t y)
+{
+    nano_stl_libc_diy_fp_t r;
+    const uint64_t a = (x.f >> 32u);
+    const uint64_t b = (x.f & 0xFFFFFFFFu);
+    const uint64_t c = (y.f >> 32u);
+    const uint64_t d = (y.f & 0xFFFFFFFFu);
+    const uint64_t ac = a * c;
+    const uint64_t bc = b * c;
+    const uint64_t ad = a * d;
+    const uint64_t bd = b * d;
+
+    /* Round the discarded low 64 bits */
+    const uint64_t middle = (bd >> 32u) + (ad & 0xFFFFFFFFu) + (bc & 0xFFFFFFFFu) + 0x80000000u;
+    r.f = ac + (ad >> 32u) + (bc >> 32u) + (middle >> 32u);
+    r.e = x.e + y.e + 64;
+
+    return r;
+}
+
+/** \brief Grisu3 shortest digits generation, returns false when it cannot guarantee the shortest and closest result */
+static bool NANO_STL_LIBC_DTOA_Grisu3(const double value, char* digits, size_t* length, int* decimal_point)
+{
+    bool lower_boundary_closer;
+    const nano_stl_libc_diy_fp_t v = NANO_STL_LIBC_DTOA_Split(value, &lower_boundary_closer);
+    const nano_stl_libc_diy_fp_t w = NANO_STL_LIBC_DTOA_Normalize(v);
+
+    /* Boundaries are the middles between the value and its neighbours, normalized with the same exponent as the value */
+    nano_stl_libc_diy_fp_t plus = { (v.f << 1u) + 1u, v.e - 1 };
+    nano_stl_libc_diy_fp_t minus;
+    plus = NANO_STL_LIBC_DTOA_Normalize(plus);
+    if (lower_boundary_closer)
+    {
+        minus.f = (v.f << 2u) - 1u;
+        minus.e = v.e - 2;
+    }
+    else
+    {
+        minus.f = (v.f << 1u) - 1u;
+        minus.e = v.e - 1;
+    }
+    minus.f <<= static_cast<unsigned int>(minus.e - plus.e);
+    minus.e = plus.e;
+
+    /* Select the cached power of ten which brings the binary exponent of the scaled value in the target range */
+    const int min_exponent = NANO_STL_LIBC_DTOA_MIN_TARGET_EXPONENT - (w.e + 64);
+    const double k_estimate = static_cast<double>(min_exponent + 63) * NANO_STL_LIBC_DTOA_LOG10_2;
+    int k = static_cast<int>(k_estimate);
+    if (k_estimate > static_cast<double>(k))
+    {
+        k++;
+    }
+    const nano_stl_libc_cached_power_t& cached_power = s_cached_powers[((NANO_STL_LIBC_DTOA_CACHED_POWERS_OFFSET + k - 1) / NANO_STL_LIBC_DTOA_CACHED_POWERS_STEP) + 1];
+    const nano_stl_libc_diy_fp_t ten_mk = { cached_power.significand, cached_power.binary_exponent };
+
+    /* Generate the digits of the scaled value */
+    int kappa;
+    const bool ret = NANO_STL_LIBC_DTOA_DigitGen(NANO_STL_LIBC_DTOA_Multiply(minus, ten_mk), NANO_STL_LIBC_DTOA_Multiply(w, ten_mk), 
+                                                 NANO_STL_LIBC_DTOA_Multiply(plus, ten_mk), digits, length, &kappa);
+    (*decimal_point) = static_cast<int>(*length) + kappa - cached_power.decimal_exponent;
+
+    return ret;
+}
+
+/** \brief Grisu3 digits generation of a scaled value within its scaled boundaries */
+static bool NANO_STL_LIBC_DTOA_DigitGen(const nano_stl_libc_diy_fp_t low, const nano_stl_libc_diy_fp_t w, const nano_stl_libc_diy_fp_t high, 
+                                        char* digits, size_t* length, int* kappa)
+{
+    bool ret = false;
+    bool done = false;
+
+    /* The boundaries are widened by 1 unit to take the imprecision of the scaled values into account: the digits are generated
+       inside this unsafe interval, if the result is also inside the interval narrowed by 1 unit it is guaranteed to be correct */
+    uint64_t unit = 1u;
+    const nano_stl_libc_diy_fp_t too_high = { high.f + unit, high.e };
+    uint64_t unsafe_interval = too_high.f - (low.f - unit);
+    const unsigned int one_shift = static_cast<unsigned int>(-w.e);
+    const uint64_t one_mask = (static_cast<uint64_t>(1u) << one_shift) - 1u;
+    uint32_t integrals = static_cast<uint32_t>(too_high.f >> one_shift);
+    uint64_t fractionals = (too_high.f & one_mask);
+
+    /* Integral part */
+    (*kappa) = 1;
+    while (((*kappa) < 10) && (integrals >= s_powers_of_10[*kappa]))
+    {
+        (*kappa)++;
+    }
+    (*length) = 0u;
+    while (((*kappa) > 0) && !done)
+    {
+        (*kappa)--;
+        digits[*length] = static_cast<char>('0' + NANO_STL_LIBC_DTOA_ExtractDigit(&integrals, *kappa));
+        (*length)++;
+
+        const uint64_t rest = (static_cast<uint64_t>(integrals) << one_shift) + fractionals;
+        if (rest < unsafe_interval)
+        {
+            ret = NANO_STL_LIBC_DTOA_RoundWeed(digits, *length, too_high.f - w.f, unsafe_interval, rest, 
+                                               static_cast<uint64_t>(s_powers_of_10[*kappa]) << one_shift, unit);
+            done = true;
+        }
+    }
+
+    /* Fractional part */
+    while (!done)
+    {
+        fractionals *= 10u;
+        unit *= 10u;
+        unsafe_interval *= 10u;
+        digits[*length] = static_cast<char>('0' + static_cast<int>(fractionals >> one_shift));
+        (*length)++;
+        fractionals &= one_mask;
+        (*kappa)--;
+
+        if (fractionals < unsafe_interval)
+        {
+            ret = NANO_STL_LIBC_DTOA_RoundWeed(digits, *length, (too_high.f - w.f) * unit, unsafe_interval, fractionals, one_mask + 1u, unit);
+            done = true;
+        }
+    }
+
+    return ret;
+}
+
+/** \brief Grisu3 rounding of the last generated digit toward the scaled value */
+static bool NANO_STL_LIBC_DTOA_RoundWeed(char* digits, const size_t length, const uint64_t distance_too_high_w, const uint64_t unsafe_interval, 
+                                         uint64_t rest, const uint64_t ten_kappa, const uint64_t unit)
+{
+    const uint64_t small_distance = distance_too_high_w - unit;
+    const uint64_t big_distance = distance_too_high_w + unit;
+
+    /* Decrement the last digit while it brings the result closer to the value (even when taking the imprecision into account) */
+    while ((rest < small_distance) && 
+           ((unsafe_interval - rest) >= ten_kappa) &&
+           (((rest + ten_kappa) < small_distance) || ((small_distance - rest) >= (rest + ten_kappa - small_distance))))
+    {
+        digits[length - 1u]--;
+        rest += ten_kappa;
+    }
+
+    /* Check if the imprecision could have selected the wrong digit */
+    bool ret = false;
+    if (!((rest < big_distance) && 
+          ((unsafe_interval - rest) >= ten_kappa) && 
+          (((rest + ten_kappa) < big_distance) || ((big_distance - rest) > (rest + ten_kappa - big_distance)))))
+    {
+        /* The result must be inside the safe interval */
+        ret = (((2u * unit) <= rest) && (rest <= (unsafe_interval - (4u * unit))));
+    }
+
+    return ret;
+}
+
+/** \brief Extract the digit of a 32 bits value corresponding to the given power of ten (constant divisors are turned into multiplications) */
+static inline uint32_t NANO_STL_LIBC_DTOA_ExtractDigit(uint32_t* value, const int exponent)
+{
+    uint32_t digit;
+    switch (exponent)
+    {
+        case 9: digit = (*value) / 1000000000u; (*value) %= 1000000000u; break;
+        case 8: digit = (*value) / 100000000u; (*value) %= 100000000u; break;
+        case 7: digit = (*value) / 10000000u; (*value) %= 10000000u; break;
+        case 6: digit = (*value) / 1000000u; (*value) %= 1000000u; break;
+        case 5: digit = (*value) / 100000u; (*value) %= 100000u; break;
+        case 4: digit = (*value) / 10000u; (*value) %= 10000u; break;
+        case 3: digit = (*value) / 1000u; (*value) %= 1000u; break;
+        case 2: digit = (*value) / 100u; (*value) %= 100u; break;
+        case 1: digit = (*value) / 10u; (*value) %= 10u; break;
+        default: digit = (*value); (*value) = 0u; break;
+    }
+    return digit;
+}
+
+/** \brief Exact shortest digits generation using big integers */
+static size_t NANO_STL_LIBC_DTOA_ExactShortest(const double value, char* digits, int* decimal_point)
+{
+    nano_stl_libc_bignum_t numerator;
+    nano_stl_libc_bignum_t denominator;
+    nano_stl_libc_bignum_t delta_minus;
+    nano_stl_libc_bignum_t delta_plus;
+    bool lower_boundary_closer;
+    const nano_stl_libc_diy_fp_t v = NANO_STL_LIBC_DTOA_Split(value, &lower_boundary_closer);
+
+    /* With an even significand, the boundaries themselves read back to the value (round half to even) */
+    const bool even = ((v.f & 1u) == 0u);
+    size_t length = 0u;
+    bool done = false;
+
+    (*decimal_point) = NANO_STL_LIBC_DTOA_Setup(v, lower_boundary_closer, even, &numerator, &denominator, &delta_minus, &delta_plus);
+    while (!done)
+    {
+        digits[length] = static_cast<char>('0' + NANO_STL_LIBC_DTOA_BignumDivide(&numerator, &denominator));
+        length++;
+
+        /* Check if the digits generated so far are inside the rounding interval of the value */
+        const int compare_minus = NANO_STL_LIBC_DTOA_BignumCompare(&numerator, &delta_minus);
+        const int compare_plus = NANO_STL_LIBC_DTOA_BignumPlusCompare(&numerator, &delta_plus, &denominator);
+        const bool in_range_minus = (even ? (compare_minus <= 0) : (compare_minus < 0));
+        const bool in_range_plus = (even ? (compare_plus >= 0) : (compare_plus > 0));
+        if (!in_range_minus && !in_range_plus)
+        {
+            NANO_STL_LIBC_DTOA_BignumMultiply(&numerator, 10u);
+            NANO_STL_LIBC_DTOA_BignumMultiply(&delta_minus, 10u);
+            NANO_STL_LIBC_DTOA_BignumMultiply(&delta_plus, 10u);
+        }
+        else
+        {
+            if (in_range_minus && in_range_plus)
+            {
+                /* Both the rounded down and the rounded up digits are inside the interval, select the closest one */
+                const int compare = NANO_STL_LIBC_DTOA_BignumPlusCompare(&numerator, &numerator, &denominator);
+                if ((compare > 0) || ((compare == 0) && (((digits[length - 1u] - '0') & 1) != 0)))
+                {
+                    digits[length - 1u]++;
+                }
+            }
+            else if (in_range_plus)
+            {
+                digits[length - 1u]++;
+            }
+            else
+            {}
+            done = true;
+        }
+    }
+
+    return length;
+}
+
+/** \brief Exact rounded digits generation using big integers */
+static size_t NANO_STL_LIBC_DTOA_ExactPrecision(const double value, const int precision, const bool fixed, char* digits, int* decimal_point)
+{
+    nano_stl_libc_bignum_t numerator;
+    nano_stl_libc_bignum_t denominator;
+    bool lower_boundary_closer;
+    const nano_stl_libc_diy_fp_t v = NANO_STL_LIBC_DTOA_Split(value, &lower_boundary_closer);
+    size_t length = 0u;
+
+    (*decimal_point) = NANO_STL_LIBC_DTOA_Setup(v, false, false, &numerator, &denominator, nullptr, nullptr);
+    int significant = (fixed ? ((*decimal_point) + precision) : precision);
+    if (significant > NANO_STL_LIBC_DTOA_MAX_DIGITS)
+    {
+        significant = NANO_STL_LIBC_DTOA_MAX_DIGITS;
+    }
+    if (significant == 0)
+    {
+        /* Value / 10^decimal_point is in [0.1, 1[ and must be rounded to 0 or 1 */
+        NANO_STL_LIBC_DTOA_BignumMultiply(&denominator, 5u);
+        if (NANO_STL_LIBC_DTOA_BignumCompare(&numerator, &denominator) > 0)
+        {
+            digits[0u] = '1';
+            length = 1u;
+            (*decimal_point)++;
+        }
+    }
+    else if (significant > 0)
+    {
+        /* Generate the digits until the remainder is null */
+        length = static_cast<size_t>(significant);
+        size_t index = 0u;
+        while ((index < length) && (numerator.count != 0u))
+        {
+            if (index != 0u)
+            {
+                NANO_STL_LIBC_DTOA_BignumMultiply(&numerator, 10u);
+            }
+            digits[index] = static_cast<char>('0' + NANO_STL_LIBC_DTOA_BignumDivide(&numerator, &denominator));
+            index++;
+        }
+        NANO_STL_LIBC_Memset(&digits[index], '0', length - index);
+
+        /* Round half to even using the remainder */
+        if (numerator.count != 0u)
+        {
+            NANO_STL_LIBC_DTOA_BignumMultiply(&numerator, 2u);
+            const int compare = NANO_STL_LIBC_DTOA_BignumCompare(&numerator, &denominator);
+            if ((compare > 0) || ((compare == 0) && (((digits[length - 1u] - '0') & 1) != 0)))
+            {
+                length = NANO_STL_LIBC_DTOA_RoundUp(digits, length, decimal_point, fixed);
+            }
+        }
+    }
+    else
+    {}
+
+    return length;
+}
+
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
+/** \brief Initialize the big integers of the exact conversions so that numerator / denominator is in [1, 10[ 
+ *         (the boundaries are only computed if they are not null) and returns the decimal point position */
+static int NANO_STL_LIBC_DTOA_Setup(const nano_stl_libc_diy_fp_t v, const bool lower_boundary_closer, const bool even, 
+                                    nano_stl_libc_bignum_t* numerator, nano_stl_libc_bignum_t* denominator, 
+                                    nano_stl_libc_bignum_t* delta_minus, nano_stl_libc_bignum_t* delta_plus)
+{
+    const nano_stl_libc_diy_fp_t w = NANO_STL_LIBC_DTOA_Normalize(v);
+    const bool boundaries = (delta_plus != nullptr);
+    const unsigned int closer_shift = (lower_boundary_closer ? 1u : 0u);
+
+    /* Estimate the decimal exponent: the estimation is either exact or 1 below the right value */
+    const double k_estimate = (static_cast<double>(w.e + 63) * NANO_STL_LIBC_DTOA_LOG10_2) - 1e-10;
+    int k = static_cast<int>(k_estimate);
+    if (k_estimate > static_cast<double>(k))
+    {
+        k++;
+    }
+
+    /* value = numerator / denominator, the boundaries being at (numerator +/- delta) / denominator, 
+       everything being multiplied by 2 (or 4 when the lower boundary is closer) to get integers */
+    NANO_STL_LIBC_DTOA_BignumAssign(numerator, v.f);
+    if (v.e >= 0)
+    {
+        NANO_STL_LIBC_DTOA_BignumShiftLeft(numerator, static_cast<unsigned int>(v.e) + 1u + closer_shift);
+        NANO_STL_LIBC_DTOA_BignumAssign(denominator, 2u);
+        NANO_STL_LIBC_DTOA_BignumShiftLeft(denominator, closer_shift);
+        if (boundaries)
+        {
+            NANO_STL_LIBC_DTOA_BignumAssign(delta_minus, 1u);
+            NANO_STL_LIBC_DTOA_BignumShiftLeft(delta_minus, static_cast<unsigned int>(v.e));
+            NANO_STL_LIBC_DTOA_BignumAssign(delta_plus, 1u);
+            NANO_STL_LIBC_DTOA_BignumShiftLeft(delta_plus, static_cast<unsigned int>(v.e) + closer_shift);
+        }
+    }
+    else
+    {
+        NANO_STL_LIBC_DTOA_BignumShiftLeft(numerator, 1u + closer_shift);
+        NANO_STL_LIBC_DTOA_BignumAssign(denominator, 1u);
+        NANO_STL_LIBC_DTOA_BignumShiftLeft(denominator, static_cast<unsigned int>(-v.e) + 1u + closer_shift);
+        if (boundaries)
+        {
+            NANO_STL_LIBC_DTOA_BignumAssign(delta_minus, 1u);
+            NANO_STL_LIBC_DTOA_BignumAssign(delta_plus, 1u);
+            NANO_STL_LIBC_DTOA_BignumShiftLeft(delta_plus, closer_shift);
+        }
+    }
+
+    /* Scale by the estimated power of ten */
+    if (k >= 0)
+    {
+        NANO_STL_LIBC_DTOA_BignumMultiplyPow10(denominator, static_cast<unsigned int>(k));
+    }
+    else
+    {
+        NANO_STL_LIBC_DTOA_BignumMultiplyPow10(numerator, static_cast<unsigned int>(-k));
+        if (boundaries)
+        {
+            NANO_STL_LIBC_DTOA_BignumMultiplyPow10(delta_minus, static_cast<unsigned int>(-k));
+            NANO_STL_LIBC_DTOA_BignumMultiplyPow10(delta_plus, static_cast<unsigned int>(-k));
+        }
+    }
+
+    /* Fix the estimation: when the upper boundary reaches the next power of ten, the first digit will be rounded up from 0 to 1 */
+    bool in_range;
+    if (boundaries)
+    {
+        const int compare = NANO_STL_LIBC_DTOA_BignumPlusCompare(numerator, delta_plus, denominator);
+        in_range = (even ? (compare >= 0) : (compare > 0));
+    }
+    else
+    {
+        in_range = (NANO_STL_LIBC_DTOA_BignumCompare(numerator, denominator) >= 0);
+    }
+    if (in_range)
+    {
+        k++;
+    }
+    else
+    {
+        NANO_STL_LIBC_DTOA_BignumMultiply(numerator, 10u);
+        if (boundaries)
+        {
+            NANO_STL_LIBC_DTOA_BignumMultiply(delta_minus, 10u);
+            NANO_STL_LIBC_DTOA_BignumMultiply(delta_plus, 10u);
+        }
+    }
+
+    return k;
+}
+
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+/** \brief Compare a strictly positive and finite double with the decimal value 0.d1d2...dn x 10^decimal_point (at most 19 digits) */
+static int NANO_STL_LIBC_DTOA_CompareDecimal(const double value, const char* digits, const size_t length, const int decimal_point)
+{
+    nano_stl_libc_bignum_t binary;
+    nano_stl_libc_bignum_t decimal;
+    bool lower_boundary_closer;
+    const nano_stl_libc_diy_fp_t v = NANO_STL_LIBC_DTOA_Split(value, &lower_boundary_closer);
+    const int decimal_exponent = decimal_point - static_cast<int>(length);
+    uint64_t significand = 0u;
+
+    /* Compare v.f x 2^v.e with significand x 5^decimal_exponent x 2^decimal_exponent */
+    for (size_t i = 0u; i < length; i++)
+    {
+        significand = (significand * 10u) + static_cast<uint64_t>(digits[i] - '0');
+    }
+    NANO_STL_LIBC_DTOA_BignumAssign(&binary, v.f);
+    NANO_STL_LIBC_DTOA_BignumAssign(&decimal, significand);
+    if (decimal_exponent >= 0)
+    {
+        NANO_STL_LIBC_DTOA_BignumMultiplyPow5(&decimal, static_cast<unsigned int>(decimal_exponent));
+    }
+    else
+    {
+        NANO_STL_LIBC_DTOA_BignumMultiplyPow5(&binary, static_cast<unsigned int>(-decimal_exponent));
+    }
+    if (v.e >= decimal_exponent)
+    {
+        NANO_STL_LIBC_DTOA_BignumShiftLeft(&binary, static_cast<unsigned int>(v.e - decimal_exponent));
+    }
+    else
+    {
+        NANO_STL_LIBC_DTOA_BignumShiftLeft(&decimal, static_cast<unsigned int>(decimal_exponent - v.e));
+    }
+
+    return NANO_STL_LIBC_DTOA_BignumCompare(&binary, &decimal);
+}
+
+/** \brief Add one unit to the last digit, propagating the carry (returns the new number of digits) */
+static size_t NANO_STL_LIBC_DTOA_RoundUp(char* digits, size_t length, int* decimal_point, const bool fixed)
+{
+    size_t index = length;
+    bool carry = true;
+    while ((index != 0u) && carry)
+    {
+        index--;
+        if (digits[index] == '9')
+        {
+            digits[index] = '0';
+        }
+        else
+        {
+            digits[index]++;
+            carry = false;
+        }
+    }
+    if (carry)
+    {
+        /* All the digits were 9s: the value becomes the next power of ten, which has one more integral digit */
+        digits[0u] = '1';
+        (*decimal_point)++;
+        if (fixed && (length < NANO_STL_LIBC_DTOA_MAX_DIGITS))
+        {
+            digits[length] = '0';
+            length++;
+        }
+    }
+
+    return length;
+}
+
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
+/** \brief Build the double closest to significand x 2^exponent, the sticky flag telling if the exact value is slightly above it */
+static double NANO_STL_LIBC_DTOA_MakeDouble(uint64_t significand, int exponent, const bool sticky)
+{
+    uint64_t bits = 0u;
+
+    if (significand != 0u)
+    {
+        /* Biased exponent of the normalized significand */
+        const nano_stl_libc_diy_fp_t x = { significand, exponent };
+        const nano_stl_libc_diy_fp_t w = NANO_STL_LIBC_DTOA_Normalize(x);
+        const int biased_exponent = w.e + 63 + 0x3FF;
+        significand = w.f;
+
+        /* Number of low bits to drop: 11 for a normalized result, more for a denormalized one */
+        const int drop = ((biased_exponent > 0) ? 11 : (12 - biased_exponent));
+        if (drop < 64)
+        {
+            const uint64_t half = (static_cast<uint64_t>(1u) << static_cast<unsigned int>(drop - 1));
+            const uint64_t rest = (significand & ((half << 1u) - 1u));
+            bits = (significand >> static_cast<unsigned int>(drop));
+
+            /* Round half to even, the sticky flag breaking the ties */
+            if ((rest > half) || ((rest == half) && (sticky || ((bits & 1u) != 0u))))
+            {
+                bits++;
+            }
+        }
+        else if (drop == 64)
+        {
+            /* Below the smallest denormalized double, rounded up only above its half */
+            const uint64_t half = (static_cast<uint64_t>(1u) << 63u);
+            bits = (((significand > half) || ((significand == half) && sticky)) ? 1u : 0u);
+        }
+        else
+        {}
+        if (biased_exponent > 0)
+        {
+            /* The carry of the rounding naturally moves to the exponent, which becomes infinity on overflow */
+            if (biased_exponent >= 0x7FF)
+            {
+                bits = NANO_STL_LIBC_DTOA_INFINITY_BITS;
+            }
+            else
+            {
+                bits = (bits - NANO_STL_LIBC_DTOA_HIDDEN_BIT) + (static_cast<uint64_t>(biased_exponent) << 52u);
+            }
+        }
+    }
+
+    return NANO_STL_LIBC_DTOA_FromBits(bits);
+}
+
+/** \brief Assign a 64 bits value to a big integer */
+static void NANO_STL_LIBC_DTOA_BignumAssign(nano_stl_libc_bignum_t* x, const uint64_t value)
+{
+    x->limbs[0u] = static_cast<uint32_t>(value);
+    x->limbs[1u] = static_cast<uint32_t>(value >> 32u);
+    x->count = ((x->limbs[1u] != 0u) ? 2u : ((x->limbs[0u] != 0u) ? 1u : 0u));
+}
+
+/** \brief Shift left a big integer */
+static void NANO_STL_LIBC_DTOA_BignumShiftLeft(nano_stl_libc_bignum_t* x, const unsigned int shift)
+{
+    if (x->count != 0u)
+    {
+        const unsigned int limb_shift = (shift / 32u);
+        const unsigned int bit_shift = (shift % 32u);
+        unsigned int index = x->count;
+
+        /* Shift from the most significant limb */
+        x->limbs[index + limb_shift] = 0u;
+        while (index != 0u)
+        {
+            index--;
+            if (bit_shift != 0u)
+            {
+                x->limbs[index + limb_shift + 1u] |= (x->limbs[index] >> (32u - bit_shift));
+            }
+            x->limbs[index + limb_shift] = (x->limbs[index] << bit_shift);
+        }
+        NANO_STL_LIBC_Memset(x->limbs, 0, limb_shift * sizeof(uint32_t));
+        x->count += limb_shift + 1u;
+        if (x->limbs[x->count - 1u] == 0u)
+        {
+            x->count--;
+        }
+    }
+}
+
+/** \brief Multiply a big integer by a 32 bits value */
+static void NANO_STL_LIBC_DTOA_BignumMultiply(nano_stl_libc_bignum_t* x, const uint32_t factor)
+{
+    uint64_t carry = 0u;
+    for (unsigned int i = 0u; i < x->count; i++)
+    {
+        const uint64_t product = (static_cast<uint64_t>(x->limbs[i]) * factor) + carry;
+        x->limbs[i] = static_cast<uint32_t>(product);
+        carry = (product >> 32u);
+    }
+    if (carry != 0u)
+    {
+        x->limbs[x->count] = static_cast<uint32_t>(carry);
+        x->count++;
+    }
+}
+
+/** \brief Multiply a big integer by a power of five */
+static void NANO_STL_LIBC_DTOA_BignumMultiplyPow5(nano_stl_libc_bignum_t* x, unsigned int exponent)
+{
+    /* 5^13 is the biggest power of 5 which fits in 32 bits */
+    static const uint32_t powers_of_5[] = { 1u, 5u, 25u, 125u, 625u, 3125u, 15625u, 78125u, 390625u, 1953125u, 9765625u, 48828125u, 244140625u, 1220703125u };
+    while (exponent >= 13u)
+    {
+        NANO_STL_LIBC_DTOA_BignumMultiply(x, powers_of_5[13u]);
+        exponent -= 13u;
+    }
+    if (exponent != 0u)
+    {
+        NANO_STL_LIBC_DTOA_BignumMultiply(x, powers_of_5[exponent]);
+    }
+}
+
+/** \brief Multiply a big integer by a power of ten */
+static void NANO_STL_LIBC_DTOA_BignumMultiplyPow10(nano_stl_libc_bignum_t* x, const unsigned int exponent)
+{
+    /* 10^n = 5^n x 2^n */
+    NANO_STL_LIBC_DTOA_BignumMultiplyPow5(x, exponent);
+    NANO_STL_LIBC_DTOA_BignumShiftLeft(x, exponent);
+}
+
+/** \brief Compare 2 big integers */
+static int NANO_STL_LIBC_DTOA_BignumCompare(const nano_stl_libc_bignum_t* x, const nano_stl_libc_bignum_t* y)
+{
+    int ret = 0;
+    if (x->count != y->count)
+    {
+        ret = ((x->count > y->count) ? 1 : -1);
+    }
+    else
+    {
+        unsigned int index = x->count;
+        while ((index != 0u) && (ret == 0))
+        {
+            index--;
+            if (x->limbs[index] != y->limbs[index])
+            {
+                ret = ((x->limbs[index] > y->limbs[index]) ? 1 : -1);
+            }
+        }
+    }
+    return ret;
+}
+
+/** \brief Compare the sum of 2 big integers with a third one */
+static int NANO_STL_LIBC_DTOA_BignumPlusCompare(const nano_stl_libc_bignum_t* x, const nano_stl_libc_bignum_t* y, const nano_stl_libc_bignum_t* z)
+{
+    nano_stl_libc_bignum_t sum;
+    const unsigned int count = ((x->count > y->count) ? x->count : y->count);
+    uint64_t carry = 0u;
+    for (unsigned int i = 0u; i < count; i++)
+    {
+        const uint64_t limb_sum = static_cast<uint64_t>((i < x->count) ? x->limbs[i] : 0u) + 
+                                  static_cast<uint64_t>((i < y->count) ? y->limbs[i] : 0u) + carry;
+        sum.limbs[i] = static_cast<uint32_t>(limb_sum);
+        carry = (limb_sum >> 32u);
+    }
+    sum.count = count;
+    if (carry != 0u)
+    {
+        sum.limbs[count] = static_cast<uint32_t>(carry);
+        sum.count++;
+    }
+    return NANO_STL_LIBC_DTOA_BignumCompare(&sum, z);
+}
+
+/** \brief Subtract a big integer from a bigger one */
+static void NANO_STL_LIBC_DTOA_BignumSubtract(nano_stl_libc_bignum_t* x, const nano_stl_libc_bignum_t* y)
+{
+    uint32_t borrow = 0u;
+    for (unsigned int i = 0u; i < x->count; i++)
+    {
+        const uint64_t subtrahend = static_cast<uint64_t>((i < y->count) ? y->limbs[i] : 0u) + borrow;
+        borrow = ((static_cast<uint64_t>(x->limbs[i]) < subtrahend) ? 1u : 0u);
+        x->limbs[i] = static_cast<uint32_t>(static_cast<uint64_t>(x->limbs[i]) - subtrahend);
+    }
+    while ((x->count != 0u) && (x->limbs[x->count - 1u] == 0u))
+    {
+        x->count--;
+    }
+}
+
+/** \brief Divide a big integer by another one which is at most 10 times smaller, the remainder is stored in the dividend */
+static char NANO_STL_LIBC_DTOA_BignumDivide(nano_stl_libc_bignum_t* x, const nano_stl_libc_bignum_t* y)
+{
+    char quotient = 0;
+    while (NANO_STL_LIBC_DTOA_BignumCompare(x, y) >= 0)
+    {
+        NANO_STL_LIBC_DTOA_BignumSubtract(x, y);
+        quotient++;
+    }
+    return quotient;
+}
+
+/** \brief Compute the number of significant bits of a big integer */
+static unsigned int NANO_STL_LIBC_DTOA_BignumBitLength(const nano_stl_libc_bignum_t* x)
+{
+    unsigned int length = 0u;
+    if (x->count != 0u)
+    {
+        uint32_t top = x->limbs[x->count - 1u];
+        length = 32u * (x->count - 1u);
+        while (top != 0u)
+        {
+            length++;
+            top >>= 1u;
+        }
+    }
+    return length;
+}
@@ -0,0 +1,96 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_STL_LIBC_DTOA_H
+#define NANO_STL_LIBC_DTOA_H
+
+#include "nano-stl-libc.h"
+
+
+/** \brief Maximum precision (number of digits after the decimal point) of the floating point conversions */
+#define NANO_STL_LIBC_DTOA_MAX_PRECISION    40
+
+/** \brief Maximum number of digits generated by the floating point conversions
+ *         (all the integer digits of the largest double followed by the maximum precision) */
+#define NANO_STL_LIBC_DTOA_MAX_DIGITS       (309 + NANO_STL_LIBC_DTOA_MAX_PRECISION + 1)
+
+
+/** \brief IEEE 754 bits of the positive infinity */
+#define NANO_STL_LIBC_DTOA_INFINITY_BITS    (static_cast<uint64_t>(0x7FF00000u) << 32u)
+
+
+/** \brief Binary representation of a double */
+typedef union _nano_stl_libc_double_bits_t
+{
+    /** \brief Value */
+    double value;
+    /** \brief IEEE 754 bits */
+    uint64_t bits;
+} nano_stl_libc_double_bits_t;
+
+/** \brief Get the IEEE 754 bits of a double */
+static inline uint64_t NANO_STL_LIBC_DTOA_GetBits(const double value)
+{
+    nano_stl_libc_double_bits_t double_bits;
+    double_bits.value = value;
+    return double_bits.bits;
+}
+
+/** \brief Build a double from its IEEE 754 bits */
+static inline double NANO_STL_LIBC_DTOA_FromBits(const uint64_t bits)
+{
+    nano_stl_libc_double_bits_t double_bits;
+    double_bits.bits = bits;
+    return double_bits.value;
+}
+
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Compute the double closest to significand x 10^exponent (exact conversion using big integers) */
+double NANO_STL_LIBC_DTOA_ScalePow10(const uint64_t significand, const int exponent);
+
+/** \brief Compare the decimal value 0.d1d2...dn x 10^decimal_point with the middle between a positive and finite value and the next double
+ *         (the digits are read from digits to end, skipping the decimal point char, returns -1, 0 or 1 like a comparison function) */
+int NANO_STL_LIBC_DTOA_CompareHalfway(const double value, const char* digits, const char* end, const int decimal_point);
+
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+/** \brief Generate the shortest digits which read back to the given strictly positive and finite value
+ *         (value = 0.d1d2...dn x 10^decimal_point, returns the number n of digits, 17 at most) */
+size_t NANO_STL_LIBC_DTOA_Shortest(const double value, char* digits, int* decimal_point);
+
+/** \brief Generate the correctly rounded digits of the given positive and finite value, either with the given number of significant
+ *         digits (fixed = false) or up to the given number of digits after the decimal point (fixed = true)
+ *         (value = 0.d1d2...dn x 10^decimal_point, returns the number n of digits, 0 if the value rounds to zero) */
+size_t NANO_STL_LIBC_DTOA_Precision(const double value, const int precision, const bool fixed, char* digits, int* decimal_point);
+
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* NANO_STL_LIBC_DTOA_H */
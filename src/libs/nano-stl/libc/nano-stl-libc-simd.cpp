@@ -0,0 +1,789 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "nano-stl-libc-simd.h"
+
+
+// Check if the SIMD backend is available
+#if (NANO_STL_LIBC_SIMD_BACKEND == 1)
+
+#include <immintrin.h>
+#include <cpuid.h>
+
+
+/** \brief Attribute of the functions using the SSE2 instruction set */
+#define NANO_STL_LIBC_SIMD_SSE2         __attribute__((target("sse2")))
+
+/** \brief Attribute of the functions using the AVX2 instruction set */
+#define NANO_STL_LIBC_SIMD_AVX2         __attribute__((target("avx2")))
+
+/** \brief Smallest page size of the x86 CPUs, reads which do not cross a page boundary cannot fault */
+#define NANO_STL_LIBC_SIMD_PAGE_SIZE    4096u
+
+
+/** \brief Memset function */
+typedef void* (*nano_stl_libc_memset_t)(void* const dst, const int val, size_t size);
+
+/** \brief Memcpy function */
+typedef void* (*nano_stl_libc_memcpy_t)(void* const dst, const void* const src, size_t size);
+
+/** \brief Memcmp function */
+typedef int (*nano_stl_libc_memcmp_t)(const void* const s1, const void* const s2, size_t size);
+
+/** \brief Strncmp function */
+typedef int (*nano_stl_libc_strncmp_t)(const char* s1, const char* s2, size_t size);
+
+/** \brief Strnlen function */
+typedef size_t (*nano_stl_libc_strnlen_t)(const char* s, size_t maxlen);
+
+/** \brief Lib C functions implemented with a given instruction set */
+typedef struct _nano_stl_libc_simd_functions_t
+{
+    /** \brief Memset function */
+    nano_stl_libc_memset_t memset;
+    /** \brief Memcpy function */
+    nano_stl_libc_memcpy_t memcpy;
+    /** \brief Memcmp function */
+    nano_stl_libc_memcmp_t memcmp;
+    /** \brief Strncmp function */
+    nano_stl_libc_strncmp_t strncmp;
+    /** \brief Strnlen function */
+    nano_stl_libc_strnlen_t strnlen;
+    /** \brief Instruction set name */
+    const char* instruction_set;
+} nano_stl_libc_simd_functions_t;
+
+
+/** \brief Select the instruction set matching the current CPU (called at startup and on the first call to any function) */
+static void NANO_STL_LIBC_SIMD_Select(void) __attribute__((constructor));
+
+/** \brief Read the extended control register 0 to check which registers states are saved by the OS */
+static uint32_t NANO_STL_LIBC_SIMD_Xgetbv(void);
+
+/** \brief Compare the bytes at the given index of 2 buffers which are known to be different */
+static inline int NANO_STL_LIBC_SIMD_ByteDiff(const uint8_t* u8_s1, const uint8_t* u8_s2, const size_t index);
+
+/** \brief Compare the chars at the given index of 2 strings (as unsigned chars) */
+static inline int NANO_STL_LIBC_SIMD_CharDiff(const char* s1, const char* s2, const size_t index);
+
+/** \brief Check if a vector of the given size can be read at the given address without crossing a page boundary */
+static inline bool NANO_STL_LIBC_SIMD_IsPageSafe(const char* s, const size_t vector_size);
+
+/** \brief Memset function called before the instruction set selection */
+static void* NANO_STL_LIBC_SIMD_FirstMemset(void* const dst, const int val, size_t size);
+
+/** \brief Memcpy function called before the instruction set selection */
+static void* NANO_STL_LIBC_SIMD_FirstMemcpy(void* const dst, const void* const src, size_t size);
+
+/** \brief Memcmp function called before the instruction set selection */
+static int NANO_STL_LIBC_SIMD_FirstMemcmp(const void* const s1, const void* const s2, size_t size);
+
+/** \brief Strncmp function called before the instruction set selection */
+static int NANO_STL_LIBC_SIMD_FirstStrncmp(const char* s1, const char* s2, size_t size);
+
+/** \brief Strnlen function called before the instruction set selection */
+static size_t NANO_STL_LIBC_SIMD_FirstStrnlen(const char* s, size_t maxlen);
+
+/** \brief SSE2 memset function */
+static void* NANO_STL_LIBC_SIMD_SSE2_Memset(void* const dst, const int val, size_t size) NANO_STL_LIBC_SIMD_SSE2;
+
+/** \brief SSE2 memcpy function */
+static void* NANO_STL_LIBC_SIMD_SSE2_Memcpy(void* const dst, const void* const src, size_t size) NANO_STL_LIBC_SIMD_SSE2;
+
+/** \brief SSE2 memcmp function */
+static int NANO_STL_LIBC_SIMD_SSE2_Memcmp(const void* const s1, const void* const s2, size_t size) NANO_STL_LIBC_SIMD_SSE2;
+
+/** \brief SSE2 strncmp function */
+static int NANO_STL_LIBC_SIMD_SSE2_Strncmp(const char* s1, const char* s2, size_t size) NANO_STL_LIBC_SIMD_SSE2 NANO_STL_LIBC_NO_SANITIZE_ADDRESS;
+
+/** \brief SSE2 strnlen function */
+static size_t NANO_STL_LIBC_SIMD_SSE2_Strnlen(const char* s, size_t maxlen) NANO_STL_LIBC_SIMD_SSE2 NANO_STL_LIBC_NO_SANITIZE_ADDRESS;
+
+/** \brief AVX2 memset function */
+static void* NANO_STL_LIBC_SIMD_AVX2_Memset(void* const dst, const int val, size_t size) NANO_STL_LIBC_SIMD_AVX2;
+
+/** \brief AVX2 memcpy function */
+static void* NANO_STL_LIBC_SIMD_AVX2_Memcpy(void* const dst, const void* const src, size_t size) NANO_STL_LIBC_SIMD_AVX2;
+
+/** \brief AVX2 memcmp function */
+static int NANO_STL_LIBC_SIMD_AVX2_Memcmp(const void* const s1, const void* const s2, size_t size) NANO_STL_LIBC_SIMD_AVX2;
+
+/** \brief AVX2 strncmp function */
+static int NANO_STL_LIBC_SIMD_AVX2_Strncmp(const char* s1, const char* s2, size_t size) NANO_STL_LIBC_SIMD_AVX2 NANO_STL_LIBC_NO_SANITIZE_ADDRESS;
+
+/** \brief AVX2 strnlen function */
+static size_t NANO_STL_LIBC_SIMD_AVX2_Strnlen(const char* s, size_t maxlen) NANO_STL_LIBC_SIMD_AVX2 NANO_STL_LIBC_NO_SANITIZE_ADDRESS;
+
+
+/** \brief Portable functions */
+static const nano_stl_libc_simd_functions_t s_portable_functions = { NANO_STL_LIBC_PortableMemset,
+                                                                     NANO_STL_LIBC_PortableMemcpy,
+                                                                     NANO_STL_LIBC_PortableMemcmp,
+                                                                     NANO_STL_LIBC_PortableStrncmp,
+                                                                     NANO_STL_LIBC_PortableStrnlen,
+                                                                     "portable" };
+
+/** \brief SSE2 functions */
+static const nano_stl_libc_simd_functions_t s_sse2_functions = { NANO_STL_LIBC_SIMD_SSE2_Memset,
+                                                                 NANO_STL_LIBC_SIMD_SSE2_Memcpy,
+                                                                 NANO_STL_LIBC_SIMD_SSE2_Memcmp,
+                                                                 NANO_STL_LIBC_SIMD_SSE2_Strncmp,
+                                                                 NANO_STL_LIBC_SIMD_SSE2_Strnlen,
+                                                                 "sse2" };
+
+/** \brief AVX2 functions */
+static const nano_stl_libc_simd_functions_t s_avx2_functions = { NANO_STL_LIBC_SIMD_AVX2_Memset,
+                                                                 NANO_STL_LIBC_SIMD_AVX2_Memcpy,
+                                                                 NANO_STL_LIBC_SIMD_AVX2_Memcmp,
+                                                                 NANO_STL_LIBC_SIMD_AVX2_Strncmp,
+                                                                 NANO_STL_LIBC_SIMD_AVX2_Strnlen,
+                                                                 "avx2" };
+
+/** \brief Functions of the selected instruction set (the first call to any of them triggers the selection
+ *         if it occurs before the startup selection, for example from a static object constructor) */
+static nano_stl_libc_simd_functions_t s_simd_functions = { NANO_STL_LIBC_SIMD_FirstMemset,
+                                                           NANO_STL_LIBC_SIMD_FirstMemcpy,
+                                                           NANO_STL_LIBC_SIMD_FirstMemcmp,
+                                                           NANO_STL_LIBC_SIMD_FirstStrncmp,
+                                                           NANO_STL_LIBC_SIMD_FirstStrnlen,
+                                                           "none" };
+
+
+
+/** \brief Highly portable memset function (word at a time if NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED) */
+void* NANO_STL_LIBC_Memset(void* const dst, const int val, size_t size)
+{
+    return s_simd_functions.memset(dst, val, size);
+}
+
+/** \brief Highly portable memcpy function (word at a time if NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED) */
+void* NANO_STL_LIBC_Memcpy(void* const dst, const void* const src, size_t size)
+{
+    return s_simd_functions.memcpy(dst, src, size);
+}
+
+/** \brief Highly portable memcmp function (word at a time if NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED) */
+int NANO_STL_LIBC_Memcmp(const void* const s1, const void* const s2, size_t size)
+{
+    return s_simd_functions.memcmp(s1, s2, size);
+}
+
+/** \brief Highly portable strncmp function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED) */
+int NANO_STL_LIBC_Strncmp(const char* s1, const char* s2, size_t size)
+{
+    return s_simd_functions.strncmp(s1, s2, size);
+}
+
+/** \brief Highly portable strnlen function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED) */
+size_t NANO_STL_LIBC_Strnlen(const char* s, size_t maxlen)
+{
+    return s_simd_functions.strnlen(s, maxlen);
+}
+
+/** \brief Get the name of the instruction set selected by the SIMD backend for the current CPU ("avx2", "sse2" or "portable") */
+const char* NANO_STL_LIBC_SIMD_GetInstructionSet(void)
+{
+    NANO_STL_LIBC_SIMD_Select();
+    return s_simd_functions.instruction_set;
+}
+
+
+
+/** \brief Select the instruction set matching the current CPU (called at startup and on the first call to any function) */
+static void NANO_STL_LIBC_SIMD_Select(void)
+{
+    unsigned int eax = 0u;
+    unsigned int ebx = 0u;
+    unsigned int ecx = 0u;
+    unsigned int edx = 0u;
+    const nano_stl_libc_simd_functions_t* functions = &s_portable_functions;
+
+    if (__get_cpuid(1u, &eax, &ebx, &ecx, &edx) != 0)
+    {
+        if ((edx & bit_SSE2) != 0u)
+        {
+            functions = &s_sse2_functions;
+        }
+
+        // AVX2 also needs the OS to save the YMM registers state (XCR0 bits 1 and 2)
+        if (((ecx & bit_OSXSAVE) != 0u) && ((ecx & bit_AVX) != 0u) &&
+            ((NANO_STL_LIBC_SIMD_Xgetbv() & 0x06u) == 0x06u))
+        {
+            if ((__get_cpuid_count(7u, 0u, &eax, &ebx, &ecx, &edx) != 0) && ((ebx & bit_AVX2) != 0u))
+            {
+                functions = &s_avx2_functions;
+            }
+        }
+    }
+
+    s_simd_functions = (*functions);
+}
+
+/** \brief Read the extended control register 0 to check which registers states are saved by the OS */
+static uint32_t NANO_STL_LIBC_SIMD_Xgetbv(void)
+{
+    uint32_t eax = 0u;
+    uint32_t edx = 0u;
+    __asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0u));
+    return eax;
+}
+
+/** \brief Compare the bytes at the given index of 2 buffers which are known to be different */
+static inline int NANO_STL_LIBC_SIMD_ByteDiff(const uint8_t* u8_s1, const uint8_t* u8_s2, const size_t index)
+{
+    return ((u8_s1[index] > u8_s2[index]) ? 1 : -1);
+}
+
+/** \brief Compare the chars at the given index of 2 strings (as unsigned chars) */
+static inline int NANO_STL_LIBC_SIMD_CharDiff(const char* s1, const char* s2, const size_t index)
+{
+    int ret = 0;
+    if (static_cast<uint8_t>(s1[index]) > static_cast<uint8_t>(s2[index]))
+    {
+        ret = 1;
+    }
+    else if (static_cast<uint8_t>(s1[index]) < static_cast<uint8_t>(s2[index]))
+    {
+        ret = -1;
+    }
+    else
+    {}
+    return ret;
+}
+
+/** \brief Check if a vector of the given size can be read at the given address without crossing a page boundary */
+static inline bool NANO_STL_LIBC_SIMD_IsPageSafe(const char* s, const size_t vector_size)
+{
+    return ((reinterpret_cast<uintptr_t>(s) & (NANO_STL_LIBC_SIMD_PAGE_SIZE - 1u)) <= (NANO_STL_LIBC_SIMD_PAGE_SIZE - vector_size));
+}
+
+/** \brief Memset function called before the instruction set selection */
+static void* NANO_STL_LIBC_SIMD_FirstMemset(void* const dst, const int val, size_t size)
+{
+    NANO_STL_LIBC_SIMD_Select();
+    return s_simd_functions.memset(dst, val, size);
+}
+
+/** \brief Memcpy function called before the instruction set selection */
+static void* NANO_STL_LIBC_SIMD_FirstMemcpy(void* const dst, const void* const src, size_t size)
+{
+    NANO_STL_LIBC_SIMD_Select();
+    return s_simd_functions.memcpy(dst, src, size);
+}
+
+/** \brief Memcmp function called before the instruction set selection */
+static int NANO_STL_LIBC_SIMD_FirstMemcmp(const void* const s1, const void* const s2, size_t size)
+{
+    NANO_STL_LIBC_SIMD_Select();
+    return s_simd_functions.memcmp(s1, s2, size);
+}
+
+/** \brief Strncmp function called before the instruction set selection */
+static int NANO_STL_LIBC_SIMD_FirstStrncmp(const char* s1, const char* s2, size_t size)
+{
+    NANO_STL_LIBC_SIMD_Select();
+    return s_simd_functions.strncmp(s1, s2, size);
+}
+
+/** \brief Strnlen function called before the instruction set selection */
+static size_t NANO_STL_LIBC_SIMD_FirstStrnlen(const char* s, size_t maxlen)
+{
+    NANO_STL_LIBC_SIMD_Select();
+    return s_simd_functions.strnlen(s, maxlen);
+}
+
+
+
+////// SSE2 implementation //////
+
+/** \brief SSE2 memset function */
+static void* NANO_STL_LIBC_SIMD_SSE2_Memset(void* const dst, const int val, size_t size)
+{
+    if ((dst != nullptr) && (size >= sizeof(__m128i)))
+    {
+        const __m128i v_val = _mm_set1_epi8(static_cast<char>(val));
+        uint8_t* u8_dst = static_cast<uint8_t*>(dst);
+        uint8_t* const u8_end = u8_dst + size;
+
+        // Unaligned head, aligned blocks, then unaligned tail overlapping the last block
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(u8_dst), v_val);
+        u8_dst = reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(u8_dst) + sizeof(__m128i)) & ~static_cast<uintptr_t>(sizeof(__m128i) - 1u));
+        while (static_cast<size_t>(u8_end - u8_dst) >= (4u * sizeof(__m128i)))
+        {
+            __m128i* const v_dst = reinterpret_cast<__m128i*>(u8_dst);
+            _mm_store_si128(&v_dst[0u], v_val);
+            _mm_store_si128(&v_dst[1u], v_val);
+            _mm_store_si128(&v_dst[2u], v_val);
+            _mm_store_si128(&v_dst[3u], v_val);
+            u8_dst += (4u * sizeof(__m128i));
+        }
+        while (static_cast<size_t>(u8_end - u8_dst) >= sizeof(__m128i))
+        {
+            _mm_store_si128(reinterpret_cast<__m128i*>(u8_dst), v_val);
+            u8_dst += sizeof(__m128i);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(u8_end - sizeof(__m128i)), v_val);
+    }
+    else
+    {
+        NANO_STL_LIBC_PortableMemset(dst, val, size);
+    }
+
+    return dst;
+}
+
+/** \brief SSE2 memcpy function */
+static void* NANO_STL_LIBC_SIMD_SSE2_Memcpy(void* const dst, const void* const src, size_t size)
+{
+    if ((dst != nullptr) && (src != nullptr) && (size >= sizeof(__m128i)))
+    {
+        const uint8_t* u8_src = static_cast<const uint8_t*>(src);
+        uint8_t* u8_dst = static_cast<uint8_t*>(dst);
+        const __m128i v_head = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u8_src));
+        const __m128i v_tail = _mm_loadu_si128(reinterpret_cast<const __m128i*>(u8_src + size - sizeof(__m128i)));
+        uint8_t* const u8_tail = u8_dst + size - sizeof(__m128i);
+
+        // Align destination, the skipped bytes are written by the head vector
+        const size_t skip = sizeof(__m128i) - (reinterpret_cast<uintptr_t>(u8_dst) & (sizeof(__m128i) - 1u));
+        u8_src += skip;
+        u8_dst += skip;
+        size -= skip;
+
+        while (size >= (4u * sizeof(__m128i)))
+        {
+            const __m128i* const v_src = reinterpret_cast<const __m128i*>(u8_src);
+            __m128i* const v_dst = reinterpret_cast<__m128i*>(u8_dst);
+            const __m128i v0 = _mm_loadu_si128(&v_src[0u]);
+            const __m128i v1 = _mm_loadu_si128(&v_src[1u]);
+            const __m128i v2 = _mm_loadu_si128(&v_src[2u]);
+            const __m128i v3 = _mm_loadu_si128(&v_src[3u]);
+            _mm_store_si128(&v_dst[0u], v0);
+            _mm_store_si128(&v_dst[1u], v1);
+            _mm_store_si128(&v_dst[2u], v2);
+            _mm_store_si128(&v_dst[3u], v3);
+            u8_src += (4u * sizeof(__m128i));
+            u8_dst += (4u * sizeof(__m128i));
+            size -= (4u * sizeof(__m128i));
+        }
+        while (size >= sizeof(__m128i))
+        {
+            _mm_store_si128(reinterpret_cast<__m128i*>(u8_dst), _mm_loadu_si128(reinterpret_cast<const __m128i*>(u8_src)));
+            u8_src += sizeof(__m128i);
+            u8_dst += sizeof(__m128i);
+            size -= sizeof(__m128i);
+        }
+
+        // Head and tail vectors overlap the blocks
+        _mm_storeu_si128(static_cast<__m128i*>(dst), v_head);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(u8_tail), v_tail);
+    }
+    else
+    {
+        NANO_STL_LIBC_PortableMemcpy(dst, src, size);
+    }
+
+    return dst;
+}
+
+/** \brief SSE2 memcmp function */
+static int NANO_STL_LIBC_SIMD_SSE2_Memcmp(const void* const s1, const void* const s2, size_t size)
+{
+    int ret = 0;
+
+    if ((s1 != nullptr) && (s2 != nullptr) && (size >= sizeof(__m128i)))
+    {
+        const uint8_t* const u8_s1 = static_cast<const uint8_t*>(s1);
+        const uint8_t* const u8_s2 = static_cast<const uint8_t*>(s2);
+        size_t offset = 0u;
+        unsigned int mask = 0xFFFFu;
+
+        // Skip equal blocks of 2 vectors
+        while (((size - offset) >= (2u * sizeof(__m128i))) && (mask == 0xFFFFu))
+        {
+            const __m128i* const v_s1 = reinterpret_cast<const __m128i*>(u8_s1 + offset);
+            const __m128i* const v_s2 = reinterpret_cast<const __m128i*>(u8_s2 + offset);
+            const __m128i v_eq0 = _mm_cmpeq_epi8(_mm_loadu_si128(&v_s1[0u]), _mm_loadu_si128(&v_s2[0u]));
+            const __m128i v_eq1 = _mm_cmpeq_epi8(_mm_loadu_si128(&v_s1[1u]), _mm_loadu_si128(&v_s2[1u]));
+            mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(v_eq0, v_eq1)));
+            if (mask == 0xFFFFu)
+            {
+                offset += (2u * sizeof(__m128i));
+            }
+        }
+
+        // Find the first different vector, the last one overlaps the previous ones
+        mask = 0xFFFFu;
+        while ((offset < size) && (mask == 0xFFFFu))
+        {
+            if ((size - offset) < sizeof(__m128i))
+            {
+                offset = size - sizeof(__m128i);
+            }
+            mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(u8_s1 + offset)),
+                                                                               _mm_loadu_si128(reinterpret_cast<const __m128i*>(u8_s2 + offset)))));
+            if (mask == 0xFFFFu)
+            {
+                offset += sizeof(__m128i);
+            }
+        }
+        if (mask != 0xFFFFu)
+        {
+            ret = NANO_STL_LIBC_SIMD_ByteDiff(u8_s1, u8_s2, offset + static_cast<size_t>(__builtin_ctz(~mask)));
+        }
+    }
+    else
+    {
+        ret = NANO_STL_LIBC_PortableMemcmp(s1, s2, size);
+    }
+
+    return ret;
+}
+
+/** \brief SSE2 strncmp function */
+static int NANO_STL_LIBC_SIMD_SSE2_Strncmp(const char* s1, const char* s2, size_t size)
+{
+    int ret = 0;
+
+    if ((s1 != nullptr) && (s2 != nullptr))
+    {
+        const __m128i v_zero = _mm_setzero_si128();
+        size_t offset = 0u;
+        while (offset < size)
+        {
+            if (NANO_STL_LIBC_SIMD_IsPageSafe(s1 + offset, sizeof(__m128i)) && NANO_STL_LIBC_SIMD_IsPageSafe(s2 + offset, sizeof(__m128i)))
+            {
+                // Look for the first different or null char in the vector, the vectors may extend past the end of the strings
+                // but stay in the same page (the address sanitizer is disabled for this function)
+                const __m128i v_s1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s1 + offset));
+                const __m128i v_s2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s2 + offset));
+                const unsigned int eq_mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(v_s1, v_s2)));
+                const unsigned int zero_mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(v_s1, v_zero)));
+                const unsigned int stop_mask = (~eq_mask | zero_mask) & 0xFFFFu;
+                if (stop_mask != 0u)
+                {
+                    offset += static_cast<size_t>(__builtin_ctz(stop_mask));
+                    if (offset < size)
+                    {
+                        ret = NANO_STL_LIBC_SIMD_CharDiff(s1, s2, offset);
+                    }
+                    size = 0u;
+                }
+                else
+                {
+                    offset += sizeof(__m128i);
+                }
+            }
+            else
+            {
+                // Near a page boundary, compare a single char
+                ret = NANO_STL_LIBC_SIMD_CharDiff(s1, s2, offset);
+                if ((ret != 0) || (s1[offset] == 0))
+                {
+                    size = 0u;
+                }
+                offset++;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/** \brief SSE2 strnlen function */
+static size_t NANO_STL_LIBC_SIMD_SSE2_Strnlen(const char* s, size_t maxlen)
+{
+    size_t len = 0u;
+
+    if ((s != nullptr) && (maxlen != 0u))
+    {
+        // Aligned reads never cross a page boundary, the bytes before the string are discarded and the bytes
+        // after the null char are read but ignored (the address sanitizer is disabled for this function)
+        const __m128i v_zero = _mm_setzero_si128();
+        const size_t misalignment = reinterpret_cast<uintptr_t>(s) & (sizeof(__m128i) - 1u);
+        const char* block = s - misalignment;
+        unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(block)), v_zero))) >> misalignment;
+        if (mask != 0u)
+        {
+            len = static_cast<size_t>(__builtin_ctz(mask));
+        }
+        else
+        {
+            len = sizeof(__m128i) - misalignment;
+            while ((len < maxlen) && (mask == 0u))
+            {
+                mask = static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(s + len)), v_zero)));
+                if (mask != 0u)
+                {
+                    len += static_cast<size_t>(__builtin_ctz(mask));
+                }
+                else
+                {
+                    len += sizeof(__m128i);
+                }
+            }
+        }
+        if (len > maxlen)
+        {
+            len = maxlen;
+        }
+    }
+
+    return len;
+}
+
+
+
+////// AVX2 implementation //////
+
+/** \brief AVX2 memset function */
+static void* NANO_STL_LIBC_SIMD_AVX2_Memset(void* const dst, const int val, size_t size)
+{
+    if ((dst != nullptr) && (size >= sizeof(__m256i)))
+    {
+        const __m256i v_val = _mm256_set1_epi8(static_cast<char>(val));
+        uint8_t* u8_dst = static_cast<uint8_t*>(dst);
+        uint8_t* const u8_end = u8_dst + size;
+
+        // Unaligned head, aligned blocks, then unaligned tail overlapping the last block
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(u8_dst), v_val);
+        u8_dst = reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(u8_dst) + sizeof(__m256i)) & ~static_cast<uintptr_t>(sizeof(__m256i) - 1u));
+        while (static_cast<size_t>(u8_end - u8_dst) >= (4u * sizeof(__m256i)))
+        {
+            __m256i* const v_dst = reinterpret_cast<__m256i*>(u8_dst);
+            _mm256_store_si256(&v_dst[0u], v_val);
+            _mm256_store_si256(&v_dst[1u], v_val);
+            _mm256_store_si256(&v_dst[2u], v_val);
+            _mm256_store_si256(&v_dst[3u], v_val);
+            u8_dst += (4u * sizeof(__m256i));
+        }
+        while (static_cast<size_t>(u8_end - u8_dst) >= sizeof(__m256i))
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(u8_dst), v_val);
+            u8_dst += sizeof(__m256i);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(u8_end - sizeof(__m256i)), v_val);
+    }
+    else
+    {
+        NANO_STL_LIBC_SIMD_SSE2_Memset(dst, val, size);
+    }
+
+    return dst;
+}
+
+/** \brief AVX2 memcpy function */
+static void* NANO_STL_LIBC_SIMD_AVX2_Memcpy(void* const dst, const void* const src, size_t size)
+{
+    if ((dst != nullptr) && (src != nullptr) && (size >= sizeof(__m256i)))
+    {
+        const uint8_t* u8_src = static_cast<const uint8_t*>(src);
+        uint8_t* u8_dst = static_cast<uint8_t*>(dst);
+        const __m256i v_head = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(u8_src));
+        const __m256i v_tail = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(u8_src + size - sizeof(__m256i)));
+        uint8_t* const u8_tail = u8_dst + size - sizeof(__m256i);
+
+        // Align destination, the skipped bytes are written by the head vector
+        const size_t skip = sizeof(__m256i) - (reinterpret_cast<uintptr_t>(u8_dst) & (sizeof(__m256i) - 1u));
+        u8_src += skip;
+        u8_dst += skip;
+        size -= skip;
+
+        while (size >= (4u * sizeof(__m256i)))
+        {
+            const __m256i* const v_src = reinterpret_cast<const __m256i*>(u8_src);
+            __m256i* const v_dst = reinterpret_cast<__m256i*>(u8_dst);
+            const __m256i v0 = _mm256_loadu_si256(&v_src[0u]);
+            const __m256i v1 = _mm256_loadu_si256(&v_src[1u]);
+            const __m256i v2 = _mm256_loadu_si256(&v_src[2u]);
+            const __m256i v3 = _mm256_loadu_si256(&v_src[3u]);
+            _mm256_store_si256(&v_dst[0u], v0);
+            _mm256_store_si256(&v_dst[1u], v1);
+            _mm256_store_si256(&v_dst[2u], v2);
+            _mm256_store_si256(&v_dst[3u], v3);
+            u8_src += (4u * sizeof(__m256i));
+            u8_dst += (4u * sizeof(__m256i));
+            size -= (4u * sizeof(__m256i));
+        }
+        while (size >= sizeof(__m256i))
+        {
+            _mm256_store_si256(reinterpret_cast<__m256i*>(u8_dst), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(u8_src)));
+            u8_src += sizeof(__m256i);
+            u8_dst += sizeof(__m256i);
+            size -= sizeof(__m256i);
+        }
+
+        // Head and tail vectors overlap the blocks
+        _mm256_storeu_si256(static_cast<__m256i*>(dst), v_head);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(u8_tail), v_tail);
+    }
+    else
+    {
+        NANO_STL_LIBC_SIMD_SSE2_Memcpy(dst, src, size);
+    }
+
+    return dst;
+}
+
+/** \brief AVX2 memcmp function */
+static int NANO_STL_LIBC_SIMD_AVX2_Memcmp(const void* const s1, const void* const s2, size_t size)
+{
+    int ret = 0;
+
+    if ((s1 != nullptr) && (s2 != nullptr) && (size >= sizeof(__m256i)))
+    {
+        const uint8_t* const u8_s1 = static_cast<const uint8_t*>(s1);
+        const uint8_t* const u8_s2 = static_cast<const uint8_t*>(s2);
+        size_t offset = 0u;
+        unsigned int mask = 0xFFFFFFFFu;
+
+        // Skip equal blocks of 2 vectors
+        while (((size - offset) >= (2u * sizeof(__m256i))) && (mask == 0xFFFFFFFFu))
+        {
+            const __m256i* const v_s1 = reinterpret_cast<const __m256i*>(u8_s1 + offset);
+            const __m256i* const v_s2 = reinterpret_cast<const __m256i*>(u8_s2 + offset);
+            const __m256i v_eq0 = _mm256_cmpeq_epi8(_mm256_loadu_si256(&v_s1[0u]), _mm256_loadu_si256(&v_s2[0u]));
+            const __m256i v_eq1 = _mm256_cmpeq_epi8(_mm256_loadu_si256(&v_s1[1u]), _mm256_loadu_si256(&v_s2[1u]));
+            mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_and_si256(v_eq0, v_eq1)));
+            if (mask == 0xFFFFFFFFu)
+            {
+                offset += (2u * sizeof(__m256i));
+            }
+        }
+
+        // Find the first different vector, the last one overlaps the previous ones
+        mask = 0xFFFFFFFFu;
+        while ((offset < size) && (mask == 0xFFFFFFFFu))
+        {
+            if ((size - offset) < sizeof(__m256i))
+            {
+                offset = size - sizeof(__m256i);
+            }
+            mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(u8_s1 + offset)),
+                                                                                     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(u8_s2 + offset)))));
+            if (mask == 0xFFFFFFFFu)
+            {
+                offset += sizeof(__m256i);
+            }
+        }
+        if (mask != 0xFFFFFFFFu)
+        {
+            ret = NANO_STL_LIBC_SIMD_ByteDiff(u8_s1, u8_s2, offset + static_cast<size_t>(__builtin_ctz(~mask)));
+        }
+    }
+    else
+    {
+        ret = NANO_STL_LIBC_SIMD_SSE2_Memcmp(s1, s2, size);
+    }
+
+    return ret;
+}
+
+/** \brief AVX2 strncmp function */
+static int NANO_STL_LIBC_SIMD_AVX2_Strncmp(const char* s1, const char* s2, size_t size)
+{
+    int ret = 0;
+
+    if ((s1 != nullptr) && (s2 != nullptr))
+    {
+        const __m256i v_zero = _mm256_setzero_si256();
+        size_t offset = 0u;
+        while (offset < size)
+        {
+            if (NANO_STL_LIBC_SIMD_IsPageSafe(s1 + offset, sizeof(__m256i)) && NANO_STL_LIBC_SIMD_IsPageSafe(s2 + offset, sizeof(__m256i)))
+            {
+                // Look for the first different or null char in the vector, the vectors may extend past the end of the strings
+                // but stay in the same page (the address sanitizer is disabled for this function)
+                const __m256i v_s1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s1 + offset));
+                const __m256i v_s2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s2 + offset));
+                const unsigned int eq_mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v_s1, v_s2)));
+                const unsigned int zero_mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v_s1, v_zero)));
+                const unsigned int stop_mask = ~eq_mask | zero_mask;
+                if (stop_mask != 0u)
+                {
+                    offset += static_cast<size_t>(__builtin_ctz(stop_mask));
+                    if (offset < size)
+                    {
+                        ret = NANO_STL_LIBC_SIMD_CharDiff(s1, s2, offset);
+                    }
+                    size = 0u;
+                }
+                else
+                {
+                    offset += sizeof(__m256i);
+                }
+            }
+            else
+            {
+                // Near a page boundary, compare a single char
+                ret = NANO_STL_LIBC_SIMD_CharDiff(s1, s2, offset);
+                if ((ret != 0) || (s1[offset] == 0))
+                {
+                    size = 0u;
+                }
+                offset++;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/** \brief AVX2 strnlen function */
+static size_t NANO_STL_LIBC_SIMD_AVX2_Strnlen(const char* s, size_t maxlen)
+{
+    size_t len = 0u;
+
+    if ((s != nullptr) && (maxlen != 0u))
+    {
+        // Aligned reads never cross a page boundary, the bytes before the string are discarded and the bytes
+        // after the null char are read but ignored (the address sanitizer is disabled for this function)
+        const __m256i v_zero = _mm256_setzero_si256();
+        const size_t misalignment = reinterpret_cast<uintptr_t>(s) & (sizeof(__m256i) - 1u);
+        const char* block = s - misalignment;
+        unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(block)), v_zero))) >> misalignment;
+        if (mask != 0u)
+        {
+            len = static_cast<size_t>(__builtin_ctz(mask));
+        }
+        else
+        {
+            len = sizeof(__m256i) - misalignment;
+            while ((len < maxlen) && (mask == 0u))
+            {
+                mask = static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_load_si256(reinterpret_cast<const __m256i*>(s + len)), v_zero)));
+                if (mask != 0u)
+                {
+                    len += static_cast<size_t>(__builtin_ctz(mask));
+                }
+                else
+                {
+                    len += sizeof(__m256i);
+                }
+            }
+        }
+        if (len > maxlen)
+        {
+            len = maxlen;
+        }
+    }
+
+    return len;
+}
+
+#endif // NANO_STL_LIBC_SIMD_BACKEND
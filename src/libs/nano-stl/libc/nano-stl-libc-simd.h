@@ -0,0 +1,86 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NANO_STL_LIBC_SIMD_H
+#define NANO_STL_LIBC_SIMD_H
+
+#include "nano-stl-libc.h"
+
+
+/** \brief The SIMD backend is only available with GCC compatible compilers on x86 CPUs */
+#if (NANO_STL_LIBC_SIMD_ENABLED == 1) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define NANO_STL_LIBC_SIMD_BACKEND      1
+#else
+#define NANO_STL_LIBC_SIMD_BACKEND      0
+#endif // NANO_STL_LIBC_SIMD_ENABLED
+
+
+/** \brief Attribute of the functions which intentionally read the bytes surrounding a buffer or a string
+ *         (without crossing a page boundary) and must not be instrumented by the address sanitizer */
+#if (defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)))) || defined(__clang__)
+#define NANO_STL_LIBC_NO_SANITIZE_ADDRESS   __attribute__((no_sanitize_address))
+#else
+#define NANO_STL_LIBC_NO_SANITIZE_ADDRESS
+#endif // __GNUC__
+
+
+/** \brief Name of the portable implementation of a lib C function
+ *         (the public name is owned by the SIMD backend dispatcher when it is available) */
+#if (NANO_STL_LIBC_SIMD_BACKEND == 1)
+#define NANO_STL_LIBC_PORTABLE(function)    NANO_STL_LIBC_Portable##function
+#else
+#define NANO_STL_LIBC_PORTABLE(function)    NANO_STL_LIBC_##function
+#endif // NANO_STL_LIBC_SIMD_BACKEND
+
+
+// Check if the SIMD backend is available
+#if (NANO_STL_LIBC_SIMD_BACKEND == 1)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif /* __cplusplus */
+
+
+/** \brief Portable memset function */
+void* NANO_STL_LIBC_PortableMemset(void* const dst, const int val, size_t size);
+
+/** \brief Portable memcpy function */
+void* NANO_STL_LIBC_PortableMemcpy(void* const dst, const void* const src, size_t size);
+
+/** \brief Portable memcmp function */
+int NANO_STL_LIBC_PortableMemcmp(const void* const s1, const void* const s2, size_t size);
+
+/** \brief Portable strncmp function */
+int NANO_STL_LIBC_PortableStrncmp(const char* s1, const char* s2, size_t size);
+
+/** \brief Portable strnlen function */
+size_t NANO_STL_LIBC_PortableStrnlen(const char* s, size_t maxlen);
+
+/** \brief Get the name of the instruction set selected by the SIMD backend for the current CPU ("avx2", "sse2" or "portable") */
+const char* NANO_STL_LIBC_SIMD_GetInstructionSet(void);
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif // NANO_STL_LIBC_SIMD_BACKEND
+
+#endif /* NANO_STL_LIBC_SIMD_H */
@@ -0,0 +1,627 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include "nano-stl-libc.h"
+#include "nano-stl-libc-dtoa.h"
+
+
+/** \brief Maximum number of decimal digits accumulated in the 64 bits significand (10^19 - 1 < 2^64) */
+#define NANO_STL_LIBC_STRTOD_MAX_DIGITS         19u
+
+/** \brief Largest significand which is exactly representable as a double */
+#define NANO_STL_LIBC_STRTOD_MAX_EXACT_INTEGER  (static_cast<uint64_t>(1u) << 53u)
+
+/** \brief Largest power of ten which is exactly representable as a double */
+#define NANO_STL_LIBC_STRTOD_MAX_EXACT_POWER    22
+
+/** \brief Saturation value of the parsed exponents (far beyond the range of the doubles) */
+#define NANO_STL_LIBC_STRTOD_EXPONENT_LIMIT     100000
+
+/** \brief IEEE 754 bits of the default quiet NaN */
+#define NANO_STL_LIBC_STRTOD_NAN_BITS           (static_cast<uint64_t>(0x7FF80000u) << 32u)
+
+
+/** \brief Get the first char of a string of the given size (0 if the string is empty) */
+static inline char NANO_STL_LIBC_STRTOD_Peek(const char* str, const size_t size);
+
+/** \brief Check if a string starts with the given lower case word (case insensitive), returns the length of the word or 0 */
+static size_t NANO_STL_LIBC_STRTOD_Match(const char* str, const size_t size, const char* word);
+
+/** \brief Compute the double closest to significand x 10^exponent, the digits being only read when the significand has been truncated 
+ *         (the decimal value of the digits is 0.d1d2...dn x 10^decimal_point) */
+static double NANO_STL_LIBC_STRTOD_Convert(const uint64_t significand, const int exponent, const bool truncated, 
+                                           const char* digits, const char* digits_end, const int decimal_point);
+
+// Check if the fast floating point parsing is enabled
+#if (NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED == 1)
+
+/** \brief Eisel-Lemire conversion of significand x 10^exponent, returns false when the truncated power of five cannot guarantee the correct rounding */
+static bool NANO_STL_LIBC_STRTOD_EiselLemire(uint64_t significand, const int exponent, double* value);
+
+/** \brief Compute the full 128 bits product of 2 64 bits values */
+static inline void NANO_STL_LIBC_STRTOD_Multiply(const uint64_t x, const uint64_t y, uint64_t* high, uint64_t* low);
+
+/** \brief Count the leading zero bits of a non null 64 bits value */
+static inline unsigned int NANO_STL_LIBC_STRTOD_CountLeadingZeros(uint64_t value);
+
+#endif // NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED
+
+
+/** \brief Powers of ten which are exactly representable as doubles */
+static const double s_exact_powers_of_10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 
+                                               1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+
+// Check if the fast floating point parsing is enabled
+#if (NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED == 1)
+
+/** \brief Decimal exponent of the first power of five and decimal exponent of the last one
+ *         (below and above, significand x 10^exponent is always rounded to 0 or to infinity) */
+#define NANO_STL_LIBC_STRTOD_MIN_EXPONENT       (-342)
+#define NANO_STL_LIBC_STRTOD_MAX_EXPONENT       308
+
+/** \brief 64 most significant bits of the normalized powers of five from 5^-342 to 5^308 
+ *         (the negative powers are the truncation of the reciprocals rounded up) */
+static const uint64_t s_powers_of_5[] = {
+    0xEEF453D6923BD65Au, 0x9558B4661B6565F8u, 0xBAAEE17FA23EBF76u, 0xE95A99DF8ACE6F53u,
+    0x91D8A02BB6C10594u, 0xB64EC836A47146F9u, 0xE3E27A444D8D98B7u, 0x8E6D8C6AB0787F72u,
+    0xB208EF855C969F4Fu, 0xDE8B2B66B3BC4723u, 0x8B16FB203055AC76u, 0xADDCB9E83C6B1793u,
+    0xD953E8624B85DD78u, 0x87D4713D6F33AA6Bu, 0xA9C98D8CCB009506u, 0xD43BF0EFFDC0BA48u,
+    0x84A57695FE98746Du, 0xA5CED43B7E3E9188u, 0xCF42894A5DCE35EAu, 0x818995CE7AA0E1B2u,
+    0xA1EBFB4219491A1Fu, 0xCA66FA129F9B60A6u, 0xFD00B897478238D0u, 0x9E20735E8CB16382u,
+    0xC5A890362FDDBC62u, 0xF712B443BBD52B7Bu, 0x9A6BB0AA55653B2Du, 0xC1069CD4EABE89F8u,
+    0xF148440A256E2C76u, 0x96CD2A865764DBCAu, 0xBC807527ED3E12BCu, 0xEBA09271E88D976Bu,
+    0x93445B8731587EA3u, 0xB8157268FDAE9E4Cu, 0xE61ACF033D1A45DFu, 0x8FD0C16206306BABu,
+    0xB3C4F1BA87BC8696u, 0xE0B62E2929ABA83Cu, 0x8C71DCD9BA0B4925u, 0xAF8E5410288E1B6Fu,
+    0xDB71E91432B1A24Au, 0x892731AC9FAF056Eu, 0xAB70FE17C79AC6CAu, 0xD64D3D9DB981787Du,
+    0x85F0468293F0EB4Eu, 0xA76C582338ED2621u, 0xD1476E2C07286FAAu, 0x82CCA4DB847945CAu,
+    0xA37FCE126597973Cu, 0xCC5FC196FEFD7D0Cu, 0xFF77B1FCBEBCDC4Fu, 0x9FAACF3DF73609B1u,
+    0xC795830D75038C1Du, 0xF97AE3D0D2446F25u, 0x9BECCE62836AC577u, 0xC2E801FB244576D5u,
+    0xF3A20279ED56D48Au, 0x9845418C345644D6u, 0xBE5691EF416BD60Cu, 0xEDEC366B11C6CB8Fu,
+    0x94B3A202EB1C3F39u, 0xB9E08A83A5E34F07u, 0xE858AD248F5C22C9u, 0x91376C36D99995BEu,
+    0xB58547448FFFFB2Du, 0xE2E69915B3FFF9F9u, 0x8DD01FAD907FFC3Bu, 0xB1442798F49FFB4Au,
+    0xDD95317F31C7FA1Du, 0x8A7D3EEF7F1CFC52u, 0xAD1C8EAB5EE43B66u, 0xD863B256369D4A40u,
+    0x873E4F75E2224E68u, 0xA90DE3535AAAE202u, 0xD3515C2831559A83u, 0x8412D9991ED58091u,
+    0xA5178FFF668AE0B6u, 0xCE5D73FF402D98E3u, 0x80FA687F881C7F8Eu, 0xA139029F6A239F72u,
+    0xC987434744AC874Eu, 0xFBE9141915D7A922u, 0x9D71AC8FADA6C9B5u, 0xC4CE17B399107C22u,
+    0xF6019DA07F549B2Bu, 0x99C102844F94E0FBu, 0xC0314325637A1939u, 0xF03D93EEBC589F88u,
+    0x96267C7535B763B5u, 0xBBB01B9283253CA2u, 0xEA9C227723EE8BCBu, 0x92A1958A7675175Fu,
+    0xB749FAED14125D36u, 0xE51C79A85916F484u, 0x8F31CC0937AE58D2u, 0xB2FE3F0B8599EF07u,
+    0xDFBDCECE67006AC9u, 0x8BD6A141006042BDu, 0xAECC49914078536Du, 0xDA7F5BF590966848u,
+    0x888F99797A5E012Du, 0xAAB37FD7D8F58178u, 0xD5605FCDCF32E1D6u, 0x855C3BE0A17FCD26u,
+    0xA6B34AD8C9DFC06Fu, 0xD0601D8EFC57B08Bu, 0x823C12795DB6CE57u, 0xA2CB1717B52481EDu,
+    0xCB7DDCDDA26DA268u, 0xFE5D54150B090B02u, 0x9EFA548D26E5A6E1u, 0xC6B8E9B0709F109Au,
+    0xF867241C8CC6D4C0u, 0x9B407691D7FC44F8u, 0xC21094364DFB5636u, 0xF294B943E17A2BC4u,
+    0x979CF3CA6CEC5B5Au, 0xBD8430BD08277231u, 0xECE53CEC4A314EBDu, 0x940F4613AE5ED136u,
+    0xB913179899F68584u, 0xE757DD7EC07426E5u, 0x9096EA6F3848984Fu, 0xB4BCA50B065ABE63u,
+    0xE1EBCE4DC7F16DFBu, 0x8D3360F09CF6E4BDu, 0xB080392CC4349DECu, 0xDCA04777F541C567u,
+    0x89E42CAAF9491B60u, 0xAC5D37D5B79B6239u, 0xD77485CB25823AC7u, 0x86A8D39EF77164BCu,
+    0xA8530886B54DBDEBu, 0xD267CAA862A12D66u, 0x8380DEA93DA4BC60u, 0xA46116538D0DEB78u,
+    0xCD795BE870516656u, 0x806BD9714632DFF6u, 0xA086CFCD97BF97F3u, 0xC8A883C0FDAF7DF0u,
+    0xFAD2A4B13D1B5D6Cu, 0x9CC3A6EEC6311A63u, 0xC3F490AA77BD60FCu, 0xF4F1B4D515ACB93Bu,
+    0x991711052D8BF3C5u, 0xBF5CD54678EEF0B6u, 0xEF340A98172AACE4u, 0x9580869F0E7AAC0Eu,
+    0xBAE0A846D2195712u, 0xE998D258869FACD7u, 0x91FF83775423CC06u, 0xB67F6455292CBF08u,
+    0xE41F3D6A7377EECAu, 0x8E938662882AF53Eu, 0xB23867FB2A35B28Du, 0xDEC681F9F4C31F31u,
+    0x8B3C113C38F9F37Eu, 0xAE0B158B4738705Eu, 0xD98DDAEE19068C76u, 0x87F8A8D4CFA417C9u,
+    0xA9F6D30A038D1DBCu, 0xD47487CC8470652Bu, 0x84C8D4DFD2C63F3Bu, 0xA5FB0A17C777CF09u,
+    0xCF79CC9DB955C2CCu, 0x81AC1FE293D599BFu, 0xA21727DB38CB002Fu, 0xCA9CF1D206FDC03Bu,
+    0xFD442E4688BD304Au, 0x9E4A9CEC15763E2Eu, 0xC5DD44271AD3CDBAu, 0xF7549530E188C128u,
+    0x9A94DD3E8CF578B9u, 0xC13A148E3032D6E7u, 0xF18899B1BC3F8CA1u, 0x96F5600F15A7B7E5u,
+    0xBCB2B812DB11A5DEu, 0xEBDF661791D60F56u, 0x936B9FCEBB25C995u, 0xB84687C269EF3BFBu,
+    0xE65829B3046B0AFAu, 0x8FF71A0FE2C2E6DCu, 0xB3F4E093DB73A093u, 0xE0F218B8D25088B8u,
+    0x8C974F7383725573u, 0xAFBD2350644EEACFu, 0xDBAC6C247D62A583u, 0x894BC396CE5DA772u,
+    0xAB9EB47C81F5114Fu, 0xD686619BA27255A2u, 0x8613FD0145877585u, 0xA798FC4196E952E7u,
+    0xD17F3B51FCA3A7A0u, 0x82EF85133DE648C4u, 0xA3AB66580D5FDAF5u, 0xCC963FEE10B7D1B3u,
+    0xFFBBCFE994E5C61Fu, 0x9FD561F1FD0F9BD3u, 0xC7CABA6E7C5382C8u, 0xF9BD690A1B68637Bu,
+    0x9C1661A651213E2Du, 0xC31BFA0FE5698DB8u, 0xF3E2F893DEC3F126u, 0x986DDB5C6B3A76B7u,
+    0xBE89523386091465u, 0xEE2BA6C0678B597Fu, 0x94DB483840B717EFu, 0xBA121A4650E4DDEBu,
+    0xE896A0D7E51E1566u, 0x915E2486EF32CD60u, 0xB5B5ADA8AAFF80B8u, 0xE3231912D5BF60E6u,
+    0x8DF5EFABC5979C8Fu, 0xB1736B96B6FD83B3u, 0xDDD0467C64BCE4A0u, 0x8AA22C0DBEF60EE4u,
+    0xAD4AB7112EB3929Du, 0xD89D64D57A607744u, 0x87625F056C7C4A8Bu, 0xA93AF6C6C79B5D2Du,
+    0xD389B47879823479u, 0x843610CB4BF160CBu, 0xA54394FE1EEDB8FEu, 0xCE947A3DA6A9273Eu,
+    0x811CCC668829B887u, 0xA163FF802A3426A8u, 0xC9BCFF6034C13052u, 0xFC2C3F3841F17C67u,
+    0x9D9BA7832936EDC0u, 0xC5029163F384A931u, 0xF64335BCF065D37Du, 0x99EA0196163FA42Eu,
+    0xC06481FB9BCF8D39u, 0xF07DA27A82C37088u, 0x964E858C91BA2655u, 0xBBE226EFB628AFEAu,
+    0xEADAB0ABA3B2DBE5u, 0x92C8AE6B464FC96Fu, 0xB77ADA0617E3BBCBu, 0xE55990879DDCAABDu,
+    0x8F57FA54C2A9EAB6u, 0xB32DF8E9F3546564u, 0xDFF9772470297EBDu, 0x8BFBEA76C619EF36u,
+    0xAEFAE51477A06B03u, 0xDAB99E59958885C4u, 0x88B402F7FD75539Bu, 0xAAE103B5FCD2A881u,
+    0xD59944A37C0752A2u, 0x857FCAE62D8493A5u, 0xA6DFBD9FB8E5B88Eu, 0xD097AD07A71F26B2u,
+    0x825ECC24C873782Fu, 0xA2F67F2DFA90563Bu, 0xCBB41EF979346BCAu, 0xFEA126B7D78186BCu,
+    0x9F24B832E6B0F436u, 0xC6EDE63FA05D3143u, 0xF8A95FCF88747D94u, 0x9B69DBE1B548CE7Cu,
+    0xC24452DA229B021Bu, 0xF2D56790AB41C2A2u, 0x97C560BA6B0919A5u, 0xBDB6B8E905CB600Fu,
+    0xED246723473E3813u, 0x9436C0760C86E30Bu, 0xB94470938FA89BCEu, 0xE7958CB87392C2C2u,
+    0x90BD77F3483BB9B9u, 0xB4ECD5F01A4AA828u, 0xE2280B6C20DD5232u, 0x8D590723948A535Fu,
+    0xB0AF48EC79ACE837u, 0xDCDB1B2798182244u, 0x8A08F0F8BF0F156Bu, 0xAC8B2D36EED2DAC5u,
+    0xD7ADF884AA879177u, 0x86CCBB52EA94BAEAu, 0xA87FEA27A539E9A5u, 0xD29FE4B18E88640Eu,
+    0x83A3EEEEF9153E89u, 0xA48CEAAAB75A8E2Bu, 0xCDB02555653131B6u, 0x808E17555F3EBF11u,
+    0xA0B19D2AB70E6ED6u, 0xC8DE047564D20A8Bu, 0xFB158592BE068D2Eu, 0x9CED737BB6C4183Du,
+    0xC428D05AA4751E4Cu, 0xF53304714D9265DFu, 0x993FE2C6D07B7FABu, 0xBF8FDB78849A5F96u,
+    0xEF73D256A5C0F77Cu, 0x95A8637627989AADu, 0xBB127C53B17EC159u, 0xE9D71B689DDE71AFu,
+    0x9226712162AB070Du, 0xB6B00D69BB55C8D1u, 0xE45C10C42A2B3B05u, 0x8EB98A7A9A5B04E3u,
+    0xB267ED1940F1C61Cu, 0xDF01E85F912E37A3u, 0x8B61313BBABCE2C6u, 0xAE397D8AA96C1B77u,
+    0xD9C7DCED53C72255u, 0x881CEA14545C7575u, 0xAA242499697392D2u, 0xD4AD2DBFC3D07787u,
+    0x84EC3C97DA624AB4u, 0xA6274BBDD0FADD61u, 0xCFB11EAD453994BAu, 0x81CEB32C4B43FCF4u,
+    0xA2425FF75E14FC31u, 0xCAD2F7F5359A3B3Eu, 0xFD87B5F28300CA0Du, 0x9E74D1B791E07E48u,
+    0xC612062576589DDAu, 0xF79687AED3EEC551u, 0x9ABE14CD44753B52u, 0xC16D9A0095928A27u,
+    0xF1C90080BAF72CB1u, 0x971DA05074DA7BEEu, 0xBCE5086492111AEAu, 0xEC1E4A7DB69561A5u,
+    0x9392EE8E921D5D07u, 0xB877AA3236A4B449u, 0xE69594BEC44DE15Bu, 0x901D7CF73AB0ACD9u,
+    0xB424DC35095CD80Fu, 0xE12E13424BB40E13u, 0x8CBCCC096F5088CBu, 0xAFEBFF0BCB24AAFEu,
+    0xDBE6FECEBDEDD5BEu, 0x89705F4136B4A597u, 0xABCC77118461CEFCu, 0xD6BF94D5E57A42BCu,
+    0x8637BD05AF6C69B5u, 0xA7C5AC471B478423u, 0xD1B71758E219652Bu, 0x83126E978D4FDF3Bu,
+    0xA3D70A3D70A3D70Au, 0xCCCCCCCCCCCCCCCCu, 0x8000000000000000u, 0xA000000000000000u,
+    0xC800000000000000u, 0xFA00000000000000u, 0x9C40000000000000u, 0xC350000000000000u,
+    0xF424000000000000u, 0x9896800000000000u, 0xBEBC200000000000u, 0xEE6B280000000000u,
+    0x9502F90000000000u, 0xBA43B74000000000u, 0xE8D4A51000000000u, 0x9184E72A00000000u,
+    0xB5E620F480000000u, 0xE35FA931A0000000u, 0x8E1BC9BF04000000u, 0xB1A2BC2EC5000000u,
+    0xDE0B6B3A76400000u, 0x8AC7230489E80000u, 0xAD78EBC5AC620000u, 0xD8D726B7177A8000u,
+    0x878678326EAC9000u, 0xA968163F0A57B400u, 0xD3C21BCECCEDA100u, 0x84595161401484A0u,
+    0xA56FA5B99019A5C8u, 0xCECB8F27F4200F3Au, 0x813F3978F8940984u, 0xA18F07D736B90BE5u,
+    0xC9F2C9CD04674EDEu, 0xFC6F7C4045812296u, 0x9DC5ADA82B70B59Du, 0xC5371912364CE305u,
+    0xF684DF56C3E01BC6u, 0x9A130B963A6C115Cu, 0xC097CE7BC90715B3u, 0xF0BDC21ABB48DB20u,
+    0x96769950B50D88F4u, 0xBC143FA4E250EB31u, 0xEB194F8E1AE525FDu, 0x92EFD1B8D0CF37BEu,
+    0xB7ABC627050305ADu, 0xE596B7B0C643C719u, 0x8F7E32CE7BEA5C6Fu, 0xB35DBF821AE4F38Bu,
+    0xE0352F62A19E306Eu, 0x8C213D9DA502DE45u, 0xAF298D050E4395D6u, 0xDAF3F04651D47B4Cu,
+    0x88D8762BF324CD0Fu, 0xAB0E93B6EFEE0053u, 0xD5D238A4ABE98068u, 0x85A36366EB71F041u,
+    0xA70C3C40A64E6C51u, 0xD0CF4B50CFE20765u, 0x82818F1281ED449Fu, 0xA321F2D7226895C7u,
+    0xCBEA6F8CEB02BB39u, 0xFEE50B7025C36A08u, 0x9F4F2726179A2245u, 0xC722F0EF9D80AAD6u,
+    0xF8EBAD2B84E0D58Bu, 0x9B934C3B330C8577u, 0xC2781F49FFCFA6D5u, 0xF316271C7FC3908Au,
+    0x97EDD871CFDA3A56u, 0xBDE94E8E43D0C8ECu, 0xED63A231D4C4FB27u, 0x945E455F24FB1CF8u,
+    0xB975D6B6EE39E436u, 0xE7D34C64A9C85D44u, 0x90E40FBEEA1D3A4Au, 0xB51D13AEA4A488DDu,
+    0xE264589A4DCDAB14u, 0x8D7EB76070A08AECu, 0xB0DE65388CC8ADA8u, 0xDD15FE86AFFAD912u,
+    0x8A2DBF142DFCC7ABu, 0xACB92ED9397BF996u, 0xD7E77A8F87DAF7FBu, 0x86F0AC99B4E8DAFDu,
+    0xA8ACD7C0222311BCu, 0xD2D80DB02AABD62Bu, 0x83C7088E1AAB65DBu, 0xA4B8CAB1A1563F52u,
+    0xCDE6FD5E09ABCF26u, 0x80B05E5AC60B6178u, 0xA0DC75F1778E39D6u, 0xC913936DD571C84Cu,
+    0xFB5878494ACE3A5Fu, 0x9D174B2DCEC0E47Bu, 0xC45D1DF942711D9Au, 0xF5746577930D6500u,
+    0x9968BF6ABBE85F20u, 0xBFC2EF456AE276E8u, 0xEFB3AB16C59B14A2u, 0x95D04AEE3B80ECE5u,
+    0xBB445DA9CA61281Fu, 0xEA1575143CF97226u, 0x924D692CA61BE758u, 0xB6E0C377CFA2E12Eu,
+    0xE498F455C38B997Au, 0x8EDF98B59A373FECu, 0xB2977EE300C50FE7u, 0xDF3D5E9BC0F653E1u,
+    0x8B865B215899F46Cu, 0xAE67F1E9AEC07187u, 0xDA01EE641A708DE9u, 0x884134FE908658B2u,
+    0xAA51823E34A7EEDEu, 0xD4E5E2CDC1D1EA96u, 0x850FADC09923329Eu, 0xA6539930BF6BFF45u,
+    0xCFE87F7CEF46FF16u, 0x81F14FAE158C5F6Eu, 0xA26DA3999AEF7749u, 0xCB090C8001AB551Cu,
+    0xFDCB4FA002162A63u, 0x9E9F11C4014DDA7Eu, 0xC646D63501A1511Du, 0xF7D88BC24209A565u,
+    0x9AE757596946075Fu, 0xC1A12D2FC3978937u, 0xF209787BB47D6B84u, 0x9745EB4D50CE6332u,
+    0xBD176620A501FBFFu, 0xEC5D3FA8CE427AFFu, 0x93BA47C980E98CDFu, 0xB8A8D9BBE123F017u,
+    0xE6D3102AD96CEC1Du, 0x9043EA1AC7E41392u, 0xB454E4A179DD1877u, 0xE16A1DC9D8545E94u,
+    0x8CE2529E2734BB1Du, 0xB01AE745B101E9E4u, 0xDC21A1171D42645Du, 0x899504AE72497EBAu,
+    0xABFA45DA0EDBDE69u, 0xD6F8D7509292D603u, 0x865B86925B9BC5C2u, 0xA7F26836F282B732u,
+    0xD1EF0244AF2364FFu, 0x8335616AED761F1Fu, 0xA402B9C5A8D3A6E7u, 0xCD036837130890A1u,
+    0x802221226BE55A64u, 0xA02AA96B06DEB0FDu, 0xC83553C5C8965D3Du, 0xFA42A8B73ABBF48Cu,
+    0x9C69A97284B578D7u, 0xC38413CF25E2D70Du, 0xF46518C2EF5B8CD1u, 0x98BF2F79D5993802u,
+    0xBEEEFB584AFF8603u, 0xEEAABA2E5DBF6784u, 0x952AB45CFA97A0B2u, 0xBA756174393D88DFu,
+    0xE912B9D1478CEB17u, 0x91ABB422CCB812EEu, 0xB616A12B7FE617AAu, 0xE39C49765FDF9D94u,
+    0x8E41ADE9FBEBC27Du, 0xB1D219647AE6B31Cu, 0xDE469FBD99A05FE3u, 0x8AEC23D680043BEEu,
+    0xADA72CCC20054AE9u, 0xD910F7FF28069DA4u, 0x87AA9AFF79042286u, 0xA99541BF57452B28u,
+    0xD3FA922F2D1675F2u, 0x847C9B5D7C2E09B7u, 0xA59BC234DB398C25u, 0xCF02B2C21207EF2Eu,
+    0x8161AFB94B44F57Du, 0xA1BA1BA79E1632DCu, 0xCA28A291859BBF93u, 0xFCB2CB35E702AF78u,
+    0x9DEFBF01B061ADABu, 0xC56BAEC21C7A1916u, 0xF6C69A72A3989F5Bu, 0x9A3C2087A63F6399u,
+    0xC0CB28A98FCF3C7Fu, 0xF0FDF2D3F3C30B9Fu, 0x969EB7C47859E743u, 0xBC4665B596706114u,
+    0xEB57FF22FC0C7959u, 0x9316FF75DD87CBD8u, 0xB7DCBF5354E9BECEu, 0xE5D3EF282A242E81u,
+    0x8FA475791A569D10u, 0xB38D92D760EC4455u, 0xE070F78D3927556Au, 0x8C469AB843B89562u,
+    0xAF58416654A6BABBu, 0xDB2E51BFE9D0696Au, 0x88FCF317F22241E2u, 0xAB3C2FDDEEAAD25Au,
+    0xD60B3BD56A5586F1u, 0x85C7056562757456u, 0xA738C6BEBB12D16Cu, 0xD106F86E69D785C7u,
+    0x82A45B450226B39Cu, 0xA34D721642B06084u, 0xCC20CE9BD35C78A5u, 0xFF290242C83396CEu,
+    0x9F79A169BD203E41u, 0xC75809C42C684DD1u, 0xF92E0C3537826145u, 0x9BBCC7A142B17CCBu,
+    0xC2ABF989935DDBFEu, 0xF356F7EBF83552FEu, 0x98165AF37B2153DEu, 0xBE1BF1B059E9A8D6u,
+    0xEDA2EE1C7064130Cu, 0x9485D4D1C63E8BE7u, 0xB9A74A0637CE2EE1u, 0xE8111C87C5C1BA99u,
+    0x910AB1D4DB9914A0u, 0xB54D5E4A127F59C8u, 0xE2A0B5DC971F303Au, 0x8DA471A9DE737E24u,
+    0xB10D8E1456105DADu, 0xDD50F1996B947518u, 0x8A5296FFE33CC92Fu, 0xACE73CBFDC0BFB7Bu,
+    0xD8210BEFD30EFA5Au, 0x8714A775E3E95C78u, 0xA8D9D1535CE3B396u, 0xD31045A8341CA07Cu,
+    0x83EA2B892091E44Du, 0xA4E4B66B68B65D60u, 0xCE1DE40642E3F4B9u, 0x80D2AE83E9CE78F3u,
+    0xA1075A24E4421730u, 0xC94930AE1D529CFCu, 0xFB9B7CD9A4A7443Cu, 0x9D412E0806E88AA5u,
+    0xC491798A08A2AD4Eu, 0xF5B5D7EC8ACB58A2u, 0x9991A6F3D6BF1765u, 0xBFF610B0CC6EDD3Fu,
+    0xEFF394DCFF8A948Eu, 0x95F83D0A1FB69CD9u, 0xBB764C4CA7A4440Fu, 0xEA53DF5FD18D5513u,
+    0x92746B9BE2F8552Cu, 0xB7118682DBB66A77u, 0xE4D5E82392A40515u, 0x8F05B1163BA6832Du,
+    0xB2C71D5BCA9023F8u, 0xDF78E4B2BD342CF6u, 0x8BAB8EEFB6409C1Au, 0xAE9672ABA3D0C320u,
+    0xDA3C0F568CC4F3E8u, 0x8865899617FB1871u, 0xAA7EEBFB9DF9DE8Du, 0xD51EA6FA85785631u,
+    0x8533285C936B35DEu, 0xA67FF273B8460356u, 0xD01FEF10A657842Cu, 0x8213F56A67F6B29Bu,
+    0xA298F2C501F45F42u, 0xCB3F2F7642717713u, 0xFE0EFB53D30DD4D7u, 0x9EC95D1463E8A506u,
+    0xC67BB4597CE2CE48u, 0xF81AA16FDC1B81DAu, 0x9B10A4E5E9913128u, 0xC1D4CE1F63F57D72u,
+    0xF24A01A73CF2DCCFu, 0x976E41088617CA01u, 0xBD49D14AA79DBC82u, 0xEC9C459D51852BA2u,
+    0x93E1AB8252F33B45u, 0xB8DA1662E7B00A17u, 0xE7109BFBA19C0C9Du, 0x906A617D450187E2u,
+    0xB484F9DC9641E9DAu, 0xE1A63853BBD26451u, 0x8D07E33455637EB2u, 0xB049DC016ABC5E5Fu,
+    0xDC5C5301C56B75F7u, 0x89B9B3E11B6329BAu, 0xAC2820D9623BF429u, 0xD732290FBACAF133u,
+    0x867F59A9D4BED6C0u, 0xA81F301449EE8C70u, 0xD226FC195C6A2F8Cu, 0x83585D8FD9C25DB7u,
+    0xA42E74F3D032F525u, 0xCD3A1230C43FB26Fu, 0x80444B5E7AA7CF85u, 0xA0555E361951C366u,
+    0xC86AB5C39FA63440u, 0xFA856334878FC150u, 0x9C935E00D4B9D8D2u, 0xC3B8358109E84F07u,
+    0xF4A642E14C6262C8u, 0x98E7E9CCCFBD7DBDu, 0xBF21E44003ACDD2Cu, 0xEEEA5D5004981478u,
+    0x95527A5202DF0CCBu, 0xBAA718E68396CFFDu, 0xE950DF20247C83FDu, 0x91D28B7416CDD27Eu,
+    0xB6472E511C81471Du, 0xE3D8F9E563A198E5u, 0x8E679C2F5E44FF8Fu };
+
+#endif // NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED
+
+
+
+/** \brief Highly portable atof function (correctly rounded, Eisel-Lemire if NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED) */
+double NANO_STL_LIBC_Atof(const char* nptr)
+{
+    return NANO_STL_LIBC_Antof(nptr, static_cast<size_t>(-1), nullptr);
+}
+
+/** \brief Highly portable strtod like function with string length check (correctly rounded, Eisel-Lemire if NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED) */
+double NANO_STL_LIBC_Antof(const char* str, size_t size, const char** end)
+{
+    double value = 0.;
+    const char* stop = str;
+
+    if (str != nullptr)
+    {
+        const char* const begin = str;
+        bool negative = false;
+        char c = NANO_STL_LIBC_STRTOD_Peek(str, size);
+        if ((c == '-') || (c == '+'))
+        {
+            negative = (c == '-');
+            str++;
+            size--;
+        }
+
+        /* The first significant digits are accumulated in the significand, the following ones only move the decimal exponent */
+        const char* first_digit = nullptr;
+        uint64_t significand = 0u;
+        unsigned int significand_digits = 0u;
+        int exponent = 0;
+        int decimal_point = 0;
+        bool has_digits = false;
+        bool fraction = false;
+        bool truncated = false;
+        bool done = false;
+        while (!done)
+        {
+            c = NANO_STL_LIBC_STRTOD_Peek(str, size);
+            if ((c >= '0') && (c <= '9'))
+            {
+                const unsigned int digit = static_cast<unsigned int>(c - '0');
+                if ((first_digit == nullptr) && (digit != 0u))
+                {
+                    first_digit = str;
+                }
+                if (first_digit != nullptr)
+                {
+                    if (significand_digits < NANO_STL_LIBC_STRTOD_MAX_DIGITS)
+                    {
+                        significand = (significand * 10u) + digit;
+                        significand_digits++;
+                        exponent -= (fraction ? 1 : 0);
+                    }
+                    else
+                    {
+                        truncated = (truncated || (digit != 0u));
+                        exponent += (fraction ? 0 : 1);
+                    }
+                    decimal_point += (fraction ? 0 : 1);
+                }
+                else if (fraction)
+                {
+                    /* Leading zeros of the fractional part */
+                    exponent--;
+                    decimal_point--;
+                }
+                else
+                {}
+                has_digits = true;
+                str++;
+                size--;
+            }
+            else if ((c == '.') && !fraction)
+            {
+                fraction = true;
+                str++;
+                size--;
+            }
+            else
+            {
+                done = true;
+            }
+        }
+
+        if (has_digits)
+        {
+            const char* const digits_end = str;
+
+            /* The exponent is only consumed if it contains at least one digit */
+            c = NANO_STL_LIBC_STRTOD_Peek(str, size);
+            if ((c == 'e') || (c == 'E'))
+            {
+                const char* exponent_str = (str + 1u);
+                size_t exponent_size = (size - 1u);
+                bool negative_exponent = false;
+                c = NANO_STL_LIBC_STRTOD_Peek(exponent_str, exponent_size);
+                if ((c == '-') || (c == '+'))
+                {
+                    negative_exponent = (c == '-');
+                    exponent_str++;
+                    exponent_size--;
+                    c = NANO_STL_LIBC_STRTOD_Peek(exponent_str, exponent_size);
+                }
+                if ((c >= '0') && (c <= '9'))
+                {
+                    int exponent_value = 0;
+                    while ((c >= '0') && (c <= '9'))
+                    {
+                        if (exponent_value < NANO_STL_LIBC_STRTOD_EXPONENT_LIMIT)
+                        {
+                            exponent_value = (exponent_value * 10) + (c - '0');
+                        }
+                        exponent_str++;
+                        exponent_size--;
+                        c = NANO_STL_LIBC_STRTOD_Peek(exponent_str, exponent_size);
+                    }
+                    if (negative_exponent)
+                    {
+                        exponent_value = -exponent_value;
+                    }
+                    exponent += exponent_value;
+                    decimal_point += exponent_value;
+                    str = exponent_str;
+                }
+            }
+            stop = str;
+
+            if (first_digit != nullptr)
+            {
+                value = NANO_STL_LIBC_STRTOD_Convert(significand, exponent, truncated, first_digit, digits_end, decimal_point);
+            }
+        }
+        else
+        {
+            /* Special values */
+            size_t length = NANO_STL_LIBC_STRTOD_Match(str, size, "infinity");
+            if (length == 0u)
+            {
+                length = NANO_STL_LIBC_STRTOD_Match(str, size, "inf");
+            }
+            if (length != 0u)
+            {
+                value = NANO_STL_LIBC_DTOA_FromBits(NANO_STL_LIBC_DTOA_INFINITY_BITS);
+            }
+            else
+            {
+                length = NANO_STL_LIBC_STRTOD_Match(str, size, "nan");
+                if (length != 0u)
+                {
+                    value = NANO_STL_LIBC_DTOA_FromBits(NANO_STL_LIBC_STRTOD_NAN_BITS);
+                }
+            }
+            if (length != 0u)
+            {
+                stop = (str + length);
+            }
+        }
+
+        /* The sign alone is not a number */
+        if (negative && (stop != begin))
+        {
+            value = -value;
+        }
+    }
+    if (end != nullptr)
+    {
+        (*end) = stop;
+    }
+
+    return value;
+}
+
+
+
+/** \brief Get the first char of a string of the given size (0 if the string is empty) */
+static inline char NANO_STL_LIBC_STRTOD_Peek(const char* str, const size_t size)
+{
+    return ((size != 0u) ? (*str) : 0);
+}
+
+/** \brief Check if a string starts with the given lower case word (case insensitive), returns the length of the word or 0 */
+static size_t NANO_STL_LIBC_STRTOD_Match(const char* str, const size_t size, const char* word)
+{
+    size_t length = 0u;
+    while ((word[length] != 0) && (length < size) && ((str[length] | 0x20) == word[length]))
+    {
+        length++;
+    }
+    return ((word[length] == 0) ? length : 0u);
+}
+
+/** \brief Compute the double closest to significand x 10^exponent, the digits being only read when the significand has been truncated */
+static double NANO_STL_LIBC_STRTOD_Convert(const uint64_t significand, const int exponent, const bool truncated, 
+                                           const char* digits, const char* digits_end, const int decimal_point)
+{
+    double value = 0.;
+    bool done = false;
+
+    /* Clinger's fast path: the significand and the power of ten are exact doubles so the result is correctly rounded by the FPU */
+    if (!truncated && (significand <= NANO_STL_LIBC_STRTOD_MAX_EXACT_INTEGER) && 
+        (exponent >= -NANO_STL_LIBC_STRTOD_MAX_EXACT_POWER) && (exponent <= NANO_STL_LIBC_STRTOD_MAX_EXACT_POWER))
+    {
+        value = static_cast<double>(significand);
+        if (exponent >= 0)
+        {
+            value *= s_exact_powers_of_10[exponent];
+        }
+        else
+        {
+            value /= s_exact_powers_of_10[-exponent];
+        }
+        done = true;
+    }
+
+// Check if the fast floating point parsing is enabled
+#if (NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED == 1)
+
+    if (!done)
+    {
+        /* When the significand has been truncated, the result is known only if the next significand gives the same double */
+        done = NANO_STL_LIBC_STRTOD_EiselLemire(significand, exponent, &value);
+        if (done && truncated)
+        {
+            double upper_value;
+            done = (NANO_STL_LIBC_STRTOD_EiselLemire(significand + 1u, exponent, &upper_value) && 
+                    (NANO_STL_LIBC_DTOA_GetBits(upper_value) == NANO_STL_LIBC_DTOA_GetBits(value)));
+        }
+    }
+
+#endif // NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED
+
+    if (!done)
+    {
+        /* Exact conversion, the truncated digits can only move the result up to the next double */
+        value = NANO_STL_LIBC_DTOA_ScalePow10(significand, exponent);
+        const uint64_t bits = NANO_STL_LIBC_DTOA_GetBits(value);
+        if (truncated && (bits != NANO_STL_LIBC_DTOA_INFINITY_BITS))
+        {
+            const int compare = NANO_STL_LIBC_DTOA_CompareHalfway(value, digits, digits_end, decimal_point);
+            if ((compare > 0) || ((compare == 0) && ((bits & 1u) != 0u)))
+            {
+                value = NANO_STL_LIBC_DTOA_FromBits(bits + 1u);
+            }
+        }
+    }
+
+    return value;
+}
+
+// Check if the fast floating point parsing is enabled
+#if (NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED == 1)
+
+/** \brief Eisel-Lemire conversion of significand x 10^exponent, returns false when the truncated power of five cannot guarantee the correct rounding */
+static bool NANO_STL_LIBC_STRTOD_EiselLemire(uint64_t significand, const int exponent, double* value)
+{
+    bool ret = true;
+    uint64_t bits = 0u;
+
+    if (exponent > NANO_STL_LIBC_STRTOD_MAX_EXPONENT)
+    {
+        bits = NANO_STL_LIBC_DTOA_INFINITY_BITS;
+    }
+    else if (exponent >= NANO_STL_LIBC_STRTOD_MIN_EXPONENT)
+    {
+        /* Multiply the normalized significand by the normalized power of five */
+        const unsigned int leading_zeros = NANO_STL_LIBC_STRTOD_CountLeadingZeros(significand);
+        uint64_t high;
+        uint64_t low;
+        significand <<= leading_zeros;
+        NANO_STL_LIBC_STRTOD_Multiply(significand, s_powers_of_5[exponent - NANO_STL_LIBC_STRTOD_MIN_EXPONENT], &high, &low);
+
+        /* The missing low bits of the power of five can only change the 55 most significant bits of the product 
+           if the 9 bits below them are all set */
+        if ((high & 0x1FFu) == 0x1FFu)
+        {
+            ret = false;
+        }
+        else
+        {
+            /* Keep 54 bits (53 bits of significand and a rounding bit), floor(exponent x log2(10)) being computed in fixed point */
+            const unsigned int upper_bit = static_cast<unsigned int>(high >> 63u);
+            const unsigned int shift = upper_bit + 9u;
+            const int product = exponent * 217706;
+            const int binary_exponent = ((product >= 0) ? (product / 65536) : -((65535 - product) / 65536));
+            int biased_exponent = binary_exponent + 63 + static_cast<int>(upper_bit) - static_cast<int>(leading_zeros) + 0x3FF;
+            uint64_t mantissa = (high >> shift);
+
+            if (biased_exponent <= 0)
+            {
+                /* Denormalized result, a rounding up to 2^52 naturally gives the smallest normalized double */
+                if ((1 - biased_exponent) < 64)
+                {
+                    mantissa >>= static_cast<unsigned int>(1 - biased_exponent);
+                    mantissa += (mantissa & 1u);
+                    bits = (mantissa >> 1u);
+                }
+            }
+            else
+            {
+                /* Exact ties between 2 doubles can only happen for small exponents, they are rounded to even */
+                if ((low <= 1u) && (exponent >= -4) && (exponent <= 23) && ((mantissa & 3u) == 1u) && ((mantissa << shift) == high))
+                {
+                    mantissa &= ~static_cast<uint64_t>(1u);
+                }
+                mantissa += (mantissa & 1u);
+                mantissa >>= 1u;
+                if (mantissa >= (static_cast<uint64_t>(2u) << 52u))
+                {
+                    mantissa = (static_cast<uint64_t>(1u) << 52u);
+                    biased_exponent++;
+                }
+                if (biased_exponent >= 0x7FF)
+                {
+                    bits = NANO_STL_LIBC_DTOA_INFINITY_BITS;
+                }
+                else
+                {
+                    bits = (mantissa & ~(static_cast<uint64_t>(1u) << 52u)) | (static_cast<uint64_t>(biased_exponent) << 52u);
+                }
+            }
+        }
+    }
+    else
+    {}
+    (*value) = NANO_STL_LIBC_DTOA_FromBits(bits);
+
+    return ret;
+}
+
+/** \brief Compute the full 128 bits product of 2 64 bits values */
+static inline void NANO_STL_LIBC_STRTOD_Multiply(const uint64_t x, const uint64_t y, uint64_t* high, uint64_t* low)
+{
+#if defined(__SIZEOF_INT128__)
+
+    __extension__ typedef unsigned __int128 nano_stl_libc_uint128_t;
+    const nano_stl_libc_uint128_t product = static_cast<nano_stl_libc_uint128_t>(x) * y;
+    (*high) = static_cast<uint64_t>(product >> 64u);
+    (*low) = static_cast<uint64_t>(product);
+
+#else // __SIZEOF_INT128__
+
+    const uint64_t a = (x >> 32u);
+    const uint64_t b = (x & 0xFFFFFFFFu);
+    const uint64_t c = (y >> 32u);
+    const uint64_t d = (y & 0xFFFFFFFFu);
+    const uint64_t ac = a * c;
+    const uint64_t bc = b * c;
+    const uint64_t ad = a * d;
+    const uint64_t bd = b * d;
+    const uint64_t middle = (bd >> 32u) + (ad & 0xFFFFFFFFu) + (bc & 0xFFFFFFFFu);
+    (*high) = ac + (ad >> 32u) + (bc >> 32u) + (middle >> 32u);
+    (*low) = (middle << 32u) | (bd & 0xFFFFFFFFu);
+
+#endif // __SIZEOF_INT128__
+}
+
+/** \brief Count the leading zero bits of a non null 64 bits value */
+static inline unsigned int NANO_STL_LIBC_STRTOD_CountLeadingZeros(uint64_t value)
+{
+    unsigned int count = 0u;
+
+#if defined(__GNUC__)
+
+    count = static_cast<unsigned int>(__builtin_clzll(value));
+
+#else // __GNUC__
+
+    while ((value & (static_cast<uint64_t>(0x80000000u) << 32u)) == 0u)
+    {
+        value <<= 1u;
+        count++;
+    }
+
+#endif // __GNUC__
+
+    return count;
+}
+
+#endif // NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED
@@ -18,36 +18,229 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 */
 
 #include "nano-stl-libc.h"
+#include "nano-stl-libc-simd.h"
+#include "nano-stl-libc-dtoa.h"
 
 
 
-/** \brief  Writes a character inside the given string */
-static int NANO_STL_LIBC_PutChar(char *str, char c);
+/** \brief Check if word at a time memory or string functions are enabled */
+#if (NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED == 1) || (NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED == 1)
+#define NANO_STL_LIBC_WORD_FUNCTIONS_ENABLED    1
+#else
+#define NANO_STL_LIBC_WORD_FUNCTIONS_ENABLED    0
+#endif // NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED
 
-/** \brief  Writes a string inside the given string */
-static int NANO_STL_LIBC_PutString(char *str, const char *source);
+/** \brief Attribute of the memory functions : the word at a time versions read whole aligned words of a misaligned
+ *         buffer which may extend before or past it, so they must not be instrumented by the address sanitizer */
+#if (NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED == 1)
+#define NANO_STL_LIBC_WORD_MEMORY_FUNCTION      NANO_STL_LIBC_NO_SANITIZE_ADDRESS
+#else
+#define NANO_STL_LIBC_WORD_MEMORY_FUNCTION
+#endif // NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED
 
-/** \brief  Writes an unsigned int inside the given string, using the provided fill &
- *          width parameters */
-static int NANO_STL_LIBC_PutUnsignedInt(char *str, char fill, int width, unsigned int value);
+/** \brief Attribute of the string functions : the word at a time versions read whole aligned words
+ *         which may extend past the null terminator, so they must not be instrumented by the address sanitizer */
+#if (NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED == 1)
+#define NANO_STL_LIBC_WORD_STRING_FUNCTION      NANO_STL_LIBC_NO_SANITIZE_ADDRESS
+#else
+#define NANO_STL_LIBC_WORD_STRING_FUNCTION
+#endif // NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED
 
-/** \brief  Writes a signed int inside the given string, using the provided fill & width
- *          parameters */
-static int NANO_STL_LIBC_PutSignedInt(char *str, char fill, int width, int value);
 
-/** \brief  Writes an hexadecimal value into a string, using the given fill, width &
- *          capital parameters */
-static int NANO_STL_LIBC_PutHexa(char *str, char fill, int width, unsigned char maj, unsigned int value);
+// Check if word at a time functions are enabled
+#if (NANO_STL_LIBC_WORD_FUNCTIONS_ENABLED == 1)
 
+/** \brief Machine word used by the word at a time functions (may alias any other type) */
+#if defined(__GNUC__)
+typedef size_t __attribute__((__may_alias__)) nano_stl_libc_word_t;
+#else
+typedef size_t nano_stl_libc_word_t;
+#endif // __GNUC__
 
+/** \brief Size in bytes of a machine word */
+#define NANO_STL_LIBC_WORD_SIZE         sizeof(nano_stl_libc_word_t)
 
-/** \brief Highly portable but non-efficient memset function */
-void* NANO_STL_LIBC_Memset(void* const dst, const int val, size_t size)
+/** \brief Mask to check the alignment of an address on a machine word */
+#define NANO_STL_LIBC_WORD_MASK         (NANO_STL_LIBC_WORD_SIZE - 1u)
+
+/** \brief Minimum buffer size in bytes to switch to word at a time processing */
+#define NANO_STL_LIBC_WORD_THRESHOLD    (4u * NANO_STL_LIBC_WORD_SIZE)
+
+/** \brief Check if the CPU is little endian (evaluated at compile time by the compiler) */
+static inline bool NANO_STL_LIBC_IsLittleEndian();
+
+/** \brief Build a word starting at the given byte offset of the first of 2 consecutive aligned words */
+static inline nano_stl_libc_word_t NANO_STL_LIBC_MergeWords(const nano_stl_libc_word_t w0, const nano_stl_libc_word_t w1, const unsigned int offset);
+
+/** \brief Check if a word contains a null byte */
+static inline bool NANO_STL_LIBC_HasZeroByte(const nano_stl_libc_word_t w);
+
+/** \brief Set to 0xFF the bytes of a word which are located before the given byte offset in memory */
+static inline nano_stl_libc_word_t NANO_STL_LIBC_FillHead(const nano_stl_libc_word_t w, const unsigned int offset);
+
+#endif // NANO_STL_LIBC_WORD_FUNCTIONS_ENABLED
+
+// Check if word at a time string functions are enabled
+#if (NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED == 1)
+
+/** \brief Block of 8 chars read by the SWAR decimal parser (may alias any other type) */
+#if defined(__GNUC__)
+typedef uint64_t __attribute__((__may_alias__)) nano_stl_libc_block_t;
+#else
+typedef uint64_t nano_stl_libc_block_t;
+#endif // __GNUC__
+
+/** \brief Convert 8 decimal digits in parallel (the first digit being in the least significant byte) */
+static inline uint64_t NANO_STL_LIBC_ParseBlock(uint64_t digits);
+
+/** \brief Count the trailing zero bits of a non null 64 bits value */
+static inline unsigned int NANO_STL_LIBC_CountTrailingZeros(uint64_t value);
+
+#endif // NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED
+
+/** \brief  Compares 2 buffers byte by byte */
+static int NANO_STL_LIBC_CompareBytes(const uint8_t* u8_s1, const uint8_t* u8_s2, size_t size);
+
+/** \brief  Copies the chars of a string until its null terminator or the given number of chars,
+ *          returns the number of copied chars (the null terminator is not copied) */
+static size_t NANO_STL_LIBC_CopyChars(char* dest, const char* src, size_t size) NANO_STL_LIBC_WORD_STRING_FUNCTION;
+
+/** \brief Length modifiers of the integer conversions */
+typedef enum _nano_stl_libc_length_t
+{
+    /** \brief int (no modifier) */
+    NANO_STL_LIBC_LENGTH_INT = 0u,
+    /** \brief char (hh modifier) */
+    NANO_STL_LIBC_LENGTH_CHAR = 1u,
+    /** \brief short (h modifier) */
+    NANO_STL_LIBC_LENGTH_SHORT = 2u,
+    /** \brief long (l modifier) */
+    NANO_STL_LIBC_LENGTH_LONG = 3u,
+    /** \brief long long (ll modifier) */
+    NANO_STL_LIBC_LENGTH_LONG_LONG = 4u,
+    /** \brief size_t (z modifier) */
+    NANO_STL_LIBC_LENGTH_SIZE = 5u
+} nano_stl_libc_length_t;
+
+/** \brief Output string of the formatting functions */
+typedef struct _nano_stl_libc_output_t
+{
+    /** \brief String */
+    char* str;
+    /** \brief Maximum number of chars (excluding the null terminator) */
+    size_t size;
+    /** \brief Number of chars written */
+    size_t length;
+} nano_stl_libc_output_t;
+
+/** \brief  Writes chars inside the given output string (truncated if there is not enough space) */
+static void NANO_STL_LIBC_PutChars(nano_stl_libc_output_t* const output, const char* chars, size_t count);
+
+/** \brief  Writes a char repeated the given number of times inside the given output string (truncated if there is not enough space) */
+static void NANO_STL_LIBC_PutFill(nano_stl_libc_output_t* const output, const char fill, size_t count);
+
+/** \brief  Writes the given number of chars of a string inside the given output string, using the provided fill & width parameters */
+static void NANO_STL_LIBC_PutString(nano_stl_libc_output_t* const output, char fill, size_t width, const char* source, size_t length);
+
+/** \brief  Writes an integer in decimal inside the given output string, using the provided fill, width & precision
+ *          (minimum number of digits, negative if not specified) parameters */
+static void NANO_STL_LIBC_PutDecimal(nano_stl_libc_output_t* const output, char fill, size_t width, int precision, bool negative, uint64_t value);
+
+/** \brief  Writes an integer in hexadecimal inside the given output string, using the provided fill, width,
+ *          precision (minimum number of digits, negative if not specified), capital and prefix parameters */
+static void NANO_STL_LIBC_PutHexa(nano_stl_libc_output_t* const output, char fill, size_t width, int precision, bool maj, const char* prefix, uint64_t value);
+
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+/** \brief  Writes a floating point number inside the given output string, using the provided fill, width, precision
+ *          and conversion ('f', 'e', 'g' or their capital versions, 'r' for the shortest round-trip representation) parameters */
+static void NANO_STL_LIBC_PutDouble(nano_stl_libc_output_t* const output, char fill, size_t width, int precision, char conversion, double value);
+
+/** \brief  Writes the given number of digits starting at the given index inside the given output string
+ *          (the digits outside of the generated ones are written as '0') */
+static void NANO_STL_LIBC_PutDigits(nano_stl_libc_output_t* const output, const char* digits, size_t count, int first, size_t length);
+
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
+/** \brief  Computes the number of decimal digits of an integer */
+static unsigned int NANO_STL_LIBC_CountDigits(const uint64_t value);
+
+/** \brief  Get the value of a digit char in the bases up to 36 (36 if the char is not a digit) */
+static inline unsigned int NANO_STL_LIBC_DigitValue(const char c);
+
+/** \brief  Parses the digits of an unsigned integer in the given radix, returns true if the value does not fit in 64 bits
+ *          (the string is moved after the last digit and its size is decreased accordingly, the value is saturated on overflow) */
+static bool NANO_STL_LIBC_ParseDigits(const char** str, size_t* size, const unsigned int radix, uint64_t* value);
+
+/** \brief  Writes the decimal digits of an integer backward from the given end of string */
+static void NANO_STL_LIBC_WriteDecimal(char* end, uint64_t value);
+
+/** \brief  Writes exactly 8 decimal digits of an integer backward from the given end of string */
+static char* NANO_STL_LIBC_WriteDecimal8(char* end, uint32_t value);
+
+
+/** \brief Pairs of decimal digits from "00" to "99" */
+static const char s_digits_lut[] = "0001020304050607080910111213141516171819"
+                                   "2021222324252627282930313233343536373839"
+                                   "4041424344454647484950515253545556575859"
+                                   "6061626364656667686970717273747576777879"
+                                   "8081828384858687888990919293949596979899";
+
+/** \brief Powers of ten which fit in 64 bits */
+static const uint64_t s_powers_of_10[] = { 1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u, 
+                                           10000000000u, 100000000000u, 1000000000000u, 10000000000000u, 100000000000000u,
+                                           1000000000000000u, 10000000000000000u, 100000000000000000u, 1000000000000000000u, 
+                                           10000000000000000000u };
+
+
+
+
+/** \brief Highly portable memset function (word at a time if NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED) */
+void* NANO_STL_LIBC_PORTABLE(Memset)(void* const dst, const int val, size_t size)
 {
     if (dst != nullptr)
     {
         const uint8_t u8_val = (uint8_t)(val);
         uint8_t* u8_dst = (uint8_t*)(dst);
+
+// Check if word at a time memory functions are enabled
+#if (NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED == 1)
+
+        if (size >= NANO_STL_LIBC_WORD_THRESHOLD)
+        {
+            // Align destination on a machine word
+            while ((reinterpret_cast<uintptr_t>(u8_dst) & NANO_STL_LIBC_WORD_MASK) != 0u)
+            {
+                (*u8_dst) = u8_val;
+                u8_dst++;
+                size--;
+            }
+
+            // Fill blocks of 4 words, then single words
+            const nano_stl_libc_word_t w_val = (static_cast<nano_stl_libc_word_t>(-1) / 0xFFu) * u8_val;
+            nano_stl_libc_word_t* w_dst = reinterpret_cast<nano_stl_libc_word_t*>(u8_dst);
+            while (size >= (4u * NANO_STL_LIBC_WORD_SIZE))
+            {
+                w_dst[0u] = w_val;
+                w_dst[1u] = w_val;
+                w_dst[2u] = w_val;
+                w_dst[3u] = w_val;
+                w_dst += 4u;
+                size -= (4u * NANO_STL_LIBC_WORD_SIZE);
+            }
+            while (size >= NANO_STL_LIBC_WORD_SIZE)
+            {
+                (*w_dst) = w_val;
+                w_dst++;
+                size -= NANO_STL_LIBC_WORD_SIZE;
+            }
+            u8_dst = reinterpret_cast<uint8_t*>(w_dst);
+        }
+
+#endif // NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED
+
+        // Remaining bytes
         while (size != 0u)
         {
             (*u8_dst) = u8_val;
@@ -59,13 +252,76 @@ void* NANO_STL_LIBC_Memset(void* const dst, const int val, size_t size)
     return dst;
 }
 
-/** \brief Highly portable but non-efficient memcpy function */
-void* NANO_STL_LIBC_Memcpy(void* const dst, const void* const src, size_t size)
+/** \brief Highly portable memcpy function (word at a time if NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED) */
+NANO_STL_LIBC_WORD_MEMORY_FUNCTION void* NANO_STL_LIBC_PORTABLE(Memcpy)(void* const dst, const void* const src, size_t size)
 {
     if ((dst != nullptr) && (src != nullptr))
     {
-        uint8_t* u8_src = (uint8_t*)(src);
+        const uint8_t* u8_src = (const uint8_t*)(src);
         uint8_t* u8_dst = (uint8_t*)(dst);
+
+// Check if word at a time memory functions are enabled
+#if (NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED == 1)
+
+        if (size >= NANO_STL_LIBC_WORD_THRESHOLD)
+        {
+            // Align destination on a machine word
+            while ((reinterpret_cast<uintptr_t>(u8_dst) & NANO_STL_LIBC_WORD_MASK) != 0u)
+            {
+                (*u8_dst) = (*u8_src);
+                u8_src++;
+                u8_dst++;
+                size--;
+            }
+
+            nano_stl_libc_word_t* w_dst = reinterpret_cast<nano_stl_libc_word_t*>(u8_dst);
+            const unsigned int offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(u8_src) & NANO_STL_LIBC_WORD_MASK);
+            if (offset == 0u)
+            {
+                // Source is aligned too : copy blocks of 4 words, then single words
+                const nano_stl_libc_word_t* w_src = reinterpret_cast<const nano_stl_libc_word_t*>(u8_src);
+                while (size >= (4u * NANO_STL_LIBC_WORD_SIZE))
+                {
+                    w_dst[0u] = w_src[0u];
+                    w_dst[1u] = w_src[1u];
+                    w_dst[2u] = w_src[2u];
+                    w_dst[3u] = w_src[3u];
+                    w_dst += 4u;
+                    w_src += 4u;
+                    size -= (4u * NANO_STL_LIBC_WORD_SIZE);
+                }
+                while (size >= NANO_STL_LIBC_WORD_SIZE)
+                {
+                    (*w_dst) = (*w_src);
+                    w_dst++;
+                    w_src++;
+                    size -= NANO_STL_LIBC_WORD_SIZE;
+                }
+                u8_src = reinterpret_cast<const uint8_t*>(w_src);
+            }
+            else
+            {
+                // Source is misaligned : only aligned reads are performed, each destination word 
+                // is built from 2 consecutive source words (never crosses a page boundary)
+                const nano_stl_libc_word_t* w_src = reinterpret_cast<const nano_stl_libc_word_t*>(u8_src - offset);
+                nano_stl_libc_word_t w0 = (*w_src);
+                while (size >= NANO_STL_LIBC_WORD_SIZE)
+                {
+                    w_src++;
+                    const nano_stl_libc_word_t w1 = (*w_src);
+                    (*w_dst) = NANO_STL_LIBC_MergeWords(w0, w1, offset);
+                    w0 = w1;
+                    w_dst++;
+                    size -= NANO_STL_LIBC_WORD_SIZE;
+                }
+                u8_src = reinterpret_cast<const uint8_t*>(w_src) + offset;
+            }
+            u8_dst = reinterpret_cast<uint8_t*>(w_dst);
+        }
+
+#endif // NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED
+
+        // Remaining bytes
         while (size != 0u)
         {
             (*u8_dst) = (*u8_src);
@@ -78,51 +334,143 @@ void* NANO_STL_LIBC_Memcpy(void* const dst, const void* const src, size_t size)
     return dst;
 }
 
-/** \brief Highly portable but non-efficient memcmp function */
-int NANO_STL_LIBC_Memcmp(const void* const s1, const void* const s2, size_t size)
+/** \brief Highly portable memcmp function (word at a time if NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED) */
+NANO_STL_LIBC_WORD_MEMORY_FUNCTION int NANO_STL_LIBC_PORTABLE(Memcmp)(const void* const s1, const void* const s2, size_t size)
 {
     int ret = 0;
 
     if ((s1 != nullptr) && (s2 != nullptr))
     {
-        uint8_t* u8_s1 = (uint8_t*)(s1);
-        uint8_t* u8_s2 = (uint8_t*)(s2);
-        while ((size != 0u) && (ret == 0))
+        const uint8_t* u8_s1 = (const uint8_t*)(s1);
+        const uint8_t* u8_s2 = (const uint8_t*)(s2);
+
+// Check if word at a time memory functions are enabled
+#if (NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED == 1)
+
+        if (size >= NANO_STL_LIBC_WORD_THRESHOLD)
         {
-            if ((*u8_s1) > (*u8_s2))
+            // Align first buffer on a machine word
+            const size_t head = (NANO_STL_LIBC_WORD_SIZE - (reinterpret_cast<uintptr_t>(u8_s1) & NANO_STL_LIBC_WORD_MASK)) & NANO_STL_LIBC_WORD_MASK;
+            ret = NANO_STL_LIBC_CompareBytes(u8_s1, u8_s2, head);
+            u8_s1 += head;
+            u8_s2 += head;
+            size -= head;
+
+            // Skip equal words, the first different word will be compared byte by byte
+            if (ret == 0)
             {
-                ret = 1;
-            }
-            else if ((*u8_s1) < (*u8_s2))
-            {
-                ret = -1;
-            }
-            else
-            {
-                u8_s1++;
-                u8_s2++;
-                size--;
+                const nano_stl_libc_word_t* w_s1 = reinterpret_cast<const nano_stl_libc_word_t*>(u8_s1);
+                const unsigned int offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(u8_s2) & NANO_STL_LIBC_WORD_MASK);
+                if (offset == 0u)
+                {
+                    const nano_stl_libc_word_t* w_s2 = reinterpret_cast<const nano_stl_libc_word_t*>(u8_s2);
+                    while ((size >= NANO_STL_LIBC_WORD_SIZE) && ((*w_s1) == (*w_s2)))
+                    {
+                        w_s1++;
+                        w_s2++;
+                        size -= NANO_STL_LIBC_WORD_SIZE;
+                    }
+                    u8_s2 = reinterpret_cast<const uint8_t*>(w_s2);
+                }
+                else
+                {
+                    const nano_stl_libc_word_t* w_s2 = reinterpret_cast<const nano_stl_libc_word_t*>(u8_s2 - offset);
+                    while ((size >= NANO_STL_LIBC_WORD_SIZE) && ((*w_s1) == NANO_STL_LIBC_MergeWords(w_s2[0u], w_s2[1u], offset)))
+                    {
+                        w_s1++;
+                        w_s2++;
+                        size -= NANO_STL_LIBC_WORD_SIZE;
+                    }
+                    u8_s2 = reinterpret_cast<const uint8_t*>(w_s2) + offset;
+                }
+                u8_s1 = reinterpret_cast<const uint8_t*>(w_s1);
             }
         }
+        if (ret == 0)
+
+#endif // NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED
+
+        {
+            // Remaining bytes
+            ret = NANO_STL_LIBC_CompareBytes(u8_s1, u8_s2, size);
+        }
     }
 
     return ret;
 }
 
-/** \brief Highly portable but non-efficient strncmp function */
-int NANO_STL_LIBC_Strncmp(const char* s1, const char* s2, size_t size)
+/** \brief Highly portable strncmp function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED) */
+NANO_STL_LIBC_WORD_STRING_FUNCTION int NANO_STL_LIBC_PORTABLE(Strncmp)(const char* s1, const char* s2, size_t size)
 {
     int ret = 0;
 
     if ((s1 != nullptr) && (s2 != nullptr))
     {
+
+// Check if word at a time string functions are enabled
+#if (NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED == 1)
+
+        if (size >= NANO_STL_LIBC_WORD_THRESHOLD)
+        {
+            // Align first string on a machine word
+            while (((reinterpret_cast<uintptr_t>(s1) & NANO_STL_LIBC_WORD_MASK) != 0u) && ((*s1) == (*s2)) && ((*s1) != 0))
+            {
+                s1++;
+                s2++;
+                size--;
+            }
+
+            // Skip equal words without null char, the first different word will be compared char by char
+            if ((reinterpret_cast<uintptr_t>(s1) & NANO_STL_LIBC_WORD_MASK) == 0u)
+            {
+                const nano_stl_libc_word_t* w_s1 = reinterpret_cast<const nano_stl_libc_word_t*>(s1);
+                const unsigned int offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(s2) & NANO_STL_LIBC_WORD_MASK);
+                if (offset == 0u)
+                {
+                    const nano_stl_libc_word_t* w_s2 = reinterpret_cast<const nano_stl_libc_word_t*>(s2);
+                    while ((size >= NANO_STL_LIBC_WORD_SIZE) && ((*w_s1) == (*w_s2)) && !NANO_STL_LIBC_HasZeroByte(*w_s1))
+                    {
+                        w_s1++;
+                        w_s2++;
+                        size -= NANO_STL_LIBC_WORD_SIZE;
+                    }
+                    s2 = reinterpret_cast<const char*>(w_s2);
+                }
+                else
+                {
+                    // Only aligned reads are performed on the second string, the next aligned word
+                    // is read only if the string goes on after the current one (never crosses a page boundary)
+                    const nano_stl_libc_word_t* w_s2 = reinterpret_cast<const nano_stl_libc_word_t*>(s2 - offset);
+                    nano_stl_libc_word_t w0 = (*w_s2);
+                    bool equal = true;
+                    while ((size >= NANO_STL_LIBC_WORD_SIZE) && equal && !NANO_STL_LIBC_HasZeroByte(NANO_STL_LIBC_FillHead(w0, offset)))
+                    {
+                        const nano_stl_libc_word_t w1 = w_s2[1u];
+                        equal = (((*w_s1) == NANO_STL_LIBC_MergeWords(w0, w1, offset)) && !NANO_STL_LIBC_HasZeroByte(*w_s1));
+                        if (equal)
+                        {
+                            w0 = w1;
+                            w_s1++;
+                            w_s2++;
+                            size -= NANO_STL_LIBC_WORD_SIZE;
+                        }
+                    }
+                    s2 = reinterpret_cast<const char*>(w_s2) + offset;
+                }
+                s1 = reinterpret_cast<const char*>(w_s1);
+            }
+        }
+
+#endif // NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED
+
+        // Remaining chars (compared as unsigned chars whatever the signedness of char, same ordering as memcmp)
         while ((size != 0u) && (ret == 0))
         {
-            if ((*s1) > (*s2))
+            if (static_cast<uint8_t>(*s1) > static_cast<uint8_t>(*s2))
             {
                 ret = 1;
             }
-            else if ((*s1) < (*s2))
+            else if (static_cast<uint8_t>(*s1) < static_cast<uint8_t>(*s2))
             {
                 ret = -1;
             }
@@ -142,14 +490,40 @@ int NANO_STL_LIBC_Strncmp(const char* s1, const char* s2, size_t size)
     return ret;
 }
 
-/** \brief Highly portable but non-efficient strnlen function */
-size_t NANO_STL_LIBC_Strnlen(const char* s, size_t maxlen)
+/** \brief Highly portable strnlen function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED) */
+NANO_STL_LIBC_WORD_STRING_FUNCTION size_t NANO_STL_LIBC_PORTABLE(Strnlen)(const char* s, size_t maxlen)
 {
     size_t size = 0;
 
     if (s != nullptr)
     {
-        while (((*s) != 0) && (size != maxlen))
+
+// Check if word at a time string functions are enabled
+#if (NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED == 1)
+
+        // Align string on a machine word
+        while (((reinterpret_cast<uintptr_t>(s) & NANO_STL_LIBC_WORD_MASK) != 0u) && (size != maxlen) && ((*s) != 0))
+        {
+            s++;
+            size++;
+        }
+
+        // Skip words without null char (aligned reads never cross a page boundary, the bytes after the null char are ignored)
+        if ((reinterpret_cast<uintptr_t>(s) & NANO_STL_LIBC_WORD_MASK) == 0u)
+        {
+            const nano_stl_libc_word_t* w_s = reinterpret_cast<const nano_stl_libc_word_t*>(s);
+            while (((maxlen - size) >= NANO_STL_LIBC_WORD_SIZE) && !NANO_STL_LIBC_HasZeroByte(*w_s))
+            {
+                w_s++;
+                size += NANO_STL_LIBC_WORD_SIZE;
+            }
+            s = reinterpret_cast<const char*>(w_s);
+        }
+
+#endif // NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED
+
+        // Remaining chars
+        while ((size != maxlen) && ((*s) != 0))
         {
             s++;
             size++;
@@ -159,25 +533,15 @@ size_t NANO_STL_LIBC_Strnlen(const char* s, size_t maxlen)
     return size;
 }
 
-/** \brief Highly portable but non-efficient strncat function */
+/** \brief Highly portable strncat function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED) */
 char* NANO_STL_LIBC_Strncat(char *dest, const char *src, size_t size)
 {
     char* ret = dest;
 
     if ((dest != nullptr) && (src != nullptr))
     {
-        while ((*dest) != 0)
-        {
-            dest++;
-        }
-
-        while ((size != 0) && ((*src) != 0))
-        {
-            (*dest) = (*src);
-            dest++;
-            src++;
-            size--;
-        }
+        dest += NANO_STL_LIBC_Strnlen(dest, static_cast<size_t>(-1));
+        dest += NANO_STL_LIBC_CopyChars(dest, src, size);
         (*dest) = 0;
     }
 
@@ -185,120 +549,241 @@ char* NANO_STL_LIBC_Strncat(char *dest, const char *src, size_t size)
 
 }
 
-/** \brief Highly portable but non-efficient strncpy function */
+/** \brief Highly portable strncpy function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED) */
 char* NANO_STL_LIBC_Strncpy(char *dest, const char *src, size_t size)
 {
     char* ret = dest;
 
     if ((dest != nullptr) && (src != nullptr))
     {
-        while ((size != 0) && ((*src) != 0))
-        {
-            (*dest) = (*src);
-            dest++;
-            src++;
-            size--;
-        }
-        while (size != 0)
-        {
-            (*dest) = 0;
-            dest++;
-            size--;
-        }
+        const size_t count = NANO_STL_LIBC_CopyChars(dest, src, size);
+        NANO_STL_LIBC_Memset(dest + count, 0, size - count);
     }
 
     return ret;
 
 }
 
-/** \brief Highly portable but non-efficient vsnprintf function */
+/** \brief Highly portable vsnprintf function (returns the number of chars written in the string excluding the null terminator) */
 int NANO_STL_LIBC_Vsnprintf(char *str, size_t size, const char *format, va_list ap)
 {
-    char          fill;
-    unsigned char width;
-    signed int    num = 0;
-    signed int    current_size = 0;
-
-    /* Clear the string */
-    if (str) {
-
-        *str = 0;
-    }
-
-    /* Phase string */
-    while ((*format != 0) && ((size_t)(current_size) < size)) {
-
-        /* Normal character */
-        if (*format != '%') {
-
-            *str++ = *format++;
-            current_size++;
-        }
-        /* Escaped '%' */
-        else if (*(format+1) == '%') {
-
-            *str++ = '%';
-            format += 2;
-            current_size++;
-        }
-        /* Token delimiter */
-        else {
-
-            fill = ' ';
-            width = 0;
-            format++;
+    int ret = 0;
 
-            /* Parse filler */
-            if (*format == '0') {
+    if ((str != nullptr) && (format != nullptr) && (size != 0u))
+    {
+        nano_stl_libc_output_t output = { str, size - 1u, 0u };
 
-                fill = '0';
-                format++;
+        /* Parse format string */
+        while (((*format) != 0) && (ret == 0) && (output.length < output.size))
+        {
+            if ((*format) != '%')
+            {
+                /* Normal characters */
+                const char* const chars = format;
+                while (((*format) != 0) && ((*format) != '%'))
+                {
+                    format++;
+                }
+                NANO_STL_LIBC_PutChars(&output, chars, static_cast<size_t>(format - chars));
             }
-
-            /* Parse width */
-            while ((*format >= '0') && (*format <= '9')) {
-
-                width = (width*10) + *format-'0';
-                format++;
+            else if ((*(format + 1)) == '%')
+            {
+                /* Escaped '%' */
+                NANO_STL_LIBC_PutChars(&output, format, 1u);
+                format += 2;
             }
+            else
+            {
+                /* Token delimiter */
+                char fill = ' ';
+                size_t width = 0u;
+                int precision = -1;
+                nano_stl_libc_length_t length = NANO_STL_LIBC_LENGTH_INT;
+                format++;
 
-            /* Check if there is enough space */
-            if ((size_t)(current_size + (signed int)(width)) > size) {
+                /* Parse filler */
+                if ((*format) == '0')
+                {
+                    fill = '0';
+                    format++;
+                }
+
+                /* Parse width */
+                while (((*format) >= '0') && ((*format) <= '9'))
+                {
+                    if (width < 0xFFFFu)
+                    {
+                        width = (width * 10u) + static_cast<size_t>((*format) - '0');
+                    }
+                    format++;
+                }
+
+                /* Parse precision */
+                if ((*format) == '.')
+                {
+                    precision = 0;
+                    format++;
+                    while (((*format) >= '0') && ((*format) <= '9'))
+                    {
+                        if (precision < 0xFFFF)
+                        {
+                            precision = (precision * 10) + static_cast<int>((*format) - '0');
+                        }
+                        format++;
+                    }
+                }
+
+                /* Parse length modifier */
+                if ((*format) == 'l')
+                {
+                    length = NANO_STL_LIBC_LENGTH_LONG;
+                    format++;
+                    if ((*format) == 'l')
+                    {
+                        length = NANO_STL_LIBC_LENGTH_LONG_LONG;
+                        format++;
+                    }
+                }
+                else if ((*format) == 'z')
+                {
+                    length = NANO_STL_LIBC_LENGTH_SIZE;
+                    format++;
+                }
+                else if ((*format) == 'h')
+                {
+                    length = NANO_STL_LIBC_LENGTH_SHORT;
+                    format++;
+                    if ((*format) == 'h')
+                    {
+                        length = NANO_STL_LIBC_LENGTH_CHAR;
+                        format++;
+                    }
+                }
+                else
+                {}
+
+                /* Parse type */
+                switch (*format)
+                {
+                    case 'd':
+                    case 'i':
+                    {
+                        int64_t value;
+                        switch (length)
+                        {
+                            case NANO_STL_LIBC_LENGTH_CHAR: value = static_cast<signed char>(va_arg(ap, int)); break;
+                            case NANO_STL_LIBC_LENGTH_SHORT: value = static_cast<short>(va_arg(ap, int)); break;
+                            case NANO_STL_LIBC_LENGTH_LONG: value = va_arg(ap, long); break;
+                            case NANO_STL_LIBC_LENGTH_LONG_LONG: value = va_arg(ap, long long); break;
+                            case NANO_STL_LIBC_LENGTH_SIZE: value = va_arg(ap, ptrdiff_t); break;
+                            default: value = va_arg(ap, int); break;
+                        }
+                        const bool negative = (value < 0);
+                        const uint64_t absolute = (negative ? (0u - static_cast<uint64_t>(value)) : static_cast<uint64_t>(value));
+                        if (precision >= 0)
+                        {
+                            /* The 0 flag is ignored when a precision is given */
+                            fill = ' ';
+                        }
+                        NANO_STL_LIBC_PutDecimal(&output, fill, width, precision, negative, absolute);
+                        break;
+                    }
+
+                    case 'u':
+                    case 'x':
+                    case 'X':
+                    {
+                        uint64_t value;
+                        switch (length)
+                        {
+                            case NANO_STL_LIBC_LENGTH_CHAR: value = static_cast<unsigned char>(va_arg(ap, unsigned int)); break;
+                            case NANO_STL_LIBC_LENGTH_SHORT: value = static_cast<unsigned short>(va_arg(ap, unsigned int)); break;
+                            case NANO_STL_LIBC_LENGTH_LONG: value = va_arg(ap, unsigned long); break;
+                            case NANO_STL_LIBC_LENGTH_LONG_LONG: value = va_arg(ap, unsigned long long); break;
+                            case NANO_STL_LIBC_LENGTH_SIZE: value = va_arg(ap, size_t); break;
+                            default: value = va_arg(ap, unsigned int); break;
+                        }
+                        if (precision >= 0)
+                        {
+                            /* The 0 flag is ignored when a precision is given */
+                            fill = ' ';
+                        }
+                        if ((*format) == 'u')
+                        {
+                            NANO_STL_LIBC_PutDecimal(&output, fill, width, precision, false, value);
+                        }
+                        else
+                        {
+                            NANO_STL_LIBC_PutHexa(&output, fill, width, precision, ((*format) == 'X'), nullptr, value);
+                        }
+                        break;
+                    }
+
+                    case 'p':
+                        NANO_STL_LIBC_PutHexa(&output, fill, width, -1, false, "0x", reinterpret_cast<uintptr_t>(va_arg(ap, void*)));
+                        break;
+
+                    case 's':
+                    {
+                        const char* source = va_arg(ap, const char*);
+                        size_t max_length = output.size - output.length;
+                        if (source == nullptr)
+                        {
+                            source = "(null)";
+                        }
+
+                        /* Only the chars which can fit in the output string are taken into account */
+                        if (width > max_length)
+                        {
+                            max_length = width;
+                        }
+                        if ((precision >= 0) && (static_cast<size_t>(precision) < max_length))
+                        {
+                            max_length = static_cast<size_t>(precision);
+                        }
+                        NANO_STL_LIBC_PutString(&output, fill, width, source, NANO_STL_LIBC_Strnlen(source, max_length));
+                        break;
+                    }
+
+                    case 'c':
+                    {
+                        const char c = static_cast<char>(va_arg(ap, int));
+                        NANO_STL_LIBC_PutString(&output, fill, width, &c, 1u);
+                        break;
+                    }
+
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+                    case 'f':
+                    case 'F':
+                    case 'e':
+                    case 'E':
+                    case 'g':
+                    case 'G':
+                        NANO_STL_LIBC_PutDouble(&output, fill, width, precision, (*format), va_arg(ap, double));
+                        break;
+
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
+                    default:
+                        ret = -1;
+                        break;
+                }
 
-                width = (unsigned char)(size - current_size);
-            }
-
-            /* Parse type */
-            switch (*format) {
-            case 'd':
-            case 'i': num = NANO_STL_LIBC_PutSignedInt(str, fill, width, va_arg(ap, signed int)); break;
-            case 'u': num = NANO_STL_LIBC_PutUnsignedInt(str, fill, width, va_arg(ap, unsigned int)); break;
-            case 'x': num = NANO_STL_LIBC_PutHexa(str, fill, width, 0, va_arg(ap, unsigned int)); break;
-            case 'X': num = NANO_STL_LIBC_PutHexa(str, fill, width, 1, va_arg(ap, unsigned int)); break;
-            case 's': num = NANO_STL_LIBC_PutString(str, va_arg(ap, char *)); break;
-            case 'c': num = NANO_STL_LIBC_PutChar(str, va_arg(ap, unsigned int)); break;
-            default:
-                return -1;
+                format++;
             }
-
-            format++;
-            str += num;
-            current_size += num;
         }
-    }
 
-    /* nullptr-terminated (final \0 is not counted) */
-    if ((size_t)(current_size) < size) 
-    {
-        *str = 0;
-    }
-    else 
-    {
-        *(--str) = 0;
-        current_size--;
+        /* Null-terminated (final \0 is not counted) */
+        str[output.length] = 0;
+        if (ret == 0)
+        {
+            ret = static_cast<int>(output.length);
+        }
     }
 
-    return current_size;
+    return ret;
 }
 
 /** \brief Highly portable but non-efficient snprintf function */
@@ -314,10 +799,34 @@ int NANO_STL_LIBC_Snprintf(char *str, size_t size, const char *format, ...)
     return rc;
 }
 
-/** \brief Highly portable but non-efficient atoi function */
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+/** \brief Highly portable dtoa function (writes the shortest representation which reads back to the same value, 
+ *         returns the number of chars written in the string excluding the null terminator) */
+int NANO_STL_LIBC_Dtoa(double value, char* str, size_t size)
+{
+    int ret = 0;
+
+    if ((str != nullptr) && (size != 0u))
+    {
+        nano_stl_libc_output_t output = { str, size - 1u, 0u };
+        NANO_STL_LIBC_PutDouble(&output, ' ', 0u, -1, 'r', value);
+
+        /* Null-terminated (final \0 is not counted) */
+        str[output.length] = 0;
+        ret = static_cast<int>(output.length);
+    }
+
+    return ret;
+}
+
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
+/** \brief Highly portable atoi function (SWAR if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED) */
 int NANO_STL_LIBC_Atoi(const char* str)
 {
-    return NANO_STL_LIBC_Antoi(str, 10u, static_cast<size_t>(0xFFFFFFFFu));
+    return NANO_STL_LIBC_Antoi(str, 10u, static_cast<size_t>(-1));
 }
 
 /** \brief Highly portable but non-efficient itoa function */
@@ -364,271 +873,814 @@ char* NANO_STL_LIBC_Itoa(int value, char * str, int base)
     return ret;
 }
 
-/** \brief Highly portable but non-efficient atof function */
-double NANO_STL_LIBC_Atof(const char* nptr)
-{
-	int count = 0;
-	double res = 0.;
-	double int_part = 0;
-	const char* int_part_str = nptr;
-	double dec_part = 0;
-	const char* dec_part_str;
-	unsigned char negative = 0u;
-
-	if ((nptr != nullptr) && ((*nptr) != 0))
-	{
-		if ((*nptr) == '-')
-		{
-			negative = 1u;
-			nptr++;
-			int_part_str++;
-		}
-
-		while (((*nptr) != 0) && ((*nptr) != '.'))
-		{
-			count++;
-			nptr++;
-		}
-		int_part = static_cast<double>(NANO_STL_LIBC_Antoi(int_part_str, 10, count));
-
-		if ((*nptr) == '.')
-		{
-			nptr++;
-		}
-		count = 0;
-		dec_part_str = nptr;
-		while ((*nptr) != 0)
-		{
-			count++;
-			nptr++;
-		}
-		dec_part = static_cast<double>(NANO_STL_LIBC_Antoi(dec_part_str, 10, count));
-		int dec_count = NANO_STL_STRNLEN(dec_part_str, count);
-		while (dec_count != 0)
-		{
-			dec_part /= 10.;
-			dec_count--;
-		}
-
-		res = int_part + dec_part;
-
-		if (negative == 1u)
-        {
-            res = -1. * res;
-        }
-	}
-
-	return res;
-}
-
-/** \brief Highly portable but non-efficient atoi function with radix and string length check */
+/** \brief Highly portable atoi function with radix (2 to 36) and string length check (saturated on overflow) */
 int NANO_STL_LIBC_Antoi(const char* str, const int radix, size_t size)
 {
-    int res = 0;
-    unsigned char negative = 0u;
+    int64_t value;
+    const int64_t max = static_cast<int64_t>(static_cast<unsigned int>(-1) >> 1u);
 
-    if ((str != nullptr) && (radix >= 2) && (radix <= 16) && (size != 0))
+    (void)NANO_STL_LIBC_Antoi64(str, radix, size, &value, nullptr);
+    if (value > max)
     {
-        if ((*str) == '-')
+        value = max;
+    }
+    else if (value < (-max - 1))
+    {
+        value = (-max - 1);
+    }
+    else
+    {}
+
+    return static_cast<int>(value);
+}
+
+/** \brief Highly portable atoll function with radix (2 to 36) and string length check (saturated on overflow) */
+int64_t NANO_STL_LIBC_Antoll(const char* str, const int radix, size_t size)
+{
+    int64_t value;
+    (void)NANO_STL_LIBC_Antoi64(str, radix, size, &value, nullptr);
+    return value;
+}
+
+/** \brief Highly portable atoull function with radix (2 to 36) and string length check (saturated on overflow) */
+uint64_t NANO_STL_LIBC_Antoull(const char* str, const int radix, size_t size)
+{
+    uint64_t value;
+    (void)NANO_STL_LIBC_Antou64(str, radix, size, &value, nullptr);
+    return value;
+}
+
+/** \brief Highly portable strtoll like function with string length check and overflow report */
+nano_stl_libc_conv_result_t NANO_STL_LIBC_Antoi64(const char* str, const int radix, size_t size, int64_t* value, const char** end)
+{
+    nano_stl_libc_conv_result_t result = NANO_STL_LIBC_CONV_INVALID;
+    const char* stop = str;
+    uint64_t magnitude = 0u;
+    bool negative = false;
+
+    if ((str != nullptr) && (radix >= 2) && (radix <= 36))
+    {
+        if ((size != 0u) && (((*str) == '-') || ((*str) == '+')))
         {
-            negative = 1u;
+            negative = ((*str) == '-');
             str++;
-			size--;
+            size--;
         }
 
-        while (((*str) != 0) && (size != 0))
+        const char* const digits = str;
+        const bool overflow = NANO_STL_LIBC_ParseDigits(&str, &size, static_cast<unsigned int>(radix), &magnitude);
+        if (str != digits)
         {
-            int val = 0;
-            if (((*str) >= '0') && ((*str) <= '9'))
+            /* The magnitude of the most negative value is one more than the magnitude of the most positive value */
+            const uint64_t limit = (static_cast<uint64_t>(-1) >> 1u) + (negative ? 1u : 0u);
+            result = NANO_STL_LIBC_CONV_OK;
+            if (overflow || (magnitude > limit))
             {
-                val = (*str) - '0';
+                magnitude = limit;
+                result = NANO_STL_LIBC_CONV_OVERFLOW;
             }
-            else if (((*str) >= 'a') && ((*str) <= 'f'))
-            {
-                val = (*str) - 'a' + 10;
-            }
-            else
-            {
-                val = (*str) - 'A' + 10;
-            }
-            res = (res * radix) + val;
+            stop = str;
+        }
+    }
+    if (value != nullptr)
+    {
+        (*value) = static_cast<int64_t>(negative ? (0u - magnitude) : magnitude);
+    }
+    if (end != nullptr)
+    {
+        (*end) = stop;
+    }
+
+    return result;
+}
+
+/** \brief Highly portable strtoull like function with string length check and overflow report */
+nano_stl_libc_conv_result_t NANO_STL_LIBC_Antou64(const char* str, const int radix, size_t size, uint64_t* value, const char** end)
+{
+    nano_stl_libc_conv_result_t result = NANO_STL_LIBC_CONV_INVALID;
+    const char* stop = str;
+    uint64_t magnitude = 0u;
+
+    if ((str != nullptr) && (radix >= 2) && (radix <= 36))
+    {
+        if ((size != 0u) && ((*str) == '+'))
+        {
             str++;
-			size--;
+            size--;
         }
 
-        if (negative == 1u)
+        const char* const digits = str;
+        const bool overflow = NANO_STL_LIBC_ParseDigits(&str, &size, static_cast<unsigned int>(radix), &magnitude);
+        if (str != digits)
         {
-            res = -1 * res;
+            result = (overflow ? NANO_STL_LIBC_CONV_OVERFLOW : NANO_STL_LIBC_CONV_OK);
+            stop = str;
         }
     }
+    if (value != nullptr)
+    {
+        (*value) = magnitude;
+    }
+    if (end != nullptr)
+    {
+        (*end) = stop;
+    }
 
-    return res;
+    return result;
 }
 
 
-/** \brief  Writes a character inside the given string */
-static int NANO_STL_LIBC_PutChar(char *str, char c)
+// Check if word at a time functions are enabled
+#if (NANO_STL_LIBC_WORD_FUNCTIONS_ENABLED == 1)
+
+/** \brief Check if the CPU is little endian (evaluated at compile time by the compiler) */
+static inline bool NANO_STL_LIBC_IsLittleEndian()
 {
-    *str = c;
-    return 1;
+    const nano_stl_libc_word_t one = 1u;
+    return ((*reinterpret_cast<const uint8_t*>(&one)) == 1u);
+}
+
+/** \brief Build a word starting at the given byte offset of the first of 2 consecutive aligned words */
+static inline nano_stl_libc_word_t NANO_STL_LIBC_MergeWords(const nano_stl_libc_word_t w0, const nano_stl_libc_word_t w1, const unsigned int offset)
+{
+    nano_stl_libc_word_t merged;
+    const unsigned int low_shift = 8u * offset;
+    const unsigned int high_shift = 8u * (NANO_STL_LIBC_WORD_SIZE - offset);
+
+    if (NANO_STL_LIBC_IsLittleEndian())
+    {
+        merged = (w0 >> low_shift) | (w1 << high_shift);
+    }
+    else
+    {
+        merged = (w0 << low_shift) | (w1 >> high_shift);
+    }
+
+    return merged;
 }
 
+/** \brief Check if a word contains a null byte */
+static inline bool NANO_STL_LIBC_HasZeroByte(const nano_stl_libc_word_t w)
+{
+    const nano_stl_libc_word_t ones = static_cast<nano_stl_libc_word_t>(-1) / 0xFFu;
+    const nano_stl_libc_word_t highs = ones << 7u;
+    return (((w - ones) & ~w & highs) != 0u);
+}
 
-/** \brief  Writes a string inside the given string */
-static int NANO_STL_LIBC_PutString(char *str, const char *source)
+/** \brief Set to 0xFF the bytes of a word which are located before the given byte offset in memory */
+static inline nano_stl_libc_word_t NANO_STL_LIBC_FillHead(const nano_stl_libc_word_t w, const unsigned int offset)
 {
-    int num = 0;
+    nano_stl_libc_word_t head;
+    const unsigned int shift = 8u * offset;
 
-    while (*source != 0)
+    if (NANO_STL_LIBC_IsLittleEndian())
     {
-        *str++ = *source++;
-        num++;
+        head = (static_cast<nano_stl_libc_word_t>(1u) << shift) - 1u;
+    }
+    else
+    {
+        head = ~(static_cast<nano_stl_libc_word_t>(-1) >> shift);
     }
 
-    return num;
+    return (w | head);
 }
 
+#endif // NANO_STL_LIBC_WORD_FUNCTIONS_ENABLED
+
 
-/** \brief  Writes an unsigned int inside the given string, using the provided fill &
- *          width parameters */
-static int NANO_STL_LIBC_PutUnsignedInt(char *str, char fill, int width, unsigned int value)
+// Check if word at a time string functions are enabled
+#if (NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED == 1)
+
+/** \brief Convert 8 decimal digits in parallel (the first digit being in the least significant byte) */
+static inline uint64_t NANO_STL_LIBC_ParseBlock(uint64_t digits)
 {
-    int num = 0;
+    /* Combine the digits by pairs, then by groups of 4, then the 2 groups of 4 */
+    digits = (digits * 10u) + (digits >> 8u);
+    digits = (((digits & 0x000000FF000000FFu) * ((static_cast<uint64_t>(1000000u) << 32u) + 100u)) + 
+              (((digits >> 16u) & 0x000000FF000000FFu) * ((static_cast<uint64_t>(10000u) << 32u) + 1u))) >> 32u;
+    return (digits & 0xFFFFFFFFu);
+}
 
-    /* Take current digit into account when calculating width */
-    width--;
+/** \brief Count the trailing zero bits of a non null 64 bits value */
+static inline unsigned int NANO_STL_LIBC_CountTrailingZeros(uint64_t value)
+{
+    unsigned int count = 0u;
 
-    /* Recursively write upper digits */
-    if ((value / 10u) > 0)
+#if defined(__GNUC__)
+
+    count = static_cast<unsigned int>(__builtin_ctzll(value));
+
+#else // __GNUC__
+
+    while ((value & 1u) == 0u)
     {
-        num = NANO_STL_LIBC_PutUnsignedInt(str, fill, width, value / 10u);
-        str += num;
+        value >>= 1u;
+        count++;
     }
-    else
+
+#endif // __GNUC__
+
+    return count;
+}
+
+#endif // NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED
+
+
+/** \brief  Compares 2 buffers byte by byte */
+static int NANO_STL_LIBC_CompareBytes(const uint8_t* u8_s1, const uint8_t* u8_s2, size_t size)
+{
+    int ret = 0;
+
+    while ((size != 0u) && (ret == 0))
     {
-    	/* Write filler characters */
-        while (width > 0)
+        if ((*u8_s1) > (*u8_s2))
         {
-        	NANO_STL_LIBC_PutChar(str, fill);
-            str++;
-            num++;
-            width--;
+            ret = 1;
+        }
+        else if ((*u8_s1) < (*u8_s2))
+        {
+            ret = -1;
+        }
+        else
+        {
+            u8_s1++;
+            u8_s2++;
+            size--;
+        }
+    }
+
+    return ret;
+}
+
+/** \brief  Copies the chars of a string until its null terminator or the given number of chars,
+ *          returns the number of copied chars (the null terminator is not copied) */
+static size_t NANO_STL_LIBC_CopyChars(char* dest, const char* src, size_t size)
+{
+    const size_t initial_size = size;
+
+// Check if word at a time string functions are enabled
+#if (NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED == 1)
+
+    if (size >= NANO_STL_LIBC_WORD_THRESHOLD)
+    {
+        // Align destination on a machine word
+        while (((reinterpret_cast<uintptr_t>(dest) & NANO_STL_LIBC_WORD_MASK) != 0u) && ((*src) != 0))
+        {
+            (*dest) = (*src);
+            dest++;
+            src++;
+            size--;
+        }
+
+        // Copy words without null char
+        if ((reinterpret_cast<uintptr_t>(dest) & NANO_STL_LIBC_WORD_MASK) == 0u)
+        {
+            nano_stl_libc_word_t* w_dest = reinterpret_cast<nano_stl_libc_word_t*>(dest);
+            const unsigned int offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(src) & NANO_STL_LIBC_WORD_MASK);
+            if (offset == 0u)
+            {
+                const nano_stl_libc_word_t* w_src = reinterpret_cast<const nano_stl_libc_word_t*>(src);
+                while ((size >= NANO_STL_LIBC_WORD_SIZE) && !NANO_STL_LIBC_HasZeroByte(*w_src))
+                {
+                    (*w_dest) = (*w_src);
+                    w_dest++;
+                    w_src++;
+                    size -= NANO_STL_LIBC_WORD_SIZE;
+                }
+                src = reinterpret_cast<const char*>(w_src);
+            }
+            else
+            {
+                // Only aligned reads are performed on the source string, the next aligned word
+                // is read only if the string goes on after the current one (never crosses a page boundary)
+                const nano_stl_libc_word_t* w_src = reinterpret_cast<const nano_stl_libc_word_t*>(src - offset);
+                nano_stl_libc_word_t w0 = (*w_src);
+                bool copy = true;
+                while ((size >= NANO_STL_LIBC_WORD_SIZE) && copy && !NANO_STL_LIBC_HasZeroByte(NANO_STL_LIBC_FillHead(w0, offset)))
+                {
+                    const nano_stl_libc_word_t w1 = w_src[1u];
+                    const nano_stl_libc_word_t merged = NANO_STL_LIBC_MergeWords(w0, w1, offset);
+                    copy = !NANO_STL_LIBC_HasZeroByte(merged);
+                    if (copy)
+                    {
+                        (*w_dest) = merged;
+                        w0 = w1;
+                        w_dest++;
+                        w_src++;
+                        size -= NANO_STL_LIBC_WORD_SIZE;
+                    }
+                }
+                src = reinterpret_cast<const char*>(w_src) + offset;
+            }
+            dest = reinterpret_cast<char*>(w_dest);
         }
     }
 
-    /* Write lower digit */
-    num += NANO_STL_LIBC_PutChar(str, (value % 10u) + '0');
+#endif // NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED
+
+    // Remaining chars
+    while ((size != 0u) && ((*src) != 0))
+    {
+        (*dest) = (*src);
+        dest++;
+        src++;
+        size--;
+    }
 
-    return num;
+    return (initial_size - size);
 }
 
 
-/** \brief  Writes a signed int inside the given string, using the provided fill & width
- *          parameters */
-static int NANO_STL_LIBC_PutSignedInt(char *str, char fill, int width, int value)
+/** \brief  Writes chars inside the given output string (truncated if there is not enough space) */
+static void NANO_STL_LIBC_PutChars(nano_stl_libc_output_t* const output, const char* chars, size_t count)
 {
-    int num = 0;
-    unsigned int absolute;
+    const size_t free_space = output->size - output->length;
+    if (count > free_space)
+    {
+        count = free_space;
+    }
+    NANO_STL_LIBC_Memcpy(&output->str[output->length], chars, count);
+    output->length += count;
+}
+
 
-    /* Compute absolute value */
-    if (value < 0)
+/** \brief  Writes a char repeated the given number of times inside the given output string (truncated if there is not enough space) */
+static void NANO_STL_LIBC_PutFill(nano_stl_libc_output_t* const output, const char fill, size_t count)
+{
+    const size_t free_space = output->size - output->length;
+    if (count > free_space)
     {
-        absolute = -value;
+        count = free_space;
+    }
+    NANO_STL_LIBC_Memset(&output->str[output->length], fill, count);
+    output->length += count;
+}
+
+
+/** \brief  Writes the given number of chars of a string inside the given output string, using the provided fill & width parameters */
+static void NANO_STL_LIBC_PutString(nano_stl_libc_output_t* const output, char fill, size_t width, const char* source, size_t length)
+{
+    if (width > length)
+    {
+        NANO_STL_LIBC_PutFill(output, fill, width - length);
+    }
+    NANO_STL_LIBC_PutChars(output, source, length);
+}
+
+
+/** \brief  Writes an integer in decimal inside the given output string, using the provided fill, width & precision
+ *          (minimum number of digits, negative if not specified) parameters */
+static void NANO_STL_LIBC_PutDecimal(nano_stl_libc_output_t* const output, char fill, size_t width, int precision, bool negative, uint64_t value)
+{
+    /* A null value is written without any digit if the precision is 0 */
+    const unsigned int digit_count = (((value != 0u) || (precision != 0)) ? NANO_STL_LIBC_CountDigits(value) : 0u);
+    const size_t zero_count = ((precision > static_cast<int>(digit_count)) ? (static_cast<size_t>(precision) - digit_count) : 0u);
+    const size_t length = digit_count + zero_count + (negative ? 1u : 0u);
+    const size_t fill_count = ((width > length) ? (width - length) : 0u);
+
+    /* Filler characters and sign */
+    if (negative && (fill == '0'))
+    {
+        NANO_STL_LIBC_PutChars(output, "-", 1u);
+        NANO_STL_LIBC_PutFill(output, fill, fill_count);
     }
     else
     {
-        absolute = value;
+        NANO_STL_LIBC_PutFill(output, fill, fill_count);
+        if (negative)
+        {
+            NANO_STL_LIBC_PutChars(output, "-", 1u);
+        }
     }
 
-    /* Take current digit into account when calculating width */
-    width--;
+    /* Leading zeros required by the precision */
+    NANO_STL_LIBC_PutFill(output, '0', zero_count);
 
-    /* Recursively write upper digits */
-    if ((absolute / 10u) > 0)
+    /* Digits are directly written in the output string if they fit in */
+    if (digit_count != 0u)
     {
-        if (value < 0)
+        if ((output->size - output->length) >= digit_count)
         {
-            num = NANO_STL_LIBC_PutSignedInt(str, fill, width, -(int)((absolute / 10u)));
+            NANO_STL_LIBC_WriteDecimal(&output->str[output->length + digit_count], value);
+            output->length += digit_count;
         }
         else
         {
-            num = NANO_STL_LIBC_PutSignedInt(str, fill, width, absolute / 10u);
+            char digits[20u];
+            NANO_STL_LIBC_WriteDecimal(&digits[digit_count], value);
+            NANO_STL_LIBC_PutChars(output, digits, digit_count);
+        }
+    }
+}
+
+
+/** \brief  Writes an integer in hexadecimal inside the given output string, using the provided fill, width,
+ *          precision (minimum number of digits, negative if not specified), capital and prefix parameters */
+static void NANO_STL_LIBC_PutHexa(nano_stl_libc_output_t* const output, char fill, size_t width, int precision, bool maj, const char* prefix, uint64_t value)
+{
+    static const char lower_digits[] = "0123456789abcdef";
+    static const char upper_digits[] = "0123456789ABCDEF";
+    const char* const hexa_digits = (maj ? upper_digits : lower_digits);
+    char digits[16u];
+    char* digit = &digits[sizeof(digits)];
+
+    /* Write digits backward, a null value is written without any digit if the precision is 0 */
+    if ((value != 0u) || (precision != 0))
+    {
+        do
+        {
+            digit--;
+            (*digit) = hexa_digits[value & 0x0Fu];
+            value >>= 4u;
         }
-        str += num;
+        while (value != 0u);
+    }
+    const size_t digit_count = static_cast<size_t>(&digits[sizeof(digits)] - digit);
+    const size_t zero_count = ((precision > static_cast<int>(digit_count)) ? (static_cast<size_t>(precision) - digit_count) : 0u);
+    const size_t prefix_length = ((prefix != nullptr) ? 2u : 0u);
+    const size_t length = prefix_length + zero_count + digit_count;
+
+    /* Filler characters, prefix and leading zeros required by the precision */
+    if (width > length)
+    {
+        NANO_STL_LIBC_PutFill(output, fill, width - length);
+    }
+    if (prefix != nullptr)
+    {
+        NANO_STL_LIBC_PutChars(output, prefix, prefix_length);
+    }
+    NANO_STL_LIBC_PutFill(output, '0', zero_count);
+    NANO_STL_LIBC_PutChars(output, digit, digit_count);
+}
+
+
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+/** \brief  Writes a floating point number inside the given output string, using the provided fill, width, precision
+ *          and conversion ('f', 'e', 'g' or their capital versions, 'r' for the shortest round-trip representation) parameters */
+static void NANO_STL_LIBC_PutDouble(nano_stl_libc_output_t* const output, char fill, size_t width, int precision, char conversion, double value)
+{
+    char digits[NANO_STL_LIBC_DTOA_MAX_DIGITS];
+    const bool maj = ((conversion >= 'A') && (conversion <= 'Z'));
+    const uint64_t bits = NANO_STL_LIBC_DTOA_GetBits(value);
+    const bool negative = ((bits >> 63u) != 0u);
+
+    if (((bits >> 52u) & 0x7FFu) == 0x7FFu)
+    {
+        /* Infinity and NaN are never padded with zeros */
+        const bool nan = ((bits & ((static_cast<uint64_t>(1u) << 52u) - 1u)) != 0u);
+        const char* const text = (nan ? (maj ? "-NAN" : "-nan") : (maj ? "-INF" : "-inf"));
+        NANO_STL_LIBC_PutString(output, ' ', width, (negative ? text : (text + 1)), (negative ? 4u : 3u));
     }
     else
     {
-        /* Reserve space for sign */
-        if (value < 0)
+        const double absolute = (negative ? -value : value);
+        size_t count = 0u;
+        int decimal_point = 0;
+        bool exponent_notation = false;
+
+        /* Compute the digits */
+        if (precision < 0)
         {
-            width--;
+            precision = 6;
         }
+        if (precision > NANO_STL_LIBC_DTOA_MAX_PRECISION)
+        {
+            precision = NANO_STL_LIBC_DTOA_MAX_PRECISION;
+        }
+        switch (conversion)
+        {
+            case 'f':
+            case 'F':
+                count = NANO_STL_LIBC_DTOA_Precision(absolute, precision, true, digits, &decimal_point);
+                break;
 
-        /* Write filler characters */
-        while (width > 0)
+            case 'e':
+            case 'E':
+                count = NANO_STL_LIBC_DTOA_Precision(absolute, precision + 1, false, digits, &decimal_point);
+                exponent_notation = true;
+                break;
+
+            default:
+            {
+                /* 'g' and 'r' conversions: trailing zeros are removed and the notation depends on the exponent */
+                int max_exponent;
+                if (conversion == 'r')
+                {
+                    if (absolute != 0.)
+                    {
+                        count = NANO_STL_LIBC_DTOA_Shortest(absolute, digits, &decimal_point);
+                    }
+                    max_exponent = 17;
+                }
+                else
+                {
+                    if (precision == 0)
+                    {
+                        precision = 1;
+                    }
+                    count = NANO_STL_LIBC_DTOA_Precision(absolute, precision, false, digits, &decimal_point);
+                    max_exponent = precision;
+                }
+                while ((count != 0u) && (digits[count - 1u] == '0'))
+                {
+                    count--;
+                }
+                const int exponent = ((count == 0u) ? 0 : (decimal_point - 1));
+                exponent_notation = ((exponent < -4) || (exponent >= max_exponent));
+                if (exponent_notation)
+                {
+                    precision = ((count > 1u) ? static_cast<int>(count - 1u) : 0);
+                }
+                else
+                {
+                    precision = ((static_cast<int>(count) > decimal_point) ? (static_cast<int>(count) - decimal_point) : 0);
+                }
+                break;
+            }
+        }
+        if (count == 0u)
         {
-        	NANO_STL_LIBC_PutChar(str, fill);
-            str++;
-            num++;
-            width--;
+            decimal_point = (exponent_notation ? 1 : 0);
         }
 
-        /* Write sign */
-        if (value < 0)
+        /* Compute the length of the string */
+        const size_t fraction_length = ((precision > 0) ? (1u + static_cast<size_t>(precision)) : 0u);
+        const int exponent = decimal_point - 1;
+        const uint64_t absolute_exponent = static_cast<uint64_t>((exponent < 0) ? -exponent : exponent);
+        unsigned int exponent_length = 0u;
+        size_t length = (negative ? 1u : 0u) + fraction_length;
+        if (exponent_notation)
         {
-            num += NANO_STL_LIBC_PutChar(str, '-');
-            str++;
+            exponent_length = NANO_STL_LIBC_CountDigits(absolute_exponent);
+            if (exponent_length < 2u)
+            {
+                exponent_length = 2u;
+            }
+            length += 1u + 2u + exponent_length;
+        }
+        else
+        {
+            length += ((decimal_point > 0) ? static_cast<size_t>(decimal_point) : 1u);
+        }
+
+        /* Filler characters and sign */
+        const size_t fill_count = ((width > length) ? (width - length) : 0u);
+        if (negative && (fill == '0'))
+        {
+            NANO_STL_LIBC_PutChars(output, "-", 1u);
+            NANO_STL_LIBC_PutFill(output, fill, fill_count);
+        }
+        else
+        {
+            NANO_STL_LIBC_PutFill(output, fill, fill_count);
+            if (negative)
+            {
+                NANO_STL_LIBC_PutChars(output, "-", 1u);
+            }
+        }
+
+        /* Digits */
+        if (exponent_notation)
+        {
+            NANO_STL_LIBC_PutDigits(output, digits, count, 0, 1u);
+            if (precision > 0)
+            {
+                NANO_STL_LIBC_PutChars(output, ".", 1u);
+                NANO_STL_LIBC_PutDigits(output, digits, count, 1, static_cast<size_t>(precision));
+            }
+            NANO_STL_LIBC_PutChars(output, (maj ? "E" : "e"), 1u);
+            NANO_STL_LIBC_PutChars(output, ((exponent < 0) ? "-" : "+"), 1u);
+            NANO_STL_LIBC_PutDecimal(output, '0', exponent_length, -1, false, absolute_exponent);
+        }
+        else
+        {
+            if (decimal_point > 0)
+            {
+                NANO_STL_LIBC_PutDigits(output, digits, count, 0, static_cast<size_t>(decimal_point));
+            }
+            else
+            {
+                NANO_STL_LIBC_PutChars(output, "0", 1u);
+            }
+            if (precision > 0)
+            {
+                NANO_STL_LIBC_PutChars(output, ".", 1u);
+                NANO_STL_LIBC_PutDigits(output, digits, count, decimal_point, static_cast<size_t>(precision));
+            }
         }
     }
+}
 
-    /* Write lower digit */
-    num += NANO_STL_LIBC_PutChar(str, (absolute % 10u) + '0');
 
-    return num;
+/** \brief  Writes the given number of digits starting at the given index inside the given output string
+ *          (the digits outside of the generated ones are written as '0') */
+static void NANO_STL_LIBC_PutDigits(nano_stl_libc_output_t* const output, const char* digits, size_t count, int first, size_t length)
+{
+    /* Leading zeros */
+    if (first < 0)
+    {
+        const size_t zeros = ((static_cast<size_t>(-first) < length) ? static_cast<size_t>(-first) : length);
+        NANO_STL_LIBC_PutFill(output, '0', zeros);
+        length -= zeros;
+        first = 0;
+    }
+
+    /* Generated digits */
+    if (static_cast<size_t>(first) < count)
+    {
+        const size_t available = count - static_cast<size_t>(first);
+        const size_t written = ((available < length) ? available : length);
+        NANO_STL_LIBC_PutChars(output, &digits[first], written);
+        length -= written;
+    }
+
+    /* Trailing zeros */
+    NANO_STL_LIBC_PutFill(output, '0', length);
 }
 
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
 
-/** \brief  Writes an hexadecimal value into a string, using the given fill, width &
- *          capital parameters */
-static int NANO_STL_LIBC_PutHexa(char *str, char fill, int width, unsigned char maj, unsigned int value)
+/** \brief  Computes the number of decimal digits of an integer */
+static unsigned int NANO_STL_LIBC_CountDigits(const uint64_t value)
 {
-    int num = 0;
+    unsigned int count;
+
+#if defined(__GNUC__)
 
-    /* Decrement width */
-    width--;
+    /* Approximate the number of digits from the number of bits (log10(2) ~= 1233 / 4096),
+       then correct it with a single comparison */
+    const unsigned int bit_count = 64u - static_cast<unsigned int>(__builtin_clzll(value | 1u));
+    count = (bit_count * 1233u) >> 12u;
+    count = count + 1u - ((value < s_powers_of_10[count]) ? 1u : 0u);
+    if (count == 0u)
+    {
+        count = 1u;
+    }
+
+#else // __GNUC__
+
+    count = 1u;
+    while ((count < 20u) && (value >= s_powers_of_10[count]))
+    {
+        count++;
+    }
+
+#endif // __GNUC__
 
-    /* Recursively output upper digits */
-    if ((value >> 4) > 0)
+    return count;
+}
+
+/** \brief  Get the value of a digit char in the bases up to 36 (36 if the char is not a digit) */
+static inline unsigned int NANO_STL_LIBC_DigitValue(const char c)
+{
+    unsigned int digit = 36u;
+    if ((c >= '0') && (c <= '9'))
+    {
+        digit = static_cast<unsigned int>(c - '0');
+    }
+    else if ((c >= 'a') && (c <= 'z'))
+    {
+        digit = static_cast<unsigned int>(c - 'a') + 10u;
+    }
+    else if ((c >= 'A') && (c <= 'Z'))
     {
-        num += NANO_STL_LIBC_PutHexa(str, fill, width, maj, value >> 4);
-        str += num;
+        digit = static_cast<unsigned int>(c - 'A') + 10u;
     }
     else
+    {}
+    return digit;
+}
+
+/** \brief  Parses the digits of an unsigned integer in the given radix, returns true if the value does not fit in 64 bits */
+static bool NANO_STL_LIBC_ParseDigits(const char** str, size_t* size, const unsigned int radix, uint64_t* value)
+{
+    const char* s = (*str);
+    size_t remaining = (*size);
+    uint64_t v = 0u;
+    bool overflow = false;
+    bool done = false;
+
+// Check if word at a time string functions are enabled
+#if (NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED == 1)
+
+    /* Decimal digits are processed 8 at a time from aligned blocks (aligned reads never cross a page boundary), 
+       as long as the value cannot overflow */
+    bool swar = ((radix == 10u) && NANO_STL_LIBC_IsLittleEndian());
+    while (swar && (remaining != 0u))
     {
-    	/* Write filler chars */
-        while (width > 0)
+        const unsigned int offset = static_cast<unsigned int>(reinterpret_cast<uintptr_t>(s) & 7u);
+        const nano_stl_libc_block_t* const block = reinterpret_cast<const nano_stl_libc_block_t*>(s - offset);
+        const unsigned int available = 8u - offset;
+
+        /* Bytes which are not digits (including the ones shifted in) have a non null high nibble after subtracting '0' 
+           or after adding 6 (the carries only disturb the bytes following the first non digit) */
+        const uint64_t digits = (((*block) >> (8u * offset)) ^ 0x3030303030303030u);
+        const uint64_t non_digits = ((digits | (digits + 0x0606060606060606u)) & 0xF0F0F0F0F0F0F0F0u);
+        unsigned int count = ((non_digits == 0u) ? 8u : (NANO_STL_LIBC_CountTrailingZeros(non_digits) / 8u));
+        if (count > remaining)
         {
-        	NANO_STL_LIBC_PutChar(str, fill);
-            str++;
-            num++;
-            width--;
+            count = static_cast<unsigned int>(remaining);
+        }
+        if ((count != 0u) && (v < s_powers_of_10[19u - count]))
+        {
+            /* Move the digits in the most significant bytes so that the missing leading digits are zeros */
+            v = (v * s_powers_of_10[count]) + NANO_STL_LIBC_ParseBlock(digits << (8u * (8u - count)));
+            s += count;
+            remaining -= count;
+            swar = (count == available);
+        }
+        else
+        {
+            swar = false;
         }
     }
 
-    /* Write current digit */
-    if ((value & 0x0Fu) < 10u)
+#endif // NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED
+
+    /* Remaining digits one by one with overflow check */
+    while (!done && (remaining != 0u))
     {
-    	NANO_STL_LIBC_PutChar(str, (value & 0x0Fu) + '0');
+        const unsigned int digit = NANO_STL_LIBC_DigitValue(*s);
+        if (digit < radix)
+        {
+            if ((v >> 58u) == 0u)
+            {
+                v = (v * radix) + digit;
+            }
+            else if (v <= ((static_cast<uint64_t>(-1) - digit) / radix))
+            {
+                v = (v * radix) + digit;
+            }
+            else
+            {
+                v = static_cast<uint64_t>(-1);
+                overflow = true;
+            }
+            s++;
+            remaining--;
+        }
+        else
+        {
+            done = true;
+        }
+    }
+
+    (*str) = s;
+    (*size) = remaining;
+    (*value) = v;
+
+    return overflow;
+}
+
+
+/** \brief  Writes the decimal digits of an integer backward from the given end of string */
+static void NANO_STL_LIBC_WriteDecimal(char* end, uint64_t value)
+{
+    /* 64 bits divisions are only performed on large values to process 8 digits at a time */
+    while (value > 0xFFFFFFFFu)
+    {
+        const uint64_t quotient = value / 100000000u;
+        end = NANO_STL_LIBC_WriteDecimal8(end, static_cast<uint32_t>(value - (quotient * 100000000u)));
+        value = quotient;
     }
-    else if (maj)
+
+    /* 2 digits per division */
+    uint32_t value32 = static_cast<uint32_t>(value);
+    while (value32 >= 100u)
     {
-    	NANO_STL_LIBC_PutChar(str, (value & 0x0Fu) - 10u + 'A');
+        const uint32_t index = (value32 % 100u) * 2u;
+        value32 /= 100u;
+        end -= 2;
+        end[0u] = s_digits_lut[index];
+        end[1u] = s_digits_lut[index + 1u];
+    }
+    if (value32 >= 10u)
+    {
+        end -= 2;
+        end[0u] = s_digits_lut[value32 * 2u];
+        end[1u] = s_digits_lut[(value32 * 2u) + 1u];
     }
     else
     {
-    	NANO_STL_LIBC_PutChar(str, (value & 0x0Fu) - 10u + 'a');
+        end--;
+        (*end) = static_cast<char>('0' + value32);
     }
-    num++;
+}
+
 
-    return num;
+/** \brief  Writes exactly 8 decimal digits of an integer backward from the given end of string */
+static char* NANO_STL_LIBC_WriteDecimal8(char* end, uint32_t value)
+{
+    for (unsigned int i = 0u; i < 4u; i++)
+    {
+        const uint32_t index = (value % 100u) * 2u;
+        value /= 100u;
+        end -= 2;
+        end[0u] = s_digits_lut[index];
+        end[1u] = s_digits_lut[index + 1u];
+    }
+    return end;
 }
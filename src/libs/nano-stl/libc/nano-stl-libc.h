@@ -29,45 +29,85 @@ extern "C"
 #endif /* __cplusplus */
 
 
-/** \brief Highly portable but non-efficient memset function */
+/** \brief Result of the integer conversions with overflow report */
+typedef enum _nano_stl_libc_conv_result_t
+{
+    /** \brief Successful conversion */
+    NANO_STL_LIBC_CONV_OK = 0,
+    /** \brief No digits to convert */
+    NANO_STL_LIBC_CONV_INVALID = 1,
+    /** \brief Value out of range (the converted value is saturated) */
+    NANO_STL_LIBC_CONV_OVERFLOW = 2
+} nano_stl_libc_conv_result_t;
+
+
+/** \brief Highly portable memset function (word at a time if NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED) */
 void* NANO_STL_LIBC_Memset(void* const dst, const int val, size_t size);
 
-/** \brief Highly portable but non-efficient memcpy function */
+/** \brief Highly portable memcpy function (word at a time if NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED) */
 void* NANO_STL_LIBC_Memcpy(void* const dst, const void* const src, size_t size);
 
-/** \brief Highly portable but non-efficient memcmp function */
+/** \brief Highly portable memcmp function (word at a time if NANO_STL_LIBC_WORD_MEMORY_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED) */
 int NANO_STL_LIBC_Memcmp(const void* const s1, const void* const s2, size_t size);
 
-/** \brief Highly portable but non-efficient strncmp function */
+/** \brief Highly portable strncmp function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED),
+ *         the chars are compared as unsigned chars like the standard strncmp */
 int NANO_STL_LIBC_Strncmp(const char* s1, const char* s2, size_t size);
 
-/** \brief Highly portable but non-efficient strnlen function */
+/** \brief Highly portable strnlen function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED, SSE2/AVX2 if NANO_STL_LIBC_SIMD_ENABLED) */
 size_t NANO_STL_LIBC_Strnlen(const char* s, size_t maxlen);
 
-/** \brief Highly portable but non-efficient strncat function */
+/** \brief Highly portable strncat function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED) */
 char* NANO_STL_LIBC_Strncat(char *dest, const char *src, size_t size);
 
-/** \brief Highly portable but non-efficient strncpy function */
+/** \brief Highly portable strncpy function (word at a time if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED) */
 char* NANO_STL_LIBC_Strncpy(char *dest, const char *src, size_t size);
 
-/** \brief Highly portable but non-efficient vsnprintf function */
+/** \brief Highly portable vsnprintf function (%d %i %u %x %X %p %s %c conversions, %f %F %e %E %g %G if NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED) */
 int NANO_STL_LIBC_Vsnprintf(char *str, size_t size, const char *format, va_list ap);
 
-/** \brief Highly portable but non-efficient snprintf function */
+/** \brief Highly portable snprintf function (%d %i %u %x %X %p %s %c conversions, %f %F %e %E %g %G if NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED) */
 int NANO_STL_LIBC_Snprintf(char *str, size_t size, const char *format, ...);
 
-/** \brief Higly portable but non-efficient atoi function */
+// Check if floating point formatting is enabled
+#if (NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED == 1)
+
+/** \brief Highly portable dtoa function (shortest representation which reads back to the same value) */
+int NANO_STL_LIBC_Dtoa(double value, char* str, size_t size);
+
+#endif // NANO_STL_LIBC_FLOAT_FORMATTING_ENABLED
+
+/** \brief Highly portable atoi function (SWAR if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED) */
 int NANO_STL_LIBC_Atoi(const char* str);
 
 /** \brief Higly portable but non-efficient itoa function */
 char* NANO_STL_LIBC_Itoa(int value, char * str, int base);
 
-/** \brief Highly portable but non-efficient atof function */
+/** \brief Highly portable atof function (correctly rounded, Eisel-Lemire if NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED) */
 double NANO_STL_LIBC_Atof(const char* nptr);
 
-/** \brief Highly portable but non-efficient atoi function with radix and string length check */
+/** \brief Highly portable strtod like function with string length check (correctly rounded, Eisel-Lemire if NANO_STL_LIBC_FAST_FLOAT_PARSING_ENABLED)
+ *         (accepts an optional sign, decimal digits with an optional decimal point and exponent, "inf", "infinity" and "nan",
+ *          end receives the address of the first char after the number, or str if no conversion can be performed) */
+double NANO_STL_LIBC_Antof(const char* str, size_t size, const char** end);
+
+/** \brief Highly portable atoi function with radix (2 to 36) and string length check (saturated on overflow, SWAR in base 10 if NANO_STL_LIBC_WORD_STRING_FUNCTIONS_ENABLED) */
 int NANO_STL_LIBC_Antoi(const char* str, const int radix, size_t size);
 
+/** \brief Highly portable 64 bits atoi function with radix (2 to 36) and string length check (saturated on overflow) */
+int64_t NANO_STL_LIBC_Antoll(const char* str, const int radix, size_t size);
+
+/** \brief Highly portable unsigned 64 bits atoi function with radix (2 to 36) and string length check (saturated on overflow) */
+uint64_t NANO_STL_LIBC_Antoull(const char* str, const int radix, size_t size);
+
+/** \brief Highly portable strtoll like function with radix (2 to 36), string length check and overflow report
+ *         (value and end are optional, end receives the address of the first char after the digits, or str if no conversion can be performed) */
+nano_stl_libc_conv_result_t NANO_STL_LIBC_Antoi64(const char* str, const int radix, size_t size, int64_t* value, const char** end);
+
+/** \brief Highly portable strtoull like function with radix (2 to 36), string length check and overflow report (a '-' sign is rejected)
+ *         (value and end are optional, end receives the address of the first char after the digits, or str if no conversion can be performed) */
+nano_stl_libc_conv_result_t NANO_STL_LIBC_Antou64(const char* str, const int radix, size_t size, uint64_t* value, const char** end);
+
 
 #ifdef __cplusplus
 }
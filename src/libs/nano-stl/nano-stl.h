@@ -29,7 +29,14 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 #include "StaticVector.h"
 #include "StaticList.h"
 #include "StaticMap.h"
+#include "StaticSlimMap.h"
+#include "StaticHashMap.h"
+#include "StaticFlatMap.h"
+#include "StaticBTree.h"
+#include "StaticFrozenMap.h"
+#include "StaticSortedIndex.h"
 #include "StaticQueue.h"
+#include "StaticRingBuffer.h"
 
 #include "StaticBSTree.h"
 
@@ -56,6 +56,17 @@ class StaticString : public StringBase
 
 };
 
+
+/** \brief Default three-way comparator of the binary search trees and maps keys : static string keys (same comparison as the string keys) */
+template <nano_stl_size_t MAX_CHAR_COUNT>
+struct Compare<StaticString<MAX_CHAR_COUNT> > : public Compare<IString>
+{};
+
+/** \brief Default hasher of the hash maps keys : static string keys (same hash as the string keys) */
+template <nano_stl_size_t MAX_CHAR_COUNT>
+struct Hash<StaticString<MAX_CHAR_COUNT> > : public Hash<IString>
+{};
+
 }
 
 #endif // STATICSTRING_H
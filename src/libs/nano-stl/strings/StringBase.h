@@ -22,6 +22,7 @@ along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "IString.h"
 #include "IErrorHandler.h"
+#include "StringFormat.h"
 
 
 namespace nano_stl
@@ -73,11 +74,13 @@ class StringBase : public IString
 
 #endif // NANO_STL_ITERATORS_ENABLED
         {
-            // Update iterators
+            // Copy initial string
             if (m_length > m_size)
             {
                 m_length = m_size;
             }
+            NANO_STL_MEMCPY(m_c_str, init_str, m_length);
+            m_c_str[m_length] = 0;
 
             // Check if iterators are enabled
             #if (NANO_STL_ITERATORS_ENABLED == 1)
@@ -263,6 +266,39 @@ class StringBase : public IString
             }
         }
 
+// Check C++ version >= C++11
+#if (__cplusplus >= 201103L)
+
+        /** \brief Format a string with a format string compiled with NANO_STL_FORMAT() : 
+         *         the arguments are type-checked at compile time and directly written without parsing the format string at runtime */
+        template <typename FormatType, typename... ArgTypes>
+        void format(const FormatString<FormatType>& format, const ArgTypes&... args)
+        {
+            const nano_stl_size_t length = format.write(m_c_str, m_size, args...);
+
+            // Check if iterators are enabled
+            #if (NANO_STL_ITERATORS_ENABLED == 1)
+
+            if (length == 0u)
+            {
+                m_begin = typename IArray<char>::Iterator(*this, IIteratorBase<char>::INVALID_POSITION);
+                m_const_begin = m_begin;
+            }
+            else if (m_length == 0u)
+            {
+                m_begin = typename IArray<char>::Iterator(*this, 0u);
+                m_const_begin = m_begin;
+            }
+            else
+            {}
+
+            #endif // NANO_STL_ITERATORS_ENABLED
+
+            m_length = length;
+        }
+
+#endif // __cplusplus
+
         
         /** \brief Copy operator */
         virtual IString& operator = (const IString& copy) override
@@ -310,16 +346,12 @@ class StringBase : public IString
             nano_stl_size_t copy_size = str.getLenght();
             if ((m_size - m_length) < copy_size)
             {
-                m_length = m_size;
                 copy_size = m_size - m_length;
             }
-            else
-            {
-                m_length += copy_size;
-            }
 
             // Copy new string
             NANO_STL_MEMCPY(&m_c_str[m_length], str.cStr(), copy_size);
+            m_length += copy_size;
 
             // Terminate string
             m_c_str[m_length] = 0;
@@ -371,7 +403,10 @@ class StringBase : public IString
         }
 
         /** \brief Compare operator */
-        virtual bool operator < (const IString& str) const override { return !(this->operator>(str)); }
+        virtual bool operator < (const IString& str) const override
+        {
+            return (NANO_STL_STRNCMP(m_c_str, str.cStr(), m_size) < 0);
+        }
 
 
         ////// Implementation of StringBase methods //////
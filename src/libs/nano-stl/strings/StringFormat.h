@@ -0,0 +1,1001 @@
+/*
+Copyright(c) 2017 Cedric Jimenez
+
+This file is part of Nano-STL.
+
+Nano-STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+Nano-STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with Nano-STL.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef STRINGFORMAT_H
+#define STRINGFORMAT_H
+
+#include "IString.h"
+
+
+// Check C++ version >= C++11
+#if (__cplusplus >= 201103L)
+
+
+/** \brief Compile a format string literal for the StringBase::format() and FormatString::write() methods
+ *         The format is parsed at compile time with the same syntax as NANO_STL_VSNPRINTF : 
+ *         %[0][width][.precision][hh|h|l|ll|z]conversion with conversion in d, i, u, x, X, p, s, c, f, F, e, E, g, G and %%
+ *         (the length modifiers are accepted but the integer size is given by the type of the argument) */
+#define NANO_STL_FORMAT(format_str)     ([]() \
+                                        { \
+                                            struct NanoStlFormat { static constexpr const char* str() { return (format_str); } }; \
+                                            return nano_stl::FormatString<NanoStlFormat>(); \
+                                        }())
+
+
+namespace nano_stl
+{
+
+template <nano_stl_size_t MAX_CHAR_COUNT>
+class StaticString;
+
+
+/** \brief Categories of the conversions of a format string */
+enum FormatCategory
+{
+    /** \brief No conversion (end of the format string) */
+    FORMAT_CATEGORY_NONE = 0,
+    /** \brief Escaped '%' */
+    FORMAT_CATEGORY_PERCENT = 1,
+    /** \brief Signed decimal integer (d, i) */
+    FORMAT_CATEGORY_SIGNED = 2,
+    /** \brief Unsigned decimal integer (u) */
+    FORMAT_CATEGORY_UNSIGNED = 3,
+    /** \brief Hexadecimal integer (x, X) */
+    FORMAT_CATEGORY_HEXA = 4,
+    /** \brief Pointer (p) */
+    FORMAT_CATEGORY_POINTER = 5,
+    /** \brief String (s) */
+    FORMAT_CATEGORY_STRING = 6,
+    /** \brief Char (c) */
+    FORMAT_CATEGORY_CHAR = 7,
+    /** \brief Floating point number (f, F, e, E, g, G) */
+    FORMAT_CATEGORY_FLOAT = 8,
+    /** \brief Invalid conversion */
+    FORMAT_CATEGORY_INVALID = 9
+};
+
+/** \brief Kinds of the arguments of a format string */
+enum FormatArgKind
+{
+    /** \brief Type which can't be formatted */
+    FORMAT_ARG_NONE = 0,
+    /** \brief Integer type */
+    FORMAT_ARG_INTEGER = 1,
+    /** \brief Floating point type */
+    FORMAT_ARG_FLOAT = 2,
+    /** \brief C string or IString */
+    FORMAT_ARG_STRING = 3,
+    /** \brief Pointer */
+    FORMAT_ARG_POINTER = 4
+};
+
+/** \brief Maximum length of a formatted output which can't be bounded at compile time */
+static const nano_stl_size_t FORMAT_UNBOUNDED_LENGTH = static_cast<nano_stl_size_t>(-1);
+
+
+/** \brief Compile-time parser of the format strings */
+class FormatParser
+{
+    public:
+
+        /** \brief Get the position of the first '%' or of the null terminator from the given position */
+        static constexpr nano_stl_size_t findSpec(const char* format, const nano_stl_size_t pos)
+        {
+            return (((format[pos] == 0) || (format[pos] == '%')) ? pos : findSpec(format, pos + 1u));
+        }
+
+        /** \brief Get the position following the digits starting at the given position */
+        static constexpr nano_stl_size_t skipDigits(const char* format, const nano_stl_size_t pos)
+        {
+            return (((format[pos] >= '0') && (format[pos] <= '9')) ? skipDigits(format, pos + 1u) : pos);
+        }
+
+        /** \brief Get the value of the digits between the given positions (saturated as in NANO_STL_VSNPRINTF) */
+        static constexpr nano_stl_size_t parseNumber(const char* format, const nano_stl_size_t pos, const nano_stl_size_t end, const nano_stl_size_t value)
+        {
+            return ((pos == end) ? value : 
+                    parseNumber(format, pos + 1u, end, ((value < 0xFFFFu) ? ((value * 10u) + static_cast<nano_stl_size_t>(format[pos] - '0')) : value)));
+        }
+
+        /** \brief Get the position following the length modifier starting at the given position */
+        static constexpr nano_stl_size_t skipLength(const char* format, const nano_stl_size_t pos)
+        {
+            return ((((format[pos] == 'l') && (format[pos + 1u] == 'l')) || ((format[pos] == 'h') && (format[pos + 1u] == 'h'))) ? (pos + 2u) :
+                    (((format[pos] == 'l') || (format[pos] == 'h') || (format[pos] == 'z')) ? (pos + 1u) : pos));
+        }
+
+        /** \brief Get the position of the fill flag of the specification starting at the given '%' position */
+        static constexpr nano_stl_size_t fillPos(const char* format, const nano_stl_size_t spec)
+        {
+            return ((format[spec] == 0) ? spec : (spec + 1u));
+        }
+
+        /** \brief Get the position of the width of the specification starting at the given '%' position */
+        static constexpr nano_stl_size_t widthPos(const char* format, const nano_stl_size_t spec)
+        {
+            return ((format[fillPos(format, spec)] == '0') ? (fillPos(format, spec) + 1u) : fillPos(format, spec));
+        }
+
+        /** \brief Get the position of the precision of the specification starting at the given '%' position */
+        static constexpr nano_stl_size_t precisionPos(const char* format, const nano_stl_size_t spec)
+        {
+            return skipDigits(format, widthPos(format, spec));
+        }
+
+        /** \brief Get the position of the length modifier of the specification starting at the given '%' position */
+        static constexpr nano_stl_size_t lengthPos(const char* format, const nano_stl_size_t spec)
+        {
+            return ((format[precisionPos(format, spec)] == '.') ? skipDigits(format, precisionPos(format, spec) + 1u) : precisionPos(format, spec));
+        }
+
+        /** \brief Get the position of the conversion of the specification starting at the given '%' position */
+        static constexpr nano_stl_size_t conversionPos(const char* format, const nano_stl_size_t spec)
+        {
+            return skipLength(format, lengthPos(format, spec));
+        }
+
+        /** \brief Get the position following the specification starting at the given '%' position */
+        static constexpr nano_stl_size_t specEnd(const char* format, const nano_stl_size_t spec)
+        {
+            return ((format[conversionPos(format, spec)] == 0) ? conversionPos(format, spec) : (conversionPos(format, spec) + 1u));
+        }
+
+        /** \brief Get the fill char of the specification starting at the given '%' position */
+        static constexpr char fill(const char* format, const nano_stl_size_t spec)
+        {
+            return ((widthPos(format, spec) != fillPos(format, spec)) ? '0' : ' ');
+        }
+
+        /** \brief Get the width of the specification starting at the given '%' position */
+        static constexpr nano_stl_size_t width(const char* format, const nano_stl_size_t spec)
+        {
+            return parseNumber(format, widthPos(format, spec), precisionPos(format, spec), 0u);
+        }
+
+        /** \brief Get the precision of the specification starting at the given '%' position (-1 if not specified) */
+        static constexpr int precision(const char* format, const nano_stl_size_t spec)
+        {
+            return ((format[precisionPos(format, spec)] == '.') ? 
+                    static_cast<int>(parseNumber(format, precisionPos(format, spec) + 1u, lengthPos(format, spec), 0u)) : -1);
+        }
+
+        /** \brief Get the category of a conversion */
+        static constexpr FormatCategory category(const char conversion)
+        {
+            return ((conversion == 0) ? FORMAT_CATEGORY_NONE : 
+                    (conversion == '%') ? FORMAT_CATEGORY_PERCENT : 
+                    ((conversion == 'd') || (conversion == 'i')) ? FORMAT_CATEGORY_SIGNED : 
+                    (conversion == 'u') ? FORMAT_CATEGORY_UNSIGNED : 
+                    ((conversion == 'x') || (conversion == 'X')) ? FORMAT_CATEGORY_HEXA : 
+                    (conversion == 'p') ? FORMAT_CATEGORY_POINTER : 
+                    (conversion == 's') ? FORMAT_CATEGORY_STRING : 
+                    (conversion == 'c') ? FORMAT_CATEGORY_CHAR : 
+                    ((conversion == 'f') || (conversion == 'F') || (conversion == 'e') || 
+                     (conversion == 'E') || (conversion == 'g') || (conversion == 'G')) ? FORMAT_CATEGORY_FLOAT : FORMAT_CATEGORY_INVALID);
+        }
+
+        /** \brief Get the position of the literal text of a piece (a piece is a literal text followed by a specification) */
+        static constexpr nano_stl_size_t pieceStart(const char* format, const nano_stl_size_t piece)
+        {
+            return ((piece == 0u) ? 0u : specEnd(format, findSpec(format, pieceStart(format, piece - 1u))));
+        }
+
+        /** \brief Get the number of pieces from the given position */
+        static constexpr nano_stl_size_t pieceCount(const char* format, const nano_stl_size_t pos)
+        {
+            return ((format[findSpec(format, pos)] == 0) ? 1u : (1u + pieceCount(format, specEnd(format, findSpec(format, pos)))));
+        }
+
+        /** \brief Check if the conversion of a piece consumes an argument */
+        static constexpr bool hasArgument(const char* format, const nano_stl_size_t piece)
+        {
+            return (category(format[conversionPos(format, findSpec(format, pieceStart(format, piece)))]) > FORMAT_CATEGORY_PERCENT);
+        }
+
+        /** \brief Get the number of arguments consumed by the pieces preceding the given piece */
+        static constexpr nano_stl_size_t argumentIndex(const char* format, const nano_stl_size_t piece)
+        {
+            return ((piece == 0u) ? 0u : (argumentIndex(format, piece - 1u) + (hasArgument(format, piece - 1u) ? 1u : 0u)));
+        }
+
+        /** \brief Add 2 lengths (saturated to FORMAT_UNBOUNDED_LENGTH) */
+        static constexpr nano_stl_size_t addLength(const nano_stl_size_t length1, const nano_stl_size_t length2)
+        {
+            return (((length1 == FORMAT_UNBOUNDED_LENGTH) || (length2 == FORMAT_UNBOUNDED_LENGTH)) ? FORMAT_UNBOUNDED_LENGTH : (length1 + length2));
+        }
+
+        /** \brief Get the length of a field padded to the given width */
+        static constexpr nano_stl_size_t padLength(const nano_stl_size_t length, const nano_stl_size_t width)
+        {
+            return ((length >= width) ? length : width);
+        }
+};
+
+
+/** \brief Parsed piece of a format string : a literal text followed by a specification */
+template <typename FormatType, nano_stl_size_t INDEX>
+struct FormatPiece
+{
+    /** \brief Format string */
+    typedef FormatType Format;
+
+    /** \brief Position of the literal text */
+    static constexpr nano_stl_size_t LITERAL_START = FormatParser::pieceStart(FormatType::str(), INDEX);
+
+    /** \brief Position of the specification */
+    static constexpr nano_stl_size_t SPEC_START = FormatParser::findSpec(FormatType::str(), LITERAL_START);
+
+    /** \brief Position following the specification */
+    static constexpr nano_stl_size_t SPEC_END = FormatParser::specEnd(FormatType::str(), SPEC_START);
+
+    /** \brief Length of the literal text */
+    static constexpr nano_stl_size_t LITERAL_LENGTH = SPEC_START - LITERAL_START;
+
+    /** \brief Conversion */
+    static constexpr char CONVERSION = FormatType::str()[FormatParser::conversionPos(FormatType::str(), SPEC_START)];
+
+    /** \brief Conversion category */
+    static constexpr FormatCategory CATEGORY = FormatParser::category(CONVERSION);
+
+    /** \brief Fill char */
+    static constexpr char FILL = FormatParser::fill(FormatType::str(), SPEC_START);
+
+    /** \brief Width */
+    static constexpr nano_stl_size_t WIDTH = FormatParser::width(FormatType::str(), SPEC_START);
+
+    /** \brief Precision (-1 if not specified) */
+    static constexpr int PRECISION = FormatParser::precision(FormatType::str(), SPEC_START);
+
+    /** \brief Index of the argument of the conversion */
+    static constexpr nano_stl_size_t ARG_INDEX = FormatParser::argumentIndex(FormatType::str(), INDEX);
+
+
+    static_assert(CATEGORY != FORMAT_CATEGORY_INVALID, "Invalid conversion in format string");
+    static_assert((CATEGORY != FORMAT_CATEGORY_PERCENT) || (SPEC_END == (SPEC_START + 2u)), "Invalid escaped '%' in format string");
+};
+
+
+/** \brief Sequence of indexes */
+template <nano_stl_size_t... INDEXES>
+struct FormatIndexes
+{};
+
+/** \brief Build the sequence of indexes from 0 to COUNT - 1 */
+template <nano_stl_size_t COUNT, nano_stl_size_t... INDEXES>
+struct FormatMakeIndexes
+{
+    typedef typename FormatMakeIndexes<COUNT - 1u, COUNT - 1u, INDEXES...>::Type Type;
+};
+template <nano_stl_size_t... INDEXES>
+struct FormatMakeIndexes<0u, INDEXES...>
+{
+    typedef FormatIndexes<INDEXES...> Type;
+};
+
+
+/** \brief Null terminated copy of a part of a format string */
+template <typename FormatType, nano_stl_size_t START, typename Indexes>
+struct FormatText;
+template <typename FormatType, nano_stl_size_t START, nano_stl_size_t... INDEXES>
+struct FormatText<FormatType, START, FormatIndexes<INDEXES...> >
+{
+    /** \brief Text */
+    static constexpr char TEXT[sizeof...(INDEXES) + 1u] = { FormatType::str()[START + INDEXES]..., 0 };
+};
+template <typename FormatType, nano_stl_size_t START, nano_stl_size_t... INDEXES>
+constexpr char FormatText<FormatType, START, FormatIndexes<INDEXES...> >::TEXT[sizeof...(INDEXES) + 1u];
+
+
+/** \brief Access to an argument of a format string */
+template <nano_stl_size_t INDEX, typename... ArgTypes>
+struct FormatArgument;
+template <nano_stl_size_t INDEX, typename FirstType, typename... OtherTypes>
+struct FormatArgument<INDEX, FirstType, OtherTypes...>
+{
+    /** \brief Type of the argument */
+    typedef typename FormatArgument<INDEX - 1u, OtherTypes...>::Type Type;
+
+    /** \brief Get the argument */
+    static const Type& get(const FirstType&, const OtherTypes&... others) { return FormatArgument<INDEX - 1u, OtherTypes...>::get(others...); }
+};
+template <typename FirstType, typename... OtherTypes>
+struct FormatArgument<0u, FirstType, OtherTypes...>
+{
+    /** \brief Type of the argument */
+    typedef FirstType Type;
+
+    /** \brief Get the argument */
+    static const Type& get(const FirstType& first, const OtherTypes&...) { return first; }
+};
+
+
+/** \brief Integer types used to format the integers of a given size (the unsigned type is at least 32 bits wide) */
+template <nano_stl_size_t SIZE>
+struct FormatInteger;
+template <>
+struct FormatInteger<1u>
+{
+    typedef int8_t Signed;
+    typedef uint32_t Unsigned;
+    static constexpr uint32_t MASK = 0xFFu;
+    static constexpr nano_stl_size_t DECIMAL_LENGTH = 3u;
+};
+template <>
+struct FormatInteger<2u>
+{
+    typedef int16_t Signed;
+    typedef uint32_t Unsigned;
+    static constexpr uint32_t MASK = 0xFFFFu;
+    static constexpr nano_stl_size_t DECIMAL_LENGTH = 5u;
+};
+template <>
+struct FormatInteger<4u>
+{
+    typedef int32_t Signed;
+    typedef uint32_t Unsigned;
+    static constexpr uint32_t MASK = 0xFFFFFFFFu;
+    static constexpr nano_stl_size_t DECIMAL_LENGTH = 10u;
+};
+template <>
+struct FormatInteger<8u>
+{
+    typedef int64_t Signed;
+    typedef uint64_t Unsigned;
+    static constexpr uint64_t MASK = static_cast<uint64_t>(-1);
+    static constexpr nano_stl_size_t DECIMAL_LENGTH = 20u;
+};
+
+
+/** \brief Characteristics of the types which can be used as format string arguments (IString derived classes and unsupported types) */
+template <typename ArgType>
+struct FormatArgTraits
+{
+    private:
+
+        /** \brief Overloads used to detect the IString derived classes */
+        static char isString(const IString*);
+        static long isString(...);
+
+    public:
+
+        /** \brief Kind of argument */
+        static constexpr FormatArgKind KIND = ((sizeof(isString(static_cast<const ArgType*>(nullptr))) == sizeof(char)) ? FORMAT_ARG_STRING : FORMAT_ARG_NONE);
+
+        /** \brief Maximum length of the string */
+        static constexpr nano_stl_size_t MAX_LENGTH = FORMAT_UNBOUNDED_LENGTH;
+};
+
+/** \brief Characteristics of the integer types which can be used as format string arguments */
+struct FormatIntegerArgTraits
+{
+    /** \brief Kind of argument */
+    static constexpr FormatArgKind KIND = FORMAT_ARG_INTEGER;
+};
+template <> struct FormatArgTraits<bool> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<char> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<signed char> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<unsigned char> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<short> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<unsigned short> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<int> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<unsigned int> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<long> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<unsigned long> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<long long> : public FormatIntegerArgTraits {};
+template <> struct FormatArgTraits<unsigned long long> : public FormatIntegerArgTraits {};
+
+/** \brief Characteristics of the floating point types which can be used as format string arguments */
+template <> struct FormatArgTraits<float> { static constexpr FormatArgKind KIND = FORMAT_ARG_FLOAT; };
+template <> struct FormatArgTraits<double> { static constexpr FormatArgKind KIND = FORMAT_ARG_FLOAT; };
+
+/** \brief Characteristics of the pointers which can be used as format string arguments */
+template <typename PointedType>
+struct FormatArgTraits<PointedType*>
+{
+    /** \brief Kind of argument */
+    static constexpr FormatArgKind KIND = FORMAT_ARG_POINTER;
+};
+
+/** \brief Check if a format argument is a pointer : any pointer can be written with the %p conversion, 
+ *         including the C strings which are string arguments for the other conversions */
+template <typename ArgType>
+struct FormatArgIsPointer
+{
+    /** \brief Indicate if the argument is a pointer */
+    static constexpr bool value = false;
+};
+
+/** \brief Check if a format argument is a pointer : pointers */
+template <typename PointedType>
+struct FormatArgIsPointer<PointedType*>
+{
+    /** \brief Indicate if the argument is a pointer */
+    static constexpr bool value = true;
+};
+
+/** \brief Characteristics of the C strings which can be used as format string arguments */
+template <> 
+struct FormatArgTraits<char*>
+{
+    /** \brief Kind of argument */
+    static constexpr FormatArgKind KIND = FORMAT_ARG_STRING;
+
+    /** \brief Maximum length of the string */
+    static constexpr nano_stl_size_t MAX_LENGTH = FORMAT_UNBOUNDED_LENGTH;
+};
+template <> struct FormatArgTraits<const char*> : public FormatArgTraits<char*> {};
+
+/** \brief Characteristics of the char arrays (string literals) which can be used as format string arguments */
+template <nano_stl_size_t SIZE>
+struct FormatArgTraits<char[SIZE]>
+{
+    /** \brief Kind of argument */
+    static constexpr FormatArgKind KIND = FORMAT_ARG_STRING;
+
+    /** \brief Maximum length of the string */
+    static constexpr nano_stl_size_t MAX_LENGTH = SIZE - 1u;
+};
+
+/** \brief Characteristics of the static strings which can be used as format string arguments */
+template <nano_stl_size_t MAX_CHAR_COUNT>
+struct FormatArgTraits<StaticString<MAX_CHAR_COUNT> >
+{
+    /** \brief Kind of argument */
+    static constexpr FormatArgKind KIND = FORMAT_ARG_STRING;
+
+    /** \brief Maximum length of the string */
+    static constexpr nano_stl_size_t MAX_LENGTH = MAX_CHAR_COUNT;
+};
+
+/** \brief Maximum length of a string format argument (the other kinds of arguments have no maximum length 
+ *         and are rejected by the string conversion) */
+template <typename ArgType, bool IS_STRING = (FormatArgTraits<ArgType>::KIND == FORMAT_ARG_STRING)>
+struct FormatArgMaxLength
+{
+    /** \brief Maximum length of the string */
+    static constexpr nano_stl_size_t value = FormatArgTraits<ArgType>::MAX_LENGTH;
+};
+
+/** \brief Maximum length of a string format argument : not a string */
+template <typename ArgType>
+struct FormatArgMaxLength<ArgType, false>
+{
+    /** \brief Maximum length of the string */
+    static constexpr nano_stl_size_t value = 0u;
+};
+
+
+/** \brief Output string of the compiled formats 
+ *         (the free space is checked before each write only if CHECKED is true) */
+template <bool CHECKED>
+class FormatOutput
+{
+    public:
+
+        /** \brief Constructor (size is the number of chars excluding the null terminator) */
+        FormatOutput(char* str, const nano_stl_size_t size)
+        : m_str(str)
+        , m_current(str)
+        , m_end(str + size)
+        {}
+
+        /** \brief Get the number of chars written */
+        nano_stl_size_t getLength() const { return static_cast<nano_stl_size_t>(m_current - m_str); }
+
+        /** \brief Get the number of chars which can still be written */
+        nano_stl_size_t getFreeSpace() const { return static_cast<nano_stl_size_t>(m_end - m_current); }
+
+        /** \brief Get the current write position */
+        char* getCurrent() { return m_current; }
+
+        /** \brief Move the current write position after chars which have been directly written */
+        void advance(const nano_stl_size_t count) { m_current += count; }
+
+        /** \brief Write a literal text of length known at compile time */
+        template <nano_stl_size_t LENGTH>
+        void putLiteral(const char* text)
+        {
+            putShort(text, LENGTH);
+        }
+
+        /** \brief Write a short sequence of chars */
+        void putShort(const char* chars, nano_stl_size_t count)
+        {
+            count = clamp(count);
+            for (nano_stl_size_t i = 0u; i < count; i++)
+            {
+                m_current[i] = chars[i];
+            }
+            m_current += count;
+        }
+
+        /** \brief Write chars */
+        void putChars(const char* chars, nano_stl_size_t count)
+        {
+            count = clamp(count);
+            NANO_STL_MEMCPY(m_current, chars, count);
+            m_current += count;
+        }
+
+        /** \brief Write a char repeated the given number of times */
+        void putFill(const char fill, nano_stl_size_t count)
+        {
+            count = clamp(count);
+            NANO_STL_MEMSET(m_current, fill, count);
+            m_current += count;
+        }
+
+
+    private:
+
+        /** \brief Beginning of the output string */
+        char* const m_str;
+
+        /** \brief Current write position */
+        char* m_current;
+
+        /** \brief End of the output string */
+        char* const m_end;
+
+
+        /** \brief Limit a number of chars to the free space */
+        nano_stl_size_t clamp(const nano_stl_size_t count) const
+        {
+            nano_stl_size_t ret = count;
+            if (CHECKED && (count > getFreeSpace()))
+            {
+                ret = getFreeSpace();
+            }
+            return ret;
+        }
+};
+
+
+/** \brief Writers of the conversions of a format string */
+template <typename Piece, FormatCategory CATEGORY = Piece::CATEGORY>
+struct FormatConversion;
+
+/** \brief End of the format string */
+template <typename Piece>
+struct FormatConversion<Piece, FORMAT_CATEGORY_NONE>
+{
+    /** \brief Maximum length of the conversion output */
+    template <typename... ArgTypes>
+    static constexpr nano_stl_size_t maxLength() { return 0u; }
+
+    /** \brief Write the conversion */
+    template <bool CHECKED, typename... ArgTypes>
+    static void write(FormatOutput<CHECKED>&, const ArgTypes&...) {}
+};
+
+/** \brief Escaped '%' */
+template <typename Piece>
+struct FormatConversion<Piece, FORMAT_CATEGORY_PERCENT>
+{
+    /** \brief Maximum length of the conversion output */
+    template <typename... ArgTypes>
+    static constexpr nano_stl_size_t maxLength() { return 1u; }
+
+    /** \brief Write the conversion */
+    template <bool CHECKED, typename... ArgTypes>
+    static void write(FormatOutput<CHECKED>& output, const ArgTypes&...) { output.putShort("%", 1u); }
+};
+
+/** \brief Writers of the digits of the integer conversions */
+struct FormatDigits
+{
+    /** \brief Write an unsigned integer in decimal backward from the end of a buffer */
+    template <typename UnsignedType>
+    static char* writeDecimal(char* end, UnsignedType value)
+    {
+        while (value >= 100u)
+        {
+            const uint32_t pair = static_cast<uint32_t>(value % 100u);
+            value /= 100u;
+            end -= 2;
+            end[0u] = static_cast<char>('0' + (pair / 10u));
+            end[1u] = static_cast<char>('0' + (pair % 10u));
+        }
+        if (value >= 10u)
+        {
+            end -= 2;
+            end[0u] = static_cast<char>('0' + (value / 10u));
+            end[1u] = static_cast<char>('0' + (value % 10u));
+        }
+        else
+        {
+            end--;
+            (*end) = static_cast<char>('0' + value);
+        }
+        return end;
+    }
+
+    /** \brief Write an unsigned integer in hexadecimal backward from the end of a buffer */
+    template <typename UnsignedType>
+    static char* writeHexa(char* end, UnsignedType value, const bool maj)
+    {
+        const char* const hexa_digits = (maj ? "0123456789ABCDEF" : "0123456789abcdef");
+        do
+        {
+            end--;
+            (*end) = hexa_digits[value & 0x0Fu];
+            value >>= 4u;
+        }
+        while (value != 0u);
+        return end;
+    }
+
+    /** \brief Write digits padded to the given width */
+    template <char FILL, nano_stl_size_t WIDTH, bool CHECKED>
+    static void putPadded(FormatOutput<CHECKED>& output, const char* digits, const nano_stl_size_t length)
+    {
+        if (WIDTH > length)
+        {
+            output.putFill(FILL, WIDTH - length);
+        }
+        output.putShort(digits, length);
+    }
+};
+
+/** \brief Conversions of integer arguments */
+template <typename Piece, FormatCategory CATEGORY>
+struct FormatConversion
+{
+    /** \brief Maximum length of the conversion output */
+    template <typename... ArgTypes>
+    static constexpr nano_stl_size_t maxLength()
+    {
+        return FormatParser::padLength(precisionLength(digitCount<typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type>()), Piece::WIDTH);
+    }
+
+    /** \brief Write the conversion */
+    template <bool CHECKED, typename... ArgTypes>
+    static void write(FormatOutput<CHECKED>& output, const ArgTypes&... args)
+    {
+        typedef typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type ArgType;
+        typedef FormatInteger<sizeof(ArgType)> Integer;
+        static_assert(FormatArgTraits<ArgType>::KIND == FORMAT_ARG_INTEGER, "Format argument type doesn't match the conversion");
+
+        const ArgType& arg = FormatArgument<Piece::ARG_INDEX, ArgTypes...>::get(args...);
+        char digits[20u];
+        char* const end = &digits[sizeof(digits)];
+
+        if (CATEGORY == FORMAT_CATEGORY_SIGNED)
+        {
+            const typename Integer::Signed value = static_cast<typename Integer::Signed>(arg);
+            if (value < 0)
+            {
+                const char* const first = FormatDigits::writeDecimal(end, static_cast<typename Integer::Unsigned>(0u - static_cast<typename Integer::Unsigned>(value)));
+                putDigits(output, true, first, static_cast<nano_stl_size_t>(end - first));
+            }
+            else
+            {
+                const char* const first = FormatDigits::writeDecimal(end, static_cast<typename Integer::Unsigned>(value));
+                putDigits(output, false, first, static_cast<nano_stl_size_t>(end - first));
+            }
+        }
+        else
+        {
+            const typename Integer::Unsigned value = (static_cast<typename Integer::Unsigned>(arg) & Integer::MASK);
+            const char* const first = ((CATEGORY == FORMAT_CATEGORY_UNSIGNED) ? FormatDigits::writeDecimal(end, value) :
+                                                                                FormatDigits::writeHexa(end, value, (Piece::CONVERSION == 'X')));
+            putDigits(output, false, first, static_cast<nano_stl_size_t>(end - first));
+        }
+    }
+
+
+    private:
+
+        /** \brief Maximum number of chars of the conversion of an argument of the given type */
+        template <typename ArgType>
+        static constexpr nano_stl_size_t digitCount()
+        {
+            return ((CATEGORY == FORMAT_CATEGORY_SIGNED) ? (FormatInteger<sizeof(ArgType)>::DECIMAL_LENGTH + ((sizeof(ArgType) == 8u) ? 0u : 1u)) :
+                    (CATEGORY == FORMAT_CATEGORY_UNSIGNED) ? FormatInteger<sizeof(ArgType)>::DECIMAL_LENGTH : (2u * sizeof(ArgType)));
+        }
+
+        /** \brief Maximum number of chars of the conversion once the leading zeros required by the precision are added */
+        static constexpr nano_stl_size_t precisionLength(const nano_stl_size_t length)
+        {
+            return (((Piece::PRECISION >= 0) && ((static_cast<nano_stl_size_t>(Piece::PRECISION) + 1u) > length)) ? (static_cast<nano_stl_size_t>(Piece::PRECISION) + 1u) : length);
+        }
+
+        /** \brief Write the filler characters, the sign, the leading zeros required by the precision and the digits */
+        template <bool CHECKED>
+        static void putDigits(FormatOutput<CHECKED>& output, const bool negative, const char* const first, nano_stl_size_t length)
+        {
+            // The 0 flag is ignored when a precision is given
+            const char fill = ((Piece::PRECISION >= 0) ? ' ' : Piece::FILL);
+
+            // A null value is written without any digit when the precision is 0
+            if ((Piece::PRECISION == 0) && (length == 1u) && (first[0u] == '0'))
+            {
+                length = 0u;
+            }
+            const nano_stl_size_t zero_count = (((Piece::PRECISION >= 0) && (static_cast<nano_stl_size_t>(Piece::PRECISION) > length)) ? (static_cast<nano_stl_size_t>(Piece::PRECISION) - length) : 0u);
+            const nano_stl_size_t total_length = (negative ? 1u : 0u) + zero_count + length;
+
+            // Filler characters and sign
+            if (negative && (fill == '0'))
+            {
+                output.putShort("-", 1u);
+            }
+            if (Piece::WIDTH > total_length)
+            {
+                output.putFill(fill, Piece::WIDTH - total_length);
+            }
+            if (negative && (fill != '0'))
+            {
+                output.putShort("-", 1u);
+            }
+
+            // Leading zeros and digits
+            if (zero_count != 0u)
+            {
+                output.putFill('0', zero_count);
+            }
+            output.putShort(first, length);
+        }
+};
+
+/** \brief Conversion of pointer arguments */
+template <typename Piece>
+struct FormatConversion<Piece, FORMAT_CATEGORY_POINTER>
+{
+    /** \brief Maximum length of the conversion output */
+    template <typename... ArgTypes>
+    static constexpr nano_stl_size_t maxLength() { return FormatParser::padLength(2u + (2u * sizeof(uintptr_t)), Piece::WIDTH); }
+
+    /** \brief Write the conversion */
+    template <bool CHECKED, typename... ArgTypes>
+    static void write(FormatOutput<CHECKED>& output, const ArgTypes&... args)
+    {
+        typedef typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type ArgType;
+        static_assert(FormatArgIsPointer<ArgType>::value, "Format argument type doesn't match the conversion");
+
+        char digits[2u + (2u * sizeof(uintptr_t))];
+        char* const end = &digits[sizeof(digits)];
+        char* const first = FormatDigits::writeHexa(end, reinterpret_cast<uintptr_t>(FormatArgument<Piece::ARG_INDEX, ArgTypes...>::get(args...)), false) - 2;
+        first[0u] = '0';
+        first[1u] = 'x';
+        FormatDigits::putPadded<Piece::FILL, Piece::WIDTH>(output, first, static_cast<nano_stl_size_t>(end - first));
+    }
+};
+
+/** \brief Conversion of string arguments */
+template <typename Piece>
+struct FormatConversion<Piece, FORMAT_CATEGORY_STRING>
+{
+    /** \brief Maximum length of the conversion output */
+    template <typename... ArgTypes>
+    static constexpr nano_stl_size_t maxLength()
+    {
+        static_assert(FormatArgTraits<typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type>::KIND == FORMAT_ARG_STRING, "Format argument type doesn't match the conversion");
+        return FormatParser::padLength(
+                    ((Piece::PRECISION < 0) ? FormatArgMaxLength<typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type>::value : 
+                     ((FormatArgMaxLength<typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type>::value < static_cast<nano_stl_size_t>(Piece::PRECISION)) ? 
+                       FormatArgMaxLength<typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type>::value : static_cast<nano_stl_size_t>(Piece::PRECISION))),
+                    Piece::WIDTH);
+    }
+
+    /** \brief Write the conversion */
+    template <bool CHECKED, typename... ArgTypes>
+    static void write(FormatOutput<CHECKED>& output, const ArgTypes&... args)
+    {
+        typedef typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type ArgType;
+        static_assert(FormatArgTraits<ArgType>::KIND == FORMAT_ARG_STRING, "Format argument type doesn't match the conversion");
+
+        // Only the chars which can fit in the output string are taken into account
+        nano_stl_size_t max_length = output.getFreeSpace();
+        if (Piece::WIDTH > max_length)
+        {
+            max_length = Piece::WIDTH;
+        }
+        if ((Piece::PRECISION >= 0) && (static_cast<nano_stl_size_t>(Piece::PRECISION) < max_length))
+        {
+            max_length = static_cast<nano_stl_size_t>(Piece::PRECISION);
+        }
+
+        nano_stl_size_t length = 0u;
+        const char* const text = getText(FormatArgument<Piece::ARG_INDEX, ArgTypes...>::get(args...), max_length, length);
+        if (Piece::WIDTH > length)
+        {
+            output.putFill(Piece::FILL, Piece::WIDTH - length);
+        }
+        output.putChars(text, length);
+    }
+
+
+    private:
+
+        /** \brief Get the text and the length of a C string */
+        static const char* getText(const char* str, const nano_stl_size_t max_length, nano_stl_size_t& length)
+        {
+            if (str == nullptr)
+            {
+                str = "(null)";
+            }
+            length = static_cast<nano_stl_size_t>(NANO_STL_STRNLEN(str, max_length));
+            return str;
+        }
+
+        /** \brief Get the text and the length of a string */
+        static const char* getText(const IString& str, const nano_stl_size_t max_length, nano_stl_size_t& length)
+        {
+            length = str.getLenght();
+            if (length > max_length)
+            {
+                length = max_length;
+            }
+            return str.cStr();
+        }
+};
+
+/** \brief Conversion of char arguments */
+template <typename Piece>
+struct FormatConversion<Piece, FORMAT_CATEGORY_CHAR>
+{
+    /** \brief Maximum length of the conversion output */
+    template <typename... ArgTypes>
+    static constexpr nano_stl_size_t maxLength() { return FormatParser::padLength(1u, Piece::WIDTH); }
+
+    /** \brief Write the conversion */
+    template <bool CHECKED, typename... ArgTypes>
+    static void write(FormatOutput<CHECKED>& output, const ArgTypes&... args)
+    {
+        typedef typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type ArgType;
+        static_assert(FormatArgTraits<ArgType>::KIND == FORMAT_ARG_INTEGER, "Format argument type doesn't match the conversion");
+
+        const char c = static_cast<char>(FormatArgument<Piece::ARG_INDEX, ArgTypes...>::get(args...));
+        if (Piece::WIDTH > 1u)
+        {
+            output.putFill(Piece::FILL, Piece::WIDTH - 1u);
+        }
+        output.putShort(&c, 1u);
+    }
+};
+
+/** \brief Conversion of floating point arguments (delegated to NANO_STL_SNPRINTF with the specification of the conversion) */
+template <typename Piece>
+struct FormatConversion<Piece, FORMAT_CATEGORY_FLOAT>
+{
+    /** \brief Maximum length of the conversion output (sign, 309 integer digits, point and digits for 'f', 
+     *         sign, 1 digit, point, digits and 5 chars exponent for 'e', one more char for the leading zeros of 'g') */
+    template <typename... ArgTypes>
+    static constexpr nano_stl_size_t maxLength()
+    {
+        return FormatParser::padLength(((Piece::CONVERSION == 'f') || (Piece::CONVERSION == 'F')) ? (311u + digitCount()) : 
+                                       ((Piece::CONVERSION == 'e') || (Piece::CONVERSION == 'E')) ? (8u + digitCount()) : (9u + digitCount()), 
+                                       Piece::WIDTH);
+    }
+
+    /** \brief Write the conversion */
+    template <bool CHECKED, typename... ArgTypes>
+    static void write(FormatOutput<CHECKED>& output, const ArgTypes&... args)
+    {
+        typedef typename FormatArgument<Piece::ARG_INDEX, ArgTypes...>::Type ArgType;
+        typedef FormatText<typename Piece::Format, Piece::SPEC_START, typename FormatMakeIndexes<Piece::SPEC_END - Piece::SPEC_START>::Type> SpecText;
+        static_assert(FormatArgTraits<ArgType>::KIND == FORMAT_ARG_FLOAT, "Format argument type doesn't match the conversion");
+
+        const nano_stl_size_t free_space = output.getFreeSpace();
+        const int ret = NANO_STL_SNPRINTF(output.getCurrent(), free_space + 1u, SpecText::TEXT, 
+                                          static_cast<double>(FormatArgument<Piece::ARG_INDEX, ArgTypes...>::get(args...)));
+        if (ret > 0)
+        {
+            output.advance((static_cast<nano_stl_size_t>(ret) > free_space) ? free_space : static_cast<nano_stl_size_t>(ret));
+        }
+    }
+
+
+    private:
+
+        /** \brief Maximum number of digits after the decimal point */
+        static constexpr nano_stl_size_t digitCount()
+        {
+            return ((Piece::PRECISION < 0) ? 6u : static_cast<nano_stl_size_t>(Piece::PRECISION));
+        }
+};
+
+
+/** \brief Compiled format string, see NANO_STL_FORMAT() */
+template <typename FormatType>
+class FormatString
+{
+    public:
+
+        /** \brief Number of pieces of the format string (a piece is a literal text followed by a conversion) */
+        static constexpr nano_stl_size_t PIECE_COUNT = FormatParser::pieceCount(FormatType::str(), 0u);
+
+        /** \brief Number of arguments of the format string */
+        static constexpr nano_stl_size_t ARG_COUNT = FormatParser::argumentIndex(FormatType::str(), PIECE_COUNT);
+
+
+        /** \brief Get the format string */
+        static constexpr const char* str() { return FormatType::str(); }
+
+        /** \brief Get the maximum length of the output for the given argument types 
+         *         (FORMAT_UNBOUNDED_LENGTH if a C string argument is not bounded by a precision) */
+        template <typename... ArgTypes>
+        static constexpr nano_stl_size_t maxLength() 
+        { 
+            return pieceLength<ArgTypes...>(typename FormatMakeIndexes<PIECE_COUNT>::Type()); 
+        }
+
+        /** \brief Format a string of the given size (number of chars excluding the null terminator), 
+         *         returns the number of chars written in the string excluding the null terminator */
+        template <typename... ArgTypes>
+        static nano_stl_size_t write(char* str, const nano_stl_size_t size, const ArgTypes&... args)
+        {
+            static_assert(ARG_COUNT == sizeof...(ArgTypes), "Wrong number of arguments for the format string");
+
+            nano_stl_size_t length;
+            if (maxLength<ArgTypes...>() <= size)
+            {
+                // No need to check the free space before writing
+                FormatOutput<false> output(str, size);
+                writePieces(output, typename FormatMakeIndexes<PIECE_COUNT>::Type(), args...);
+                length = output.getLength();
+            }
+            else
+            {
+                FormatOutput<true> output(str, size);
+                writePieces(output, typename FormatMakeIndexes<PIECE_COUNT>::Type(), args...);
+                length = output.getLength();
+            }
+            str[length] = 0;
+
+            return length;
+        }
+
+
+    private:
+
+        /** \brief Compute the maximum length of the output of the given pieces */
+        template <typename... ArgTypes>
+        static constexpr nano_stl_size_t pieceLength(FormatIndexes<>) { return 0u; }
+        template <typename... ArgTypes, nano_stl_size_t FIRST, nano_stl_size_t... OTHERS>
+        static constexpr nano_stl_size_t pieceLength(FormatIndexes<FIRST, OTHERS...>)
+        {
+            return FormatParser::addLength(FormatParser::addLength(FormatPiece<FormatType, FIRST>::LITERAL_LENGTH, 
+                                                                   FormatConversion<FormatPiece<FormatType, FIRST> >::template maxLength<ArgTypes...>()),
+                                           pieceLength<ArgTypes...>(FormatIndexes<OTHERS...>()));
+        }
+
+        /** \brief Write the given pieces */
+        template <bool CHECKED, nano_stl_size_t... INDEXES, typename... ArgTypes>
+        static void writePieces(FormatOutput<CHECKED>& output, FormatIndexes<INDEXES...>, const ArgTypes&... args)
+        {
+            const int pieces[] = { (writePiece<FormatPiece<FormatType, INDEXES> >(output, args...), 0)... };
+            (void)pieces;
+        }
+
+        /** \brief Write a piece */
+        template <typename Piece, bool CHECKED, typename... ArgTypes>
+        static void writePiece(FormatOutput<CHECKED>& output, const ArgTypes&... args)
+        {
+            output.template putLiteral<Piece::LITERAL_LENGTH>(FormatType::str() + Piece::LITERAL_START);
+            FormatConversion<Piece>::write(output, args...);
+        }
+};
+
+}
+
+#endif // __cplusplus
+
+#endif // STRINGFORMAT_H